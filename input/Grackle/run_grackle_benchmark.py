@@ -0,0 +1,95 @@
+#!/bin/python
+
+# Compares the throughput of EnzoMethodGrackle in zones per second for
+# different values of Method:grackle:num_slabs.
+# - This script expects to be called from the root level of the repository
+# - Slab splitting only takes effect when Enzo-E is built with smp=ON and
+#   launched with more than one worker thread per process (e.g. ++ppn)
+#
+# The throughput is the number of zone updates divided by the time in
+# the "grackle" performance region, averaged over PEs.  It is a
+# benchmark, not a pass/fail test.
+
+import argparse
+import os.path
+import re
+import subprocess
+import sys
+
+_LOCAL_DIR = os.path.dirname(os.path.realpath(__file__))
+_TOOLS_DIR = os.path.join(_LOCAL_DIR, "../../tools")
+if os.path.isdir(_TOOLS_DIR):
+    sys.path.insert(0, _TOOLS_DIR)
+    from gen_grackle_testing_file import generate_grackle_input_file
+
+else:
+    raise RuntimeError(
+        f"expected testing utilities to be defined in {_TOOLS_DIR}, but that "
+        "directory does not exist"
+    )
+
+# must match method_grackle_benchmark.in
+_ZONES_PER_CYCLE = 64**3
+
+# e.g. "Performance grackle time-usec 123456"
+_GRACKLE_TIME = re.compile(r"Performance\s+grackle time-usec (\d+)")
+# e.g. "Simulation cycle 0010"
+_CYCLE = re.compile(r"Simulation\s+cycle (\d+)")
+
+def run_case(launch_cmd, config_path, grackle_data_file, num_slabs):
+    generate_grackle_input_file(
+        include_path = os.path.join(_LOCAL_DIR, 'method_grackle_benchmark.in'),
+        data_path = grackle_data_file,
+        use_abs_paths = True,
+        output_fname = config_path
+    )
+    with open(config_path, 'a') as f:
+        f.write("\nMethod {{ grackle {{ num_slabs = {:d}; }} }}\n"
+                .format(num_slabs))
+
+    command = launch_cmd + ' ' + config_path
+    output = subprocess.run(command, shell=True, stdout=subprocess.PIPE,
+                            stderr=subprocess.STDOUT,
+                            universal_newlines=True).stdout
+
+    times = [int(m.group(1)) for m in _GRACKLE_TIME.finditer(output)]
+    cycles = [int(m.group(1)) for m in _CYCLE.finditer(output)]
+    if len(times) == 0 or len(cycles) == 0:
+        return None
+    return cycles[-1], times[-1]
+
+if __name__ == '__main__':
+
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--launch_cmd', required=True, type=str,
+                        help = "command used to launch Enzo-E")
+    parser.add_argument('--grackle-data-file', required=True, type=str)
+    parser.add_argument('--num-pes', required=True, type=int,
+                        help = "total number of PEs used by --launch_cmd")
+    parser.add_argument('--num-slabs', type=int, nargs='+', default=[1,0],
+                        help = "values of Method:grackle:num_slabs to "
+                        "compare (0 is one slab per thread)")
+    parser.add_argument('--generate-config-path', type=str,
+                        default='grackle-benchmark.in')
+    args = parser.parse_args()
+
+    print("{:>9s} {:>7s} {:>14s} {:>14s} {:>8s}".format(
+        "num_slabs", "cycles", "grackle [s]", "zones/sec", "speedup"))
+
+    ok = True
+    base = None
+    for num_slabs in args.num_slabs:
+        result = run_case(args.launch_cmd, args.generate_config_path,
+                          args.grackle_data_file, num_slabs)
+        if result is None:
+            print("{:>9d} no grackle timings found in output".format(num_slabs))
+            ok = False
+            continue
+        cycles, usec = result
+        seconds = 1.0e-6 * usec / args.num_pes
+        rate = cycles * _ZONES_PER_CYCLE / seconds if seconds > 0 else 0.0
+        if base is None: base = rate
+        print("{:>9d} {:>7d} {:>14.3f} {:>14.4e} {:>8.2f}".format(
+            num_slabs, cycles, seconds, rate, rate/base if base else 0.0))
+
+    sys.exit(0 if ok else 3)
@@ -0,0 +1,66 @@
+#!/bin/python
+
+# Compares BiCgStab gravity solves on an adaptive mesh with three
+# preconditioners: diagonal, root-grid multigrid ("mg0", as in the HG
+# solver), and FAS multigrid over the full AMR hierarchy ("mg_amr").
+# - This script expects to be called from the root level of the repository
+#
+# For each preconditioner this reports the number of BiCgStab iterations
+# per gravity solve (taken from the Solver monitor output) and the total
+# wall-clock time of the run.  It is a benchmark, not a pass/fail test.
+
+import argparse
+import re
+import subprocess
+import sys
+import time
+
+_CASES = [("diagonal", "input/Gravity/mg-amr/bcg-diagonal.in"),
+          ("mg0",      "input/Gravity/mg-amr/bcg-mg0.in"),
+          ("mg_amr",   "input/Gravity/mg-amr/bcg-mg-amr.in")]
+
+# e.g. "Solver bcg  iter 0012  err 9.1e-07 [0 0]"; each solve restarts
+# at iter 0000, so the last line before that is the converged iteration
+_ITER = re.compile(r"Solver bcg\s+(?:final\s+)?iter (\d+)\s+err (\S+)")
+
+def run_case(launch_cmd, input_file):
+    command = launch_cmd + ' ' + input_file
+    t0 = time.time()
+    output = subprocess.run(command, shell=True, stdout=subprocess.PIPE,
+                            stderr=subprocess.STDOUT,
+                            universal_newlines=True).stdout
+    wall = time.time() - t0
+
+    iters = []
+    errs = []
+    for match in _ITER.finditer(output):
+        it, err = int(match.group(1)), float(match.group(2))
+        if it == 0 or len(iters) == 0:
+            iters.append(it)
+            errs.append(err)
+        else:
+            iters[-1] = it
+            errs[-1] = err
+    return iters, errs, wall
+
+if __name__ == '__main__':
+
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--launch_cmd', required=True,type=str)
+    args = parser.parse_args()
+
+    print("{:<10s} {:>7s} {:>10s} {:>10s} {:>12s} {:>10s}".format(
+        "precon", "solves", "iter/solve", "max iter", "max err", "wall [s]"))
+
+    ok = True
+    for name, input_file in _CASES:
+        iters, errs, wall = run_case(args.launch_cmd, input_file)
+        if len(iters) == 0:
+            print("{:<10s} no BiCgStab solves found in output".format(name))
+            ok = False
+            continue
+        print("{:<10s} {:>7d} {:>10.1f} {:>10d} {:>12.3e} {:>10.2f}".format(
+            name, len(iters), sum(iters)/len(iters), max(iters),
+            max(errs), wall))
+
+    sys.exit(0 if ok else 3)
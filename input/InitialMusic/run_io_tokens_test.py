@@ -0,0 +1,119 @@
+#!/bin/python
+
+# reads MUSIC initial conditions with the "hdf5" initializer without a
+# limit on concurrent readers, and with Performance:io:tokens = 1 for both
+# Performance:io:scope = "global" and "node", and checks that the fields and
+# particles that are written out are bitwise identical, and that tokens
+# were granted (the "num-io-grant" performance counter).
+# - This script expects to be called from the root level of the repository
+#   OR at the same level where its defined
+
+import argparse
+import os.path
+import re
+import shutil
+import subprocess
+import sys
+
+import numpy as np
+
+# import testing utilities defined for VL+CT tests
+_LOCAL_DIR = os.path.dirname(os.path.realpath(__file__))
+_VLCT_DIR = os.path.join(_LOCAL_DIR, "../vlct")
+if os.path.isdir(_VLCT_DIR):
+    sys.path.insert(0, _VLCT_DIR)
+    from testing_utils import testing_context
+else:
+    raise RuntimeError(f"expected VL+CT tests to be defined in {_VLCT_DIR}, "
+                       "but that that directory does not exist")
+
+from run_read_mode_test import _load_data
+
+_RUNS = ['block', 'tokens_global', 'tokens_node']
+
+# e.g. "Performance counter num-io-grant 64"
+_IO_GRANT = re.compile(r"counter num-io-grant (\d+)")
+
+def run_tests(executable):
+
+    temp = 'input/InitialMusic/initial_hdf5-{}.in'
+
+    num_grant = {}
+    for run in _RUNS:
+        command = executable + ' ' + temp.format(run)
+        output = subprocess.run(command, shell=True, stdout=subprocess.PIPE,
+                                stderr=subprocess.STDOUT,
+                                universal_newlines=True).stdout
+        print(output)
+        grants = [int(n) for n in _IO_GRANT.findall(output)]
+        num_grant[run] = max(grants) if len(grants) > 0 else None
+    return num_grant
+
+def analyze_tests(num_grant):
+    r = []
+
+    # tokens are only requested when their number is limited
+    for run in _RUNS:
+        n = num_grant[run]
+        expected = (run != 'block')
+        if n is None:
+            print("FAILED: num-io-grant was not reported ({})".format(run))
+            r.append(False)
+        elif (n > 0) != expected:
+            print("FAILED: num-io-grant is {} ({})".format(n, run))
+            r.append(False)
+        else:
+            r.append(True)
+
+    ref = _load_data('block')
+    if ref is None:
+        return False
+
+    for run in _RUNS[1:]:
+        data = _load_data(run)
+        if data is None:
+            r.append(False)
+            continue
+        for field in sorted(ref.keys()):
+            name = field[0] + ":" + field[1] + " (" + run + ")"
+            if field not in data:
+                print("FAILED: {} was not written".format(name))
+                r.append(False)
+            elif np.array_equal(ref[field], data[field]):
+                r.append(True)
+            else:
+                print("FAILED: {} differs from the run without io tokens"
+                      .format(name))
+                r.append(False)
+
+    n_passed = np.sum(r)
+    n_tests = len(r)
+    print("{:d} Tests passed out of {:d} Tests.".format(n_passed,n_tests))
+
+    return n_passed == n_tests
+
+def cleanup():
+    for run in _RUNS:
+        dir_name = 'hdf5_{}_00'.format(run)
+        if os.path.isdir(dir_name):
+            shutil.rmtree(dir_name)
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--launch_cmd', required=True,type=str)
+    args = parser.parse_args()
+
+    with testing_context():
+        # run the tests
+        num_grant = run_tests(args.launch_cmd)
+
+        # analyze the tests
+        tests_passed = analyze_tests(num_grant)
+
+        # cleanup the tests
+        cleanup()
+
+    if tests_passed:
+        sys.exit(0)
+    else:
+        sys.exit(3)
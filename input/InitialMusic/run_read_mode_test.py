@@ -0,0 +1,120 @@
+#!/bin/python
+
+# reads MUSIC initial conditions with Initial:hdf5:read_mode = "block" and
+# with read_mode = "slab" (for slab_depth values of 3 and 0), and checks
+# that the fields and particles that are written out are bitwise identical.
+# - This script expects to be called from the root level of the repository
+#   OR at the same level where its defined
+#
+# Each reader covers 4 layers of root blocks along z, so slab_depth = 3
+# also covers a partial slab.
+
+import argparse
+import os.path
+import sys
+import shutil
+
+import numpy as np
+import yt
+
+yt.mylog.setLevel(30) # set yt log level to "WARNING"
+
+# import testing utilities defined for VL+CT tests
+_LOCAL_DIR = os.path.dirname(os.path.realpath(__file__))
+_VLCT_DIR = os.path.join(_LOCAL_DIR, "../vlct")
+if os.path.isdir(_VLCT_DIR):
+    sys.path.insert(0, _VLCT_DIR)
+    from testing_utils import testing_context, EnzoEWrapper
+else:
+    raise RuntimeError(f"expected VL+CT tests to be defined in {_VLCT_DIR}, "
+                       "but that that directory does not exist")
+
+_RUNS = ['block', 'slab3', 'slab0']
+
+def run_tests(executable):
+
+    temp = 'input/InitialMusic/initial_hdf5-{}.in'
+    wrapper = EnzoEWrapper(executable,temp)
+
+    for run in _RUNS:
+        wrapper(run)
+
+def _load_data(run):
+    fname = 'hdf5_{0}_00/hdf5_{0}_00.block_list'.format(run)
+    if not os.path.isfile(fname):
+        print("FAILED: {} was not written".format(fname))
+        return None
+    ds = yt.load(fname)
+    grid = ds.covering_grid(0, ds.domain_left_edge, ds.domain_dimensions)
+    data = dict((field, grid[field].v) for field in ds.field_list
+                if field[0] != 'dark')
+
+    # particles are compared after sorting them, since the order of the
+    # blocks in the block_list file isn't fixed
+    ad = ds.all_data()
+    attributes = ['x', 'y', 'z', 'vx', 'vy', 'vz']
+    values = [ad['dark', attr].v for attr in attributes]
+    order = np.lexsort(values[::-1])
+    for attr, value in zip(attributes, values):
+        data[('dark', attr)] = value[order]
+    return data
+
+def analyze_tests():
+    ref = _load_data('block')
+    if ref is None:
+        return False
+
+    r = []
+    for run in _RUNS[1:]:
+        data = _load_data(run)
+        if data is None:
+            r.append(False)
+            continue
+        for field in sorted(ref.keys()):
+            name = field[0] + ":" + field[1] + " (" + run + ")"
+            if field not in data:
+                print("FAILED: {} was not written".format(name))
+                r.append(False)
+            elif np.array_equal(ref[field], data[field]):
+                r.append(True)
+            elif ref[field].shape != data[field].shape:
+                print("FAILED: {} has shape {} instead of {}".format
+                      (name, data[field].shape, ref[field].shape))
+                r.append(False)
+            else:
+                n_diff = np.count_nonzero(ref[field] != data[field])
+                print(("FAILED: {} differs from the block read mode in {} "
+                       "of {} values").format(name, n_diff, ref[field].size))
+                r.append(False)
+
+    n_passed = np.sum(r)
+    n_tests = len(r)
+    print("{:d} Tests passed out of {:d} Tests.".format(n_passed,n_tests))
+
+    return n_passed == n_tests
+
+def cleanup():
+    for run in _RUNS:
+        dir_name = 'hdf5_{}_00'.format(run)
+        if os.path.isdir(dir_name):
+            shutil.rmtree(dir_name)
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--launch_cmd', required=True,type=str)
+    args = parser.parse_args()
+
+    with testing_context():
+        # run the tests
+        tests_complete = run_tests(args.launch_cmd)
+
+        # analyze the tests
+        tests_passed = analyze_tests()
+
+        # cleanup the tests
+        cleanup()
+
+    if tests_passed:
+        sys.exit(0)
+    else:
+        sys.exit(3)
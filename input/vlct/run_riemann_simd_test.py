@@ -0,0 +1,126 @@
+#!/bin/python
+
+# runs VLCT problems with the scalar (Method:mhd_vlct:riemann_simd = "none")
+# and the vectorized ("auto") Riemann Solver kernels, and checks that the
+# results agree.
+# - This script expects to be called from the root level of the repository
+#   OR at the same level where its defined
+#
+# Each pair of runs starts from identical initial conditions, so this
+# compares the explicitly vectorized kernels with the KernelFunctor path of
+# EnzoRiemannImpl. The results are expected to be bitwise identical. When
+# the scalar kernels are compiled with fused multiply-adds (e.g. with
+# -march=native) they may differ slightly, so small relative differences
+# are accepted (and reported).
+
+import argparse
+import os.path
+import sys
+import shutil
+
+import numpy as np
+import yt
+
+yt.mylog.setLevel(30) # set yt log level to "WARNING"
+
+from testing_utils import testing_context, EnzoEWrapper
+
+# maps the name of each problem to the time of its output. The problems
+# cover each of the vectorized kernels (hydro and MHD HLLE, HLLC and HLLD)
+_PROBLEMS = {'hlle_hd'  : 0.0625,
+             'hllc'     : 0.0625,
+             'hlle_mhd' : 0.0625,
+             'hlld'     : 0.2}
+
+# relative L1 difference that is tolerated for each precision
+_TOLERANCE = {'single' : 1.e-4, 'double' : 1.e-10}
+
+def _dir_name(problem, simd):
+    return '{}_{}_{:.4f}'.format(problem, simd, _PROBLEMS[problem])
+
+def run_tests(executable):
+
+    temp = 'input/vlct/riemann_simd/{}_{}.in'
+    wrapper = EnzoEWrapper(executable,temp)
+
+    for problem in _PROBLEMS:
+        for simd in ['none', 'auto']:
+            wrapper(problem, simd)
+
+def _load_fields(problem, simd):
+    dir_name = _dir_name(problem, simd)
+    fname = '{0}/{0}.block_list'.format(dir_name)
+    if not os.path.isfile(fname):
+        print("FAILED: {} was not written".format(fname))
+        return None
+    ds = yt.load(fname)
+    grid = ds.covering_grid(0, ds.domain_left_edge, ds.domain_dimensions)
+    return dict((field, grid[field].v) for field in ds.field_list)
+
+def analyze_tests(prec):
+    tol = _TOLERANCE[prec]
+
+    r = []
+    for problem in _PROBLEMS:
+        ref = _load_fields(problem, 'none')
+        data = _load_fields(problem, 'auto')
+        if (ref is None) or (data is None):
+            r.append(False)
+            continue
+        for field in sorted(ref.keys()):
+            name = field[1] + " (" + problem + ")"
+            if np.array_equal(ref[field], data[field]):
+                r.append(True)
+                continue
+            norm = np.sum(np.abs(ref[field]))
+            diff = np.sum(np.abs(ref[field] - data[field]))
+            rel_diff = diff / norm if norm > 0 else diff
+            n_diff = np.count_nonzero(ref[field] != data[field])
+            if rel_diff <= tol:
+                print(("PASSED: {} differs from the scalar kernels in {} of "
+                       "{} cells, with a relative L1 difference of "
+                       "{}").format(name, n_diff, ref[field].size,
+                                    repr(rel_diff)))
+                r.append(True)
+            else:
+                print(("FAILED: {} differs from the scalar kernels in {} of "
+                       "{} cells, with a relative L1 difference of {} "
+                       "(tolerance: {})").format(name, n_diff,
+                                                 ref[field].size,
+                                                 repr(rel_diff), repr(tol)))
+                r.append(False)
+
+    n_passed = np.sum(r)
+    n_tests = len(r)
+    print("{:d} Tests passed out of {:d} Tests.".format(n_passed,n_tests))
+
+    return n_passed == n_tests
+
+def cleanup():
+    for problem in _PROBLEMS:
+        for simd in ['none', 'auto']:
+            dir_name = _dir_name(problem, simd)
+            if os.path.isdir(dir_name):
+                shutil.rmtree(dir_name)
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--launch_cmd', required=True,type=str)
+    parser.add_argument('--prec', choices=['single', 'double'],
+                        default='double', type=str)
+    args = parser.parse_args()
+
+    with testing_context():
+        # run the tests
+        tests_complete = run_tests(args.launch_cmd)
+
+        # analyze the tests
+        tests_passed = analyze_tests(args.prec)
+
+        # cleanup the tests
+        cleanup()
+
+    if tests_passed:
+        sys.exit(0)
+    else:
+        sys.exit(3)
@@ -0,0 +1,96 @@
+#!/bin/python
+
+# runs the VLCT dual energy cloud test with and without tiled execution
+# (Method:mhd_vlct:tile_size) and checks that the results are bitwise
+# identical.
+# - This script expects to be called from the root level of the repository
+#   OR at the same level where its defined
+#
+# The cloud problem exercises the dual energy formalism, passive scalars and
+# inflow boundaries. The 5x5 tiles don't evenly divide the block, so the
+# test also covers partial tiles at the block edges.
+
+import argparse
+import os.path
+import sys
+import shutil
+
+import numpy as np
+import yt
+
+yt.mylog.setLevel(30) # set yt log level to "WARNING"
+
+from testing_utils import testing_context, EnzoEWrapper
+
+_RUNS = ['untiled', 'tile5', 'tile8']
+
+def run_tests(executable):
+
+    temp = 'input/vlct/tiled_cloud/{}_cloud.in'
+    wrapper = EnzoEWrapper(executable,temp)
+
+    for run in _RUNS:
+        wrapper(run)
+
+def _load_fields(run):
+    fname = '{0}_cloud_0.0625/{0}_cloud_0.0625.block_list'.format(run)
+    if not os.path.isfile(fname):
+        print("FAILED: {} was not written".format(fname))
+        return None
+    ds = yt.load(fname)
+    grid = ds.covering_grid(0, ds.domain_left_edge, ds.domain_dimensions)
+    return dict((field, grid[field].v) for field in ds.field_list)
+
+def analyze_tests():
+    ref = _load_fields('untiled')
+    if ref is None:
+        return False
+
+    r = []
+    for run in _RUNS[1:]:
+        data = _load_fields(run)
+        if data is None:
+            r.append(False)
+            continue
+        for field in sorted(ref.keys()):
+            # exact comparison: tiling must not change a single bit
+            if np.array_equal(ref[field], data[field]):
+                r.append(True)
+            else:
+                n_diff = np.count_nonzero(ref[field] != data[field])
+                print(("FAILED: {} differs from the untiled run in {} of {} "
+                       "cells").format(field[1] + " (" + run + ")", n_diff,
+                                       ref[field].size))
+                r.append(False)
+
+    n_passed = np.sum(r)
+    n_tests = len(r)
+    print("{:d} Tests passed out of {:d} Tests.".format(n_passed,n_tests))
+
+    return n_passed == n_tests
+
+def cleanup():
+    for run in _RUNS:
+        dir_name = '{}_cloud_0.0625'.format(run)
+        if os.path.isdir(dir_name):
+            shutil.rmtree(dir_name)
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--launch_cmd', required=True,type=str)
+    args = parser.parse_args()
+
+    with testing_context():
+        # run the tests
+        tests_complete = run_tests(args.launch_cmd)
+
+        # analyze the tests
+        tests_passed = analyze_tests()
+
+        # cleanup the tests
+        cleanup()
+
+    if tests_passed:
+        sys.exit(0)
+    else:
+        sys.exit(3)
@@ -49,7 +49,8 @@ extern void png_array (const char * filename,
 // Defines
 //----------------------------------------------------------------------
 
-#define PARTICLE_ALIGN 16
+// PARTICLE_ALIGN is defined in data_ParticleSpan.hpp
+#include "data_ParticleSpan.hpp"
 
 // integer limits on particle position within a Block:
 //
@@ -80,6 +81,7 @@ class FieldData;
 class FieldFace;
 
 #include "data_Grouping.hpp"
+#include "data_BufferPool.hpp"
 
 #include "data_ScalarDescr.hpp"
 #include "data_ScalarData.hpp"
@@ -184,6 +184,13 @@ namespace cello {
 
   //---------------------------------------------------------------------- 
 
+  IoAdmission * io_admission()
+  {
+    return proxy_io_admission.ckLocalBranch();
+  }
+
+  //---------------------------------------------------------------------- 
+
   const Factory * factory()
   {
     return simulation()->factory();
@@ -52,6 +52,7 @@ class Field;
 class FieldDescr;
 class Grouping;
 class Hierarchy;
+class IoAdmission;
 class Monitor;
 class Output;
 class Parameters;
@@ -711,6 +712,9 @@ namespace cello {
   Boundary *      boundary(int i);
   /// Return a pointer to the Hierarchy object defining the mesh hierarchy
   Hierarchy *     hierarchy();
+  /// Return a pointer to the IoAdmission object limiting concurrent
+  /// file readers and writers
+  IoAdmission *   io_admission();
   /// Return a pointer to the Config object containing user parameters values
   const Config *  config();
   /// Return a pointer to the Parameters object
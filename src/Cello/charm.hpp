@@ -12,8 +12,10 @@
 #include "_error.hpp"
 #include "mesh_Index.hpp"
 #include "charm_reductions.hpp"
+#include "charm_IoAdmission.hpp"
 #include "charm_MappingArray.hpp"
 #include "charm_MappingIo.hpp"
+#include "charm_MappingSfc.hpp"
 #include "charm_MappingTree.hpp"
 
 #include "charm_FieldMsg.hpp"
@@ -0,0 +1,137 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     charm_IoAdmission.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Implementation of the IoAdmission file I/O semaphore
+
+#include "data.hpp"
+#include "charm.hpp"
+#include "charm_simulation.hpp"
+
+// #define TRACE_IO_ADMISSION
+
+//----------------------------------------------------------------------
+
+long IoAdmission::counter_grant[CONFIG_NODE_SIZE] = {0};
+long IoAdmission::counter_wait_usec[CONFIG_NODE_SIZE] = {0};
+long IoAdmission::counter_wait_usec_max[CONFIG_NODE_SIZE] = {0};
+
+//======================================================================
+
+IoAdmission::IoAdmission(int num_tokens, std::string scope)
+  : CBase_IoAdmission(),
+    num_tokens_(num_tokens),
+    scope_(scope),
+    num_available_(num_tokens),
+    queue_()
+{
+  ASSERT1 ("IoAdmission::IoAdmission()",
+           "Unsupported scope '%s': must be \"global\" or \"node\"",
+           scope.c_str(),
+           (scope == "global" || scope == "node"));
+}
+
+//----------------------------------------------------------------------
+
+void IoAdmission::pup (PUP::er &p)
+{
+  TRACEPUP;
+  CBase_IoAdmission::pup(p);
+  // NOTE: change this function whenever attributes change
+  p | num_tokens_;
+  p | scope_;
+  p | num_available_;
+}
+
+//----------------------------------------------------------------------
+
+void IoAdmission::acquire (CkCallback granted)
+{
+  if (is_active()) {
+    // the wait is measured on this process, from sending the request
+    // to receiving the grant in p_granted()
+    thisProxy[server_pe_()].p_acquire(granted,CkMyPe(),CkWallTimer());
+  } else {
+    granted.send();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void IoAdmission::release ()
+{
+  if (is_active()) {
+    thisProxy[server_pe_()].p_release();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void IoAdmission::p_acquire
+(CkCallback granted, int pe_request, double time_request)
+{
+  Request request = { granted, pe_request, time_request };
+  if (num_available_ > 0) {
+    --num_available_;
+    grant_(request);
+  } else {
+    queue_.push_back(request);
+  }
+#ifdef TRACE_IO_ADMISSION
+  CkPrintf ("%d TRACE_IO_ADMISSION acquire available %d queued %d\n",
+            CkMyPe(),num_available_,int(queue_.size()));
+#endif
+}
+
+//----------------------------------------------------------------------
+
+void IoAdmission::p_release ()
+{
+  if (! queue_.empty()) {
+    // pass the token directly to the next queued request
+    Request request = queue_.front();
+    queue_.pop_front();
+    grant_(request);
+  } else {
+    ASSERT2 ("IoAdmission::p_release()",
+             "More tokens released (%d) than acquired (%d)",
+             num_available_+1,num_tokens_,
+             (num_available_ < num_tokens_));
+    ++num_available_;
+  }
+#ifdef TRACE_IO_ADMISSION
+  CkPrintf ("%d TRACE_IO_ADMISSION release available %d queued %d\n",
+            CkMyPe(),num_available_,int(queue_.size()));
+#endif
+}
+
+//----------------------------------------------------------------------
+
+void IoAdmission::p_granted (CkCallback granted, double time_request)
+{
+  // time_request was taken by CkWallTimer() on this process
+  const int in = cello::index_static();
+  const long wait_usec = long(1e6*(CkWallTimer() - time_request));
+  ++counter_grant[in];
+  counter_wait_usec[in] += wait_usec;
+  counter_wait_usec_max[in] = std::max(counter_wait_usec_max[in],wait_usec);
+  granted.send();
+}
+
+//----------------------------------------------------------------------
+
+int IoAdmission::server_pe_() const
+{
+  // the physical node, since with non-SMP builds each process is its
+  // own Charm++ node
+  return (scope_ == "node") ?
+    CmiGetFirstPeOnPhysicalNode(CmiPhysicalNodeID(CkMyPe())) : 0;
+}
+
+//----------------------------------------------------------------------
+
+void IoAdmission::grant_ (Request & request)
+{
+  thisProxy[request.pe].p_granted(request.granted,request.time);
+}
@@ -0,0 +1,122 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     charm_IoAdmission.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Parallel] Declaration of the IoAdmission class
+
+#ifndef CHARM_IO_ADMISSION_HPP
+#define CHARM_IO_ADMISSION_HPP
+
+#include <deque>
+
+#include "simulation.decl.h"
+
+class IoAdmission : public CBase_IoAdmission {
+
+  /// @class    IoAdmission
+  /// @ingroup  Charm
+  /// @brief    [\ref Parallel] Counting semaphore limiting the number
+  /// of concurrent file readers and writers
+  ///
+  /// A reader or writer calls acquire() with a callback before opening
+  /// its file, and release() after closing it.  Requests are sent to a
+  /// server element, either on PE 0 ("global" scope) or on the first PE
+  /// of the requester's physical node ("node" scope).  The server grants
+  /// the token immediately if one is available, and otherwise when one
+  /// is released, in the order requested.  The grant is sent back to the
+  /// requesting PE, which invokes the callback.  The requester
+  /// accumulates the time from sending each request to receiving its
+  /// grant in the counters below.  These counters are included in the
+  /// Performance monitor output.  If the number of tokens is 0 then
+  /// acquire() invokes the callback directly.
+
+public: // interface
+
+  /// Constructor
+  IoAdmission(int num_tokens, std::string scope);
+
+  /// CHARM++ migration constructor
+  IoAdmission(CkMigrateMessage *m)
+    : CBase_IoAdmission(m),
+      num_tokens_(0),
+      scope_("global"),
+      num_available_(0),
+      queue_()
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p);
+
+  /// Whether concurrent file access is limited
+  bool is_active() const
+  { return num_tokens_ > 0; }
+
+  /// Request a token; granted is invoked when one is available
+  void acquire (CkCallback granted);
+
+  /// Return a token acquired with acquire()
+  void release ();
+
+public: // entry methods
+
+  /// [server] Queue a request for a token, sent by PE pe_request at
+  /// time_request (its CkWallTimer())
+  void p_acquire (CkCallback granted, int pe_request, double time_request);
+
+  /// [server] Return a token, granting it to the next queued request
+  void p_release ();
+
+  /// [requester] Receive a granted token: update the waiting time
+  /// counters and invoke the callback
+  void p_granted (CkCallback granted, double time_request);
+
+public: // static attributes
+
+  /// Number of tokens granted to requests from this process
+  static long counter_grant[CONFIG_NODE_SIZE];
+
+  /// Total and maximum time in microseconds from sending requests to
+  /// receiving their grants, for requests from this process
+  static long counter_wait_usec[CONFIG_NODE_SIZE];
+  static long counter_wait_usec_max[CONFIG_NODE_SIZE];
+
+protected: // types
+
+  /// [server] A request for a token
+  struct Request {
+    CkCallback granted;
+    int pe;
+    double time;
+  };
+
+protected: // functions
+
+  /// Process of the server element for requests from this process
+  int server_pe_() const;
+
+  /// [server] Send a token to the requester
+  void grant_ (Request & request);
+
+protected: // attributes
+
+  // NOTE: change pup() function whenever attributes change
+
+  /// Maximum number of concurrent readers and writers per server, or
+  /// 0 for unlimited
+  int num_tokens_;
+
+  /// Whether tokens are shared by all processes ("global") or by the
+  /// processes in a physical node ("node")
+  std::string scope_;
+
+  /// [server] Number of tokens not currently acquired
+  int num_available_;
+
+  /// [server] Queued requests (not pup'ed: requests are only queued
+  /// during file I/O)
+  std::deque<Request> queue_;
+
+};
+
+#endif /* CHARM_IO_ADMISSION_HPP */
@@ -0,0 +1,142 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     charm_MappingSfc.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Mapping of Charm++ array Index to processors along a
+///           space-filling curve
+
+#include "charm.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+//======================================================================
+
+MappingSfc::MappingSfc(int nx, int ny, int nz, int rank, bool hilbert)
+  :  CkArrayMap(),
+     nx_(nx),ny_(ny),nz_(nz),
+     rank_(rank),
+     hilbert_(hilbert),
+     bits_(0),
+     root_order_()
+{
+  // bits needed for root-level Block coordinates
+  const int n = std::max(nx,std::max(ny,nz));
+  while ((1 << bits_) < n) ++bits_;
+
+  // order root-level Blocks along the curve; since the grid need not
+  // be a power of two, keys are replaced by their rank
+  const int nb = nx*ny*nz;
+  std::vector< std::pair<unsigned long long,int> > keys (nb);
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      for (int ix=0; ix<nx; ix++) {
+        const int i = ix + nx*(iy + ny*iz);
+        const int x3[3] = {ix,iy,iz};
+        keys[i] = std::make_pair(sfc_key(x3,rank_,bits_,hilbert_),i);
+      }
+    }
+  }
+  std::sort(keys.begin(),keys.end());
+
+  root_order_.resize(nb);
+  for (int k=0; k<nb; k++) {
+    root_order_[keys[k].second] = k;
+  }
+}
+
+//----------------------------------------------------------------------
+
+int MappingSfc::procNum(int, const CkArrayIndex &idx) {
+
+  int v3[3];
+
+  v3[0] = idx.data()[0];
+  v3[1] = idx.data()[1];
+  v3[2] = idx.data()[2];
+
+  Index in;
+  in.set_values(v3);
+
+  int iax,iay,iaz;
+  in.array (&iax,&iay,&iaz);
+
+  // Blocks in negative levels are mapped with their root-level Block;
+  // finer levels are limited by the number of bits in the key
+  const int max_level = 62/rank_ - bits_;
+  const int level = std::min(std::max(in.level(),0),max_level);
+
+  int x3[3] = {iax,iay,iaz};
+  for (int l=0; l<level; l++) {
+    int ic3[3] = {0,0,0};
+    in.child(l+1,ic3,ic3+1,ic3+2);
+    for (int axis=0; axis<3; axis++) {
+      x3[axis] = (x3[axis] << 1) | ic3[axis];
+    }
+  }
+
+  // Position of the Block within its root-level Block's segment of
+  // the curve
+  const int bits_sub = rank_*level;
+  const unsigned long long key = sfc_key(x3,rank_,bits_+level,hilbert_);
+  const unsigned long long key_sub = key & ((1ULL << bits_sub) - 1);
+
+  const int nb = nx_*ny_*nz_;
+  const int ib = iax + nx_*(iay + ny_*iaz);
+
+  const double position =
+    (root_order_[ib] + std::ldexp(double(key_sub),-bits_sub)) / nb;
+
+  return std::min(int(position*CkNumPes()),CkNumPes()-1);
+}
+
+//----------------------------------------------------------------------
+
+unsigned long long MappingSfc::sfc_key
+(const int x3[3], int rank, int bits, bool hilbert)
+{
+  unsigned int x[3] = {unsigned(x3[0]),unsigned(x3[1]),unsigned(x3[2])};
+
+  if (hilbert && bits > 0) {
+
+    // Convert coordinates to the "transposed" Hilbert index (Skilling,
+    // "Programming the Hilbert curve", AIP Conf. Proc. 707, 2004).
+    // Bit q of the result depends only on bits >= q of the input, so
+    // keys of coarser cells are prefixes of keys of finer cells.
+
+    const unsigned int m = 1u << (bits-1);
+
+    // inverse undo
+    for (unsigned int q=m; q>1; q>>=1) {
+      const unsigned int p = q - 1;
+      for (int i=0; i<rank; i++) {
+        if (x[i] & q) {
+          x[0] ^= p;
+        } else {
+          const unsigned int t = (x[0] ^ x[i]) & p;
+          x[0] ^= t;
+          x[i] ^= t;
+        }
+      }
+    }
+
+    // Gray encode
+    for (int i=1; i<rank; i++) x[i] ^= x[i-1];
+    unsigned int t = 0;
+    for (unsigned int q=m; q>1; q>>=1) {
+      if (x[rank-1] & q) t ^= q - 1;
+    }
+    for (int i=0; i<rank; i++) x[i] ^= t;
+  }
+
+  // interleave bits, most significant first
+
+  unsigned long long key = 0;
+  for (int b=bits-1; b>=0; b--) {
+    for (int i=0; i<rank; i++) {
+      key = (key << 1) | ((x[i] >> b) & 1);
+    }
+  }
+  return key;
+}
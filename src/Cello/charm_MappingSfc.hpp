@@ -0,0 +1,84 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     charm_MappingSfc.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Parallel] Declaration of the MappingSfc class
+
+#ifndef CHARM_MAPPING_SFC_HPP
+#define CHARM_MAPPING_SFC_HPP
+
+#include "cello.hpp"
+#include "simulation.decl.h"
+
+class MappingSfc: public CkArrayMap {
+
+  /// @class    MappingSfc
+  /// @ingroup  Charm
+  /// @brief    [\ref Parallel] Class for mapping Blocks to processors
+  ///           along a space-filling curve
+  ///
+  /// Each refinement level is divided among processes into contiguous
+  /// segments of a Morton or Hilbert curve through that level.  Blocks
+  /// in every level are thus spread across all processes, while
+  /// neighboring Blocks, and parents and their children, are kept on
+  /// the same or nearby processes.
+
+public:
+
+  MappingSfc(int nx, int ny, int nz, int rank, bool hilbert);
+
+  int procNum(int, const CkArrayIndex &idx);
+
+  /// CHARM++ migration constructor for PUP::able
+  MappingSfc (CkMigrateMessage *m)
+    : CkArrayMap(m),
+      nx_(0),ny_(0),nz_(0),
+      rank_(0),
+      hilbert_(false),
+      bits_(0),
+      root_order_()
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  inline void pup (PUP::er &p)
+  {
+    TRACEPUP;
+    CkArrayMap::pup(p);
+    // NOTE: change this function whenever attributes change
+    p | nx_;
+    p | ny_;
+    p | nz_;
+    p | rank_;
+    p | hilbert_;
+    p | bits_;
+    p | root_order_;
+  }
+
+  /// Return the position along a Morton or Hilbert curve of the cell
+  /// with the given coordinates in a 2^bits grid.  The leading
+  /// rank*b bits of the key are the key of the enclosing cell in a
+  /// 2^b grid.
+  static unsigned long long sfc_key
+  (const int x3[3], int rank, int bits, bool hilbert);
+
+private:
+
+  /// Number of root-level Blocks along each axis
+  int nx_, ny_, nz_;
+
+  /// Dimensionality of the mesh
+  int rank_;
+
+  /// Whether to use a Hilbert curve instead of a Morton curve
+  bool hilbert_;
+
+  /// Number of bits to represent root-level Block coordinates
+  int bits_;
+
+  /// Position of each root-level Block along the curve
+  std::vector<int> root_order_;
+
+};
+
+#endif /* CHARM_MAPPING_SFC_HPP */
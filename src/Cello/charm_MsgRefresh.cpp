@@ -19,7 +19,7 @@ MsgRefresh::MsgRefresh()
     : CMessage_MsgRefresh(),
       is_local_(true),
       id_refresh_(-1),
-      data_msg_(nullptr),
+      data_msg_list_(),
       buffer_(nullptr)
 {
   ++counter[cello::index_static()];
@@ -30,8 +30,11 @@ MsgRefresh::MsgRefresh()
 MsgRefresh::~MsgRefresh()
 {
   --counter[cello::index_static()];
-  delete data_msg_;
-  data_msg_ = nullptr;
+  for (size_t i=0; i<data_msg_list_.size(); i++) {
+    delete data_msg_list_[i];
+    data_msg_list_[i] = nullptr;
+  }
+  data_msg_list_.clear();
   CkFreeMsg (buffer_);
   buffer_=nullptr;
 }
@@ -40,30 +43,49 @@ MsgRefresh::~MsgRefresh()
 
 void MsgRefresh::set_data_msg  (DataMsg * data_msg) 
 {
-  if (data_msg_) {
-    WARNING ("MsgRefresh::set_data_msg()",
-	     "overwriting existing data_msg_");
-    delete data_msg_;
+  if (data_msg_list_.size() == 0) {
+    data_msg_list_.push_back(data_msg);
+  } else {
+    if (data_msg_list_[0]) {
+      WARNING ("MsgRefresh::set_data_msg()",
+               "overwriting existing data_msg_list_[0]");
+      delete data_msg_list_[0];
+    }
+    data_msg_list_[0] = data_msg;
   }
-  data_msg_ = data_msg;
 }
 
 //----------------------------------------------------------------------
 
-void * MsgRefresh::pack (MsgRefresh * msg)
+int MsgRefresh::data_size () const
 {
-  if (msg->buffer_ != nullptr) return msg->buffer_;
-
   int size = 0;
 
-  size += sizeof(int); // id_refresh
-  size += sizeof(int);  // have_data
-  int have_data = (msg->data_msg_ != nullptr);
+  const int n_dm = data_msg_list_.size();
 
-  if (have_data) {
-    // data_msg_
-    size += msg->data_msg_->data_size();
+  size += sizeof(int); // id_refresh
+  size += sizeof(int); // n_dm
+
+  for (int i=0; i<n_dm; i++) {
+    size += sizeof(int);  // have_data
+    DataMsg * data_msg = data_msg_list_[i];
+    if (data_msg != nullptr) {
+      // data_msg_list_[i]
+      size += data_msg->data_size();
+    }
   }
+  return size;
+}
+
+//----------------------------------------------------------------------
+
+void * MsgRefresh::pack (MsgRefresh * msg)
+{
+  if (msg->buffer_ != nullptr) return msg->buffer_;
+
+  const int size = msg->data_size();
+
+  const int n_dm = msg->data_msg_list_.size();
 
   //--------------------------------------------------
   //  2. allocate buffer using CkAllocBuffer()
@@ -83,11 +105,15 @@ void * MsgRefresh::pack (MsgRefresh * msg)
   pc = buffer;
 
   (*pi++) = msg->id_refresh_;
-
-  have_data = (msg->data_msg_ != nullptr);
-  (*pi++) = have_data;
-  if (have_data) {
-    pc = msg->data_msg_->save_data(pc);
+  (*pi++) = n_dm;
+
+  for (int i=0; i<n_dm; i++) {
+    DataMsg * data_msg = msg->data_msg_list_[i];
+    const int have_data = (data_msg != nullptr);
+    (*pi++) = have_data;
+    if (have_data) {
+      pc = data_msg->save_data(pc);
+    }
   }
 
   delete msg;
@@ -128,12 +154,17 @@ MsgRefresh * MsgRefresh::unpack(void * buffer)
 
   msg->id_refresh_ = (*pi++) ;
 
-  int have_data = (*pi++);
-  if (have_data) {
-    msg->data_msg_ = new DataMsg;
-    pc = msg->data_msg_->load_data(pc);
-  } else {
-    msg->data_msg_ = nullptr;
+  const int n_dm = (*pi++);
+  msg->data_msg_list_.resize(n_dm);
+  for (int i=0; i<n_dm; i++) {
+    const int have_data = (*pi++);
+    if (have_data) {
+      DataMsg * data_msg = new DataMsg;
+      pc = data_msg->load_data(pc);
+      msg->data_msg_list_[i] = data_msg;
+    } else {
+      msg->data_msg_list_[i] = nullptr;
+    }
   }
 
   // 3. Save the input buffer for freeing later
@@ -147,9 +178,11 @@ MsgRefresh * MsgRefresh::unpack(void * buffer)
 
 void MsgRefresh::update (Data * data)
 {
-  if (data_msg_ == nullptr) return;
-
-  data_msg_->update(data,is_local_);
+  for (size_t i=0; i<data_msg_list_.size(); i++) {
+    if (data_msg_list_[i] != nullptr) {
+      data_msg_list_[i]->update(data,is_local_);
+    }
+  }
 
   if (!is_local_) {
       CkFreeMsg (buffer_);
@@ -161,9 +194,14 @@ void MsgRefresh::update (Data * data)
 
 void MsgRefresh::print (const char * message)
 {
-  if (data_msg_) {
-    data_msg_->print(message);
-  } else {
-    CkPrintf ("MSG_REFRESH data_msg_ = nil\n");
+  if (data_msg_list_.size() == 0) {
+    CkPrintf ("MSG_REFRESH data_msg_list_ = empty\n");
+  }
+  for (size_t i=0; i<data_msg_list_.size(); i++) {
+    if (data_msg_list_[i]) {
+      data_msg_list_[i]->print(message);
+    } else {
+      CkPrintf ("MSG_REFRESH data_msg_list_[%lu] = nil\n",i);
+    }
   }
 }
@@ -45,6 +45,20 @@ public: // interface
   // Set the DataMsg object
   void set_data_msg (DataMsg * data_msg);
 
+  /// Append another DataMsg object for the same destination Block,
+  /// used to aggregate multiple faces into a single message
+  void add_data_msg (DataMsg * data_msg)
+  { data_msg_list_.push_back(data_msg); }
+
+  /// Return the number of DataMsg objects (including empty ones)
+  /// carried by this message; each corresponds to one expected
+  /// receive in the destination Block's refresh Sync counter
+  int num_data_msg () const
+  { return data_msg_list_.size(); }
+
+  /// Return the size in bytes of the packed message data
+  int data_size () const;
+
   /// Update the Data with data stored in this message
   void update (Data * data);
 
@@ -66,7 +80,8 @@ protected: // attributes
   /// New Refresh object id associated with the message
   int id_refresh_;
 
-  DataMsg * data_msg_;
+  /// DataMsg objects, one per face; entries may be nullptr
+  std::vector<DataMsg *> data_msg_list_;
 
   /// Saved Charm++ buffer for deleting after unpack()
   void * buffer_;
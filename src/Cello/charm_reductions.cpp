@@ -102,6 +102,49 @@ CkReductionMsg * r_reduce_method_debug(int n, CkReductionMsg ** msgs)
 
 //======================================================================
 
+CkReduction::reducerType r_reduce_stopping_type;
+
+void register_reduce_stopping(void)
+{ r_reduce_stopping_type = CkReduction::addReducer(r_reduce_stopping); }
+
+CkReductionMsg * r_reduce_stopping(int n, CkReductionMsg ** msgs)
+{
+  if (n <= 0) return NULL;
+
+  // [ num_sum, dt, stop, sum_1, ..., sum_num_sum ]: minimum of dt and
+  // stop, and sum of the values appended by Methods
+
+  const int num_sum = int(*((long double *) msgs[0]->getData()));
+
+  const int length = 3 + num_sum;
+  std::vector<long double> accum;
+  accum.resize(length);
+
+  accum[0] = num_sum;
+  accum[1] = std::numeric_limits<long double>::max();
+  accum[2] = std::numeric_limits<long double>::max();
+  std::fill_n(accum.begin()+3,num_sum,0.0);
+
+  for (int i=0; i<n; i++) {
+
+    ASSERT2("r_reduce_stopping()",
+	    "CkReductionMsg actual size %d is different from expected %lu",
+	    msgs[i]->getSize(),length*sizeof(long double),
+            ((long unsigned)msgs[i]->getSize() == length*sizeof(long double)));
+
+    long double * values = (long double *) msgs[i]->getData();
+
+    accum[1] = std::min(accum[1],values[1]);
+    accum[2] = std::min(accum[2],values[2]);
+    for (int j=3; j<length; j++) {
+      accum[j] += values[j];
+    }
+  }
+  return CkReductionMsg::buildNew(length*sizeof(long double),&accum[0]);
+}
+
+//======================================================================
+
 CkReduction::reducerType sum_long_double_type;
 
 void register_sum_long_double(void)
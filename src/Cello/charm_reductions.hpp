@@ -18,6 +18,10 @@ extern CkReductionMsg * sum_long_double_n(int n, CkReductionMsg ** msgs);
 extern CkReduction::reducerType sum_long_double_n_type;
 extern void register_sum_long_double_n(void);
 
+extern CkReductionMsg * r_reduce_stopping(int n, CkReductionMsg ** msgs);
+extern CkReduction::reducerType r_reduce_stopping_type;
+extern void register_reduce_stopping(void);
+
 extern CkReductionMsg * r_reduce_method_debug(int n, CkReductionMsg ** msgs);
 extern CkReduction::reducerType r_reduce_method_debug_type;
 extern void register_reduce_method_debug(void);
@@ -6,4 +6,5 @@ extern CProxy_Main proxy_main;
 #include "mesh_Index.hpp"
 #include "simulation.decl.h"
 extern CProxy_Simulation proxy_simulation;
+extern CProxy_IoAdmission proxy_io_admission;
 
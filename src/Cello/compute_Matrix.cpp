@@ -42,6 +42,64 @@ void Matrix::residual (int ir, int ib, int ix, Block * block, int g0) throw()
 
 //----------------------------------------------------------------------
 
+void Matrix::matvec_dot (int iy, int ix, Block * block,
+			 int n, const int * iv, long double * dot,
+			 int g0) throw()
+{
+  matvec(iy,ix,block,g0);
+
+  Field field = block->data()->field();
+
+  int mx,my,mz;
+  int gx,gy,gz;
+  field.dimensions (0,&mx,&my,&mz);
+  field.ghost_depth(0,&gx,&gy,&gz);
+
+  std::vector<void *> v(n);
+  for (int k=0; k<n; k++) {
+    v[k] = (iv[k] >= 0) ? field.values(iv[k]) : nullptr;
+  }
+
+  void * Y = field.values(iy);
+
+  int precision = field.precision(0);
+
+  if      (precision == precision_single)
+    dot_((float *)(Y), n, (float **)(v.data()), dot,
+	 mx,my,mz, gx,gy,gz);
+  else if (precision == precision_double)
+    dot_((double *)(Y), n, (double **)(v.data()), dot,
+	 mx,my,mz, gx,gy,gz);
+  else if (precision == precision_quadruple)
+    dot_((long double *)(Y), n, (long double **)(v.data()), dot,
+	 mx,my,mz, gx,gy,gz);
+  else
+    ERROR1("Matrix::matvec_dot()", "precision %d not recognized", precision);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void Matrix::dot_ (const T * y, int n, T ** v, long double * dot,
+		   int mx, int my, int mz,
+		   int gx, int gy, int gz) throw()
+{
+  for (int k=0; k<n; k++) {
+    long double sum = 0.0;
+    for (int iz=gz; iz<mz-gz; iz++) {
+      for (int iy=gy; iy<my-gy; iy++) {
+	for (int ix=gx; ix<mx-gx; ix++) {
+	  const int i=ix + mx*(iy + my*iz);
+	  sum += v[k] ? y[i]*v[k][i] : y[i];
+	}
+      }
+    }
+    dot[k] += sum;
+  }
+}
+
+//----------------------------------------------------------------------
+
 template <class T>
 void Matrix::residual_ (T * r, T * b,
 			int mx, int my, int mz,
@@ -47,6 +47,17 @@ public: // virtual functions
   virtual void matvec (precision_type precision,
 		       void * y, void * x, int g0=1) throw() = 0;
   
+  /// Apply the matrix Y <-- A*X and add DOT(Y,V[k]) over the Block's
+  /// active zones to dot[k] for each of the n fields V[k] = iv[k].  A
+  /// negative iv[k] adds SUM(Y) instead.  The default calls matvec()
+  /// followed by a separate pass for the dot products
+  ///
+  /// ix must differ from iy.  iv[k] may equal iy (adding DOT(Y,Y)),
+  /// or any other field; overrides must handle this aliasing.
+  virtual void matvec_dot (int iy, int ix, Block * block,
+			   int n, const int * iv, long double * dot,
+			   int g0=1) throw();
+
   /// Extract the diagonal into the given field
   virtual void diagonal (int ix, Block * block, int g0=1) throw() = 0;
 
@@ -63,6 +74,11 @@ protected: // functions
 		 int mx, int my, int mz,
 		 int ig0) throw();
 
+  template<class T>
+  void dot_ (const T * y, int n, T ** v, long double * dot,
+	     int mx, int my, int mz,
+	     int gx, int gy, int gz) throw();
+
 };
 
 #endif /* COMPUTE_MATRIX_HPP */
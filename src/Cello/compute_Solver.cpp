@@ -37,6 +37,7 @@ Solver::Solver (std::string name,
   : PUP::able(),
     name_(name),
     ix_(-1),ib_(-1),
+    ix_batch_(),ib_batch_(),
     monitor_iter_(monitor_iter),
     restart_cycle_(restart_cycle),
     callback_(0),
@@ -61,6 +62,7 @@ Solver::Solver () throw()
   : PUP::able(),
     name_(""),
     ix_(-1),ib_(-1),
+    ix_batch_(),ib_batch_(),
     monitor_iter_(0),
     restart_cycle_(1),
     callback_(0),
@@ -41,6 +41,7 @@ public: // interface
     : PUP::able (m),
       name_(""),
       ix_(-1),ib_(-1),
+      ix_batch_(),ib_batch_(),
       monitor_iter_(0),
       restart_cycle_(1),
       callback_(0),
@@ -68,6 +69,8 @@ public: // interface
     p | name_;
     p | ix_;
     p | ib_;
+    p | ix_batch_;
+    p | ib_batch_;
     p | monitor_iter_;
     p | restart_cycle_;
     p | callback_;
@@ -98,6 +101,12 @@ public: // interface
   void set_field_b (int ib)
   { ib_ = ib;  }
 
+  /// Set Field id's for additional systems A*X[k] = B[k] to be solved
+  /// together with the primary one; must be fewer than num_batch()
+  void set_field_batch (const std::vector<int> & ix,
+                        const std::vector<int> & ib)
+  { ix_batch_ = ix; ib_batch_ = ib; }
+
   void set_min_level (int min_level)
   { min_level_ = min_level; }
 
@@ -171,6 +180,11 @@ public: // virtual functions
   /// Return the type of this solver
   virtual std::string type () const = 0;
 
+  /// Maximum number of right-hand sides solved together, including
+  /// the primary one (1 if the solver does not support batched solves)
+  virtual int num_batch () const
+  { return 1; }
+
   /// Whether Block is active
   virtual bool is_active_(Block * block) const;
 
@@ -218,6 +232,10 @@ protected: // attributes
   
   /// Field id for right-hand side
   int ib_;
+
+  /// Field id's for additional solutions and right-hand sides
+  std::vector<int> ix_batch_;
+  std::vector<int> ib_batch_;
   
   /// How often to write output
   int monitor_iter_;
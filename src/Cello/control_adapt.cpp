@@ -424,6 +424,10 @@ void Block::adapt_refine_()
   }
   cello::simulation()->data_delete_particles(count);
 
+  // Delete flux storage kept between cycles
+
+  data()->flux_data()->deallocate();
+
   adapt_.set_valid(false);
   is_leaf_ = false;
   TRACE_ADAPT("adapt_refine exit",this);
@@ -140,8 +140,8 @@ void Block::compute_end_ ()
   // Push back fields if saving old ones
   data()->field().save_history(time_);
 
-  // delete fluxes
-  data()->flux_data()->deallocate();
+  // release fluxes, keeping storage for the next cycle
+  data()->flux_data()->release();
 
   // Update block cycle and time
   set_cycle (cycle_ + 1);
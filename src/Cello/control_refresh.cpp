@@ -139,14 +139,29 @@ void Block::refresh_wait (int id_refresh, int callback)
     // unpack message data into Block data
     msg->update(data());
 
+    // advance once per face (message may aggregate several faces)
+    const int n = msg->num_data_msg();
     delete msg;
-    sync->advance();
+    for (int i=0; i<n; i++) sync->advance();
   }
 
   // clear the message queue
 
   refresh_msg_list_[id_refresh].resize(0);
 
+  // copy any queued field faces from Blocks on this process
+
+  auto & local_list = refresh_local_list_[id_refresh];
+  for (size_t i=0; i<local_list.size(); i++) {
+    FieldFace * field_face = local_list[i].first;
+    Field field_src (cello::field_descr(),local_list[i].second);
+    Field field_dst = data()->field();
+    field_face->face_to_face(field_src, field_dst);
+    delete field_face;
+    sync->advance();
+  }
+  local_list.resize(0);
+
   // and check if we're finished
 
   refresh_check_done(id_refresh);
@@ -175,6 +190,10 @@ void Block::refresh_check_done (int id_refresh)
             "Refresh %d message list has size %lu instead of 0",
 	    id_refresh,refresh_msg_list_[id_refresh].size(),
 	    (refresh_msg_list_[id_refresh].size() == 0));
+    ASSERT2("Block::refresh_wait()",
+            "Refresh %d local face list has size %lu instead of 0",
+	    id_refresh,refresh_local_list_[id_refresh].size(),
+	    (refresh_local_list_[id_refresh].size() == 0));
 
     // reset sync counter
     sync->reset();
@@ -209,9 +228,12 @@ void Block::p_refresh_recv (MsgRefresh * msg_refresh)
     // unpack message data into Block data if ready
     msg_refresh->update(data());
 
+    // advance once per face (message may aggregate several faces)
+    const int n = msg_refresh->num_data_msg();
+
     delete msg_refresh;
 
-    sync->advance();
+    for (int i=0; i<n; i++) sync->advance();
 
     // check if it's the last message processed
     refresh_check_done(id_refresh);
@@ -227,6 +249,17 @@ void Block::p_refresh_recv (MsgRefresh * msg_refresh)
 
 //----------------------------------------------------------------------
 
+void Block::refresh_send_ (Index index, MsgRefresh * msg_refresh)
+{
+  // record data volume only if used by load balancing
+  if (cello::config()->balance_message_cost > 0.0) {
+    refresh_bytes_sent_ += msg_refresh->data_size();
+  }
+  thisProxy[index].p_refresh_recv (msg_refresh);
+}
+
+//----------------------------------------------------------------------
+
 void Block::refresh_exit (Refresh & refresh)
 {
   CHECK_ID(refresh.id());
@@ -248,6 +281,13 @@ int Block::refresh_load_field_faces_ (Refresh & refresh)
   const int min_face_rank = refresh.min_face_rank();
   const int neighbor_type = refresh.neighbor_type();
 
+  // If aggregating, collect all faces sent to the same neighbor Block
+  // into a single message, sent after all faces have been loaded
+
+  std::map<Index,MsgRefresh *> msg_map;
+  std::map<Index,MsgRefresh *> * p_msg_map =
+    cello::config()->mesh_refresh_aggregate ? &msg_map : nullptr;
+
   if (neighbor_type == neighbor_leaf ||
       neighbor_type == neighbor_tree) {
 
@@ -281,12 +321,12 @@ int Block::refresh_load_field_faces_ (Refresh & refresh)
 
       if (pad == 0) {
         refresh_load_field_face_
-          (refresh,refresh_type,index_neighbor,if3,ic3);
+          (refresh,refresh_type,index_neighbor,if3,ic3,p_msg_map);
         ++count;
       } else {
         if (level_face == level) {
           refresh_load_field_face_
-            (refresh,refresh_type,index_neighbor,if3,ic3);
+            (refresh,refresh_type,index_neighbor,if3,ic3,p_msg_map);
           ++count;
         } else {
           count += refresh_load_coarse_face_
@@ -294,7 +334,7 @@ int Block::refresh_load_field_faces_ (Refresh & refresh)
         }
         if (level_face < level) {
           refresh_load_field_face_
-            (refresh,refresh_type,index_neighbor,if3,ic3);
+            (refresh,refresh_type,index_neighbor,if3,ic3,p_msg_map);
         } else if (level_face > level) {
           count ++;
         }
@@ -317,13 +357,21 @@ int Block::refresh_load_field_faces_ (Refresh & refresh)
       if ( ! is_leaf() || face_level(if3) >= level()) {
 	Index index_face = it_face.index();
 	int ic3[3] = {0,0,0};
-	refresh_load_field_face_ (refresh,refresh_same,index_face,if3,ic3);
+	refresh_load_field_face_
+          (refresh,refresh_same,index_face,if3,ic3,p_msg_map);
 	++count;
 
       }
 
     }
   }
+
+  // Send aggregated messages, if any
+
+  for (auto it : msg_map) {
+    refresh_send_ (it.first,it.second);
+  }
+
   return count;
 }
 
@@ -331,12 +379,9 @@ int Block::refresh_load_field_faces_ (Refresh & refresh)
 
 void Block::refresh_load_field_face_
 ( Refresh & refresh,  int refresh_type,
-  Index index_neighbor,  int if3[3], int ic3[3])
+  Index index_neighbor,  int if3[3], int ic3[3],
+  std::map<Index,MsgRefresh *> * msg_map)
 {
-  // create refresh message
-
-  MsgRefresh * msg_refresh = new MsgRefresh;
-
   // create field face
   if (refresh_type == refresh_coarse) {
     index_.child(index_.level(),ic3,ic3+1,ic3+2);
@@ -345,18 +390,83 @@ void Block::refresh_load_field_face_
   FieldFace * field_face = create_face
     (if3, ic3, g3, refresh_type, &refresh,false);
 
+  // copy directly if neighbor is on the same process
+
+  if (cello::config()->mesh_refresh_local) {
+    Block * block_neighbor = cello::hierarchy()->local_block(index_neighbor);
+    if (block_neighbor != nullptr) {
+      refresh_local_face_ (refresh,block_neighbor,field_face);
+      return;
+    }
+  }
+
   // create data message
   DataMsg * data_msg = new DataMsg;
   // initialize data message
   data_msg -> set_field_face (field_face,true);
   data_msg -> set_field_data (data()->field_data(),false);
 
-  // initialize refresh message
-  msg_refresh->set_refresh_id (refresh.id());
-  msg_refresh->set_data_msg (data_msg);
+  if (msg_map == nullptr) {
+
+    // send face in its own refresh message
+
+    MsgRefresh * msg_refresh = new MsgRefresh;
+    msg_refresh->set_refresh_id (refresh.id());
+    msg_refresh->set_data_msg (data_msg);
+
+    refresh_send_ (index_neighbor,msg_refresh);
 
-  thisProxy[index_neighbor].p_refresh_recv (msg_refresh);
+  } else {
+
+    // append face to the neighbor's aggregated refresh message
 
+    auto it = msg_map->find(index_neighbor);
+    if (it == msg_map->end()) {
+      MsgRefresh * msg_refresh = new MsgRefresh;
+      msg_refresh->set_refresh_id (refresh.id());
+      msg_refresh->set_data_msg (data_msg);
+      (*msg_map)[index_neighbor] = msg_refresh;
+    } else {
+      it->second->add_data_msg (data_msg);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Block::refresh_local_face_
+(Refresh & refresh, Block * block_neighbor, FieldFace * field_face)
+{
+  const int id_refresh = refresh.id();
+  Sync * sync_neighbor = block_neighbor->sync_(id_refresh);
+
+  if (sync_neighbor->state() == RefreshState::READY) {
+
+    // neighbor is waiting for faces: copy into its ghost zones now
+
+    Field field_src = data()->field();
+    Field field_dst = block_neighbor->data()->field();
+    field_face->face_to_face(field_src, field_dst);
+    delete field_face;
+
+    sync_neighbor->advance();
+
+    // if this was the neighbor's last face, let it complete the
+    // refresh in its own entry method rather than recursing into
+    // its callback from here
+
+    if (sync_neighbor->is_done()) {
+      thisProxy[block_neighbor->index()].p_refresh_check_done(id_refresh);
+    }
+
+  } else {
+
+    // neighbor not ready: queue face for neighbor's refresh_wait()
+
+    block_neighbor->refresh_local_list_[id_refresh].push_back
+      (std::pair<FieldFace *,FieldData *>(field_face,data()->field_data()));
+
+  }
 }
 
 //----------------------------------------------------------------------
@@ -745,7 +855,7 @@ void Block::refresh_coarse_send_
   msg_refresh->set_refresh_id (id_refresh);
   msg_refresh->set_data_msg (data_msg);
 
-  thisProxy[index_neighbor].p_refresh_recv (msg_refresh);
+  refresh_send_ (index_neighbor,msg_refresh);
 }
 
 //----------------------------------------------------------------------
@@ -968,7 +1078,7 @@ void Block::particle_send_
       msg_refresh->set_data_msg (data_msg);
       msg_refresh->set_refresh_id (id_refresh);
 
-      thisProxy[index].p_refresh_recv (msg_refresh);
+      refresh_send_ (index,msg_refresh);
 
     } else if (p_data) {
 
@@ -976,7 +1086,7 @@ void Block::particle_send_
       msg_refresh->set_data_msg (nullptr);
       msg_refresh->set_refresh_id (id_refresh);
 
-      thisProxy[index].p_refresh_recv (msg_refresh);
+      refresh_send_ (index,msg_refresh);
 
       // assert ParticleData object exits but has no particles
       delete p_data;
@@ -1499,6 +1609,6 @@ void Block::refresh_load_flux_face_
   msg_refresh->set_data_msg (data_msg);
   msg_refresh->set_refresh_id (id_refresh);
 
-  thisProxy[index_neighbor].p_refresh_recv (msg_refresh);
+  refresh_send_ (index_neighbor,msg_refresh);
 
 }
@@ -21,6 +21,8 @@
 #include "charm_simulation.hpp"
 #include "charm_mesh.hpp"
 
+#include <algorithm>
+
 // #define DEBUG_STOPPING
 
 #ifdef DEBUG_STOPPING
@@ -55,14 +57,23 @@ void Block::stopping_begin_()
   bool stopping_reduce = stopping_interval ? 
     ((cycle_ % stopping_interval) == 0) : false;
 
-  if (stopping_reduce || dt_==0.0) {
+  // Count values Methods append to the reduction this cycle; if any,
+  // the reduction is required regardless of the stopping interval
 
-    // Compute local dt
+  Problem * problem = simulation->problem();
 
-    Problem * problem = simulation->problem();
+  int num_sum = 0;
+  int index = 0;
+  Method * method;
+  while ((method = problem->method(index++))) {
+    num_sum += method->num_stopping_sum(this);
+  }
 
-    int index = 0;
-    Method * method;
+  if (stopping_reduce || dt_==0.0 || num_sum > 0) {
+
+    // Compute local dt
+
+    index = 0;
     double dt_block = std::numeric_limits<double>::max();
     while ((method = problem->method(index++))) {
       dt_block = std::min(dt_block,method->timestep(this));
@@ -89,12 +100,26 @@ void Block::stopping_begin_()
 
     int stop_block = stopping->complete(cycle_,time_);
 
-    // Reduce to find Block array minimum dt and stopping criteria
+    // Reduce to find Block array minimum dt and stopping criteria,
+    // and sum of Method values
 
-    double min_reduce[2];
+    const int n = 3 + num_sum;
+    long double * reduce = new long double [n];
 
-    min_reduce[0] = dt_block;
-    min_reduce[1] = stop_block ? 1.0 : 0.0;
+    reduce[0] = num_sum;
+    reduce[1] = dt_block;
+    reduce[2] = stop_block ? 1.0 : 0.0;
+
+    long double * sum = reduce + 3;
+    index = 0;
+    while ((method = problem->method(index++))) {
+      const int num_method = method->num_stopping_sum(this);
+      if (num_method > 0) {
+        std::fill_n(sum,num_method,0.0);
+        method->stopping_sum(this,sum);
+        sum += num_method;
+      }
+    }
 
     CkCallback callback (CkIndex_Block::r_stopping_compute_timestep(NULL),
 			 thisProxy);
@@ -103,7 +128,9 @@ void Block::stopping_begin_()
     CkPrintf ("%s %s:%d DEBUG_CONTRIBUTE\n",
 	      name().c_str(),__FILE__,__LINE__); fflush(stdout);
 #endif    
-    contribute(2*sizeof(double), min_reduce, CkReduction::min_double, callback);
+    contribute(n*sizeof(long double), reduce, r_reduce_stopping_type, callback);
+
+    delete [] reduce;
 
   } else {
 
@@ -123,15 +150,36 @@ void Block::r_stopping_compute_timestep(CkReductionMsg * msg)
   
   ++age_;
 
-  double * min_reduce = (double * )msg->getData();
+  long double * reduce = (long double * )msg->getData();
 
-  dt_   = min_reduce[0];
-  stop_ = min_reduce[1] == 1.0 ? true : false;
-
-  delete msg;
+  const int num_sum = int(reduce[0]);
+  dt_   = reduce[1];
+  stop_ = reduce[2] == 1.0 ? true : false;
 
   Simulation * simulation = cello::simulation();
 
+  // Return summed values to the Methods that appended them
+
+  if (num_sum > 0) {
+    Problem * problem = simulation->problem();
+    const long double * sum = reduce + 3;
+    int index = 0;
+    Method * method;
+    while ((method = problem->method(index++))) {
+      const int num_method = method->num_stopping_sum(this);
+      if (num_method > 0) {
+        method->stopping_reduced(this,sum);
+        sum += num_method;
+      }
+    }
+    ASSERT2 ("Block::r_stopping_compute_timestep()",
+             "Methods received %d summed values but %d were reduced",
+             int(sum - (reduce + 3)), num_sum,
+             (sum == reduce + 3 + num_sum));
+  }
+
+  delete msg;
+
   dt_ *= Method::courant_global;
   
   set_dt   (dt_);
@@ -192,12 +240,24 @@ void Block::stopping_balance_()
     if (index_.is_root())
       cello::monitor()->print ("Balance","starting load balance step");
 
-    CkCallback callback = CkCallback
-      (CkIndex_Block::r_stopping_load_balance(nullptr),
-       proxy_array());
-    
     adapt_ready_ = true;
-    contribute(callback);
+
+    // Delete flux storage kept between cycles before migrating
+
+    data()->flux_data()->deallocate();
+
+    if (cello::config()->balance_strategy == "morton") {
+
+      balance_morton_start_();
+
+    } else {
+
+      CkCallback callback = CkCallback
+        (CkIndex_Block::r_stopping_load_balance(nullptr),
+         proxy_array());
+
+      contribute(callback);
+    }
 
   } else {
 
@@ -241,6 +301,198 @@ void Block::ResumeFromSync()
 
 }
 
+//======================================================================
+// MORTON-ORDER LOAD BALANCING
+//======================================================================
+
+namespace {
+
+  /// Cost of a Block as contributed to the root Block
+  struct BalanceCost {
+    int v3[3];      // Block Index values
+    int ip;         // current process
+    double cost;    // measured cost
+    double bytes;   // refresh data sent
+  };
+
+  /// Position of a Block in the depth-first Morton ordering used by
+  /// MethodOrderMorton: root-level octrees in array order, children
+  /// in x-fastest order, and parents before their children
+  struct MortonKey {
+    int root;
+    unsigned long long path;
+    int level;
+    bool operator < (const MortonKey & key) const
+    {
+      if (root != key.root) return root < key.root;
+      if (path != key.path) return path < key.path;
+      return level < key.level;
+    }
+  };
+
+  MortonKey morton_key (Index index)
+  {
+    int na3[3];
+    cello::hierarchy()->root_blocks(na3,na3+1,na3+2);
+    int ia3[3];
+    index.array(ia3,ia3+1,ia3+2);
+
+    MortonKey key;
+    key.root  = ia3[0] + na3[0]*(ia3[1] + na3[1]*ia3[2]);
+    key.path  = 0;
+    key.level = index.level();
+    for (int level=1; level<=key.level; level++) {
+      int ic3[3];
+      index.child(level,ic3,ic3+1,ic3+2);
+      const unsigned long long ic = ic3[0] + 2*(ic3[1] + 2*ic3[2]);
+      key.path |= ic << (3*(INDEX_BITS_TREE - level));
+    }
+    return key;
+  }
+}
+
+//----------------------------------------------------------------------
+
+double Block::balance_cost_() const
+{
+  double cost = 0.0;
+  for (size_t i=0; i<method_time_.size(); i++) {
+    cost += method_time_[i];
+  }
+  return cost + cello::config()->balance_message_cost * refresh_bytes_sent_;
+}
+
+//----------------------------------------------------------------------
+
+void Block::balance_morton_start_()
+{
+  BalanceCost balance_cost;
+  index_.values(balance_cost.v3);
+  balance_cost.ip    = CkMyPe();
+  balance_cost.cost  = balance_cost_();
+  balance_cost.bytes = refresh_bytes_sent_;
+
+  CkCallback callback
+    (CkIndex_Block::r_balance_morton_gather(nullptr),
+     thisProxy[Index(0,0,0)]);
+
+  contribute(sizeof(BalanceCost),&balance_cost,CkReduction::concat,callback);
+}
+
+//----------------------------------------------------------------------
+
+void Block::r_balance_morton_gather(CkReductionMsg * msg)
+{
+  // [ Called on root Block only ]
+
+  const int nb = msg->getSize() / sizeof(BalanceCost);
+  const BalanceCost * balance_cost = (const BalanceCost *) msg->getData();
+
+  // sort Blocks by Morton order
+
+  std::vector< std::pair<MortonKey,int> > order (nb);
+  double cost_total = 0.0;
+  double bytes_total = 0.0;
+  for (int ib=0; ib<nb; ib++) {
+    Index index;
+    index.set_values(balance_cost[ib].v3);
+    order[ib] = std::make_pair(morton_key(index),ib);
+    cost_total += balance_cost[ib].cost;
+    bytes_total += balance_cost[ib].bytes;
+  }
+  std::sort(order.begin(),order.end());
+
+  // assign each Block to the process containing the midpoint of its
+  // cost along the ordering, using Block counts if no costs measured
+
+  const int np = CkNumPes();
+  const bool use_count = (cost_total <= 0.0);
+  if (use_count) cost_total = nb;
+
+  std::vector<double> cost_old (np,0.0);
+  std::vector<double> cost_new (np,0.0);
+  std::vector<int> v3_first;
+  double cost_sum = 0.0;
+  int ip_last = -1;
+  for (int k=0; k<nb; k++) {
+    const BalanceCost & block_cost = balance_cost[order[k].second];
+    const double cost = use_count ? 1.0 : block_cost.cost;
+    const int ip = std::min
+      (np-1, int(np*(cost_sum + 0.5*cost)/cost_total));
+    cost_sum += cost;
+    cost_old[block_cost.ip] += cost;
+    cost_new[ip]            += cost;
+    // first Block of each process, repeated for skipped processes
+    for (; ip_last<ip; ip_last++) {
+      v3_first.push_back(block_cost.v3[0]);
+      v3_first.push_back(block_cost.v3[1]);
+      v3_first.push_back(block_cost.v3[2]);
+    }
+  }
+
+  delete msg;
+
+  const double cost_avg = cost_total / np;
+  cello::monitor()->print
+    ("Balance","morton %d blocks  max/avg cost %.3f -> %.3f  "
+     "refresh %.3g bytes",
+     nb,
+     *std::max_element(cost_old.begin(),cost_old.end()) / cost_avg,
+     *std::max_element(cost_new.begin(),cost_new.end()) / cost_avg,
+     bytes_total);
+
+  const int n = v3_first.size() / 3;
+  thisProxy.p_balance_morton_assign(n,v3_first.data());
+}
+
+//----------------------------------------------------------------------
+
+void Block::p_balance_morton_assign(int n, int v3[])
+{
+  // process is the number of first Blocks not after this one, less
+  // one: binary search since first Blocks are in Morton order
+  const MortonKey key = morton_key(index_);
+  int lo = 0;
+  int hi = n;
+  while (lo < hi) {
+    const int mid = (lo + hi) / 2;
+    Index index;
+    index.set_values(v3+3*mid);
+    if (key < morton_key(index)) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  const int ip = lo - 1;
+
+  // restart cost measurements
+  std::fill(method_time_.begin(),method_time_.end(),0.0);
+  refresh_bytes_sent_ = 0;
+
+  if (ip != CkMyPe()) {
+    balance_migrating_ = true;
+    migrateMe(ip);
+  } else {
+    CkCallback callback
+      (CkIndex_Block::r_balance_morton_done(nullptr), proxy_array());
+    contribute(callback);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Block::ckJustMigrated()
+{
+  CBase_Block::ckJustMigrated();
+  if (balance_migrating_) {
+    balance_migrating_ = false;
+    CkCallback callback
+      (CkIndex_Block::r_balance_morton_done(nullptr), proxy_array());
+    contribute(callback);
+  }
+}
+
 //----------------------------------------------------------------------
 
 void Block::exit_()
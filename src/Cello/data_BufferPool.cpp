@@ -0,0 +1,96 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     data_BufferPool.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Implementation of the BufferPool class
+
+#include "cello.hpp"
+#include "data.hpp"
+
+//----------------------------------------------------------------------
+
+long BufferPool::counter_hit[CONFIG_NODE_SIZE] = {0};
+long BufferPool::counter_miss[CONFIG_NODE_SIZE] = {0};
+
+std::vector<char *>
+BufferPool::pool_[CONFIG_NODE_SIZE][BufferPool::num_class_];
+std::size_t BufferPool::bytes_[CONFIG_NODE_SIZE] = {0};
+
+//----------------------------------------------------------------------
+
+void * BufferPool::allocate (std::size_t n)
+{
+  const int in = cello::index_static();
+  const int c = size_class_(n);
+
+  if (c < 0) {
+    // too large to pool
+    ++counter_miss[in];
+    return new char [n];
+  }
+
+  std::vector<char *> & pool = pool_[in][c];
+
+  if (pool.size() > 0) {
+    ++counter_hit[in];
+    char * buffer = pool.back();
+    pool.pop_back();
+    bytes_[in] -= std::size_t(1) << c;
+    return buffer;
+  } else {
+    ++counter_miss[in];
+    return new char [std::size_t(1) << c];
+  }
+}
+
+//----------------------------------------------------------------------
+
+void BufferPool::deallocate (void * buffer, std::size_t n)
+{
+  if (buffer == nullptr) return;
+
+  const int in = cello::index_static();
+  const int c = size_class_(n);
+
+  if (c < 0 || bytes_[in] + (std::size_t(1) << c) > max_bytes()) {
+    delete [] (char *) buffer;
+  } else {
+    pool_[in][c].push_back((char *)buffer);
+    bytes_[in] += std::size_t(1) << c;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void BufferPool::clear ()
+{
+  const int in = cello::index_static();
+  for (int c=0; c<num_class_; c++) {
+    std::vector<char *> & pool = pool_[in][c];
+    for (size_t i=0; i<pool.size(); i++) {
+      delete [] pool[i];
+    }
+    pool.clear();
+  }
+  bytes_[in] = 0;
+}
+
+//----------------------------------------------------------------------
+
+int BufferPool::num_buffers ()
+{
+  const int in = cello::index_static();
+  int count = 0;
+  for (int c=0; c<num_class_; c++) {
+    count += pool_[in][c].size();
+  }
+  return count;
+}
+
+//----------------------------------------------------------------------
+
+std::size_t BufferPool::num_bytes ()
+{
+  return bytes_[cello::index_static()];
+}
@@ -0,0 +1,79 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     data_BufferPool.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Data] Declaration of the BufferPool class
+///
+/// Per-process pool of reusable memory buffers, grouped into
+/// power-of-two size classes.  Used for the short-lived objects and
+/// arrays created for every face on every refresh (FieldFace,
+/// DataMsg, and packed face arrays), whose sizes repeat from cycle
+/// to cycle.  Buffers released on one process are kept in that
+/// process's pool, so no locking is required in SMP mode.
+
+#ifndef DATA_BUFFER_POOL_HPP
+#define DATA_BUFFER_POOL_HPP
+
+class BufferPool {
+
+  /// @class    BufferPool
+  /// @ingroup  Data
+  /// @brief    [\ref Data] Per-process pool of reusable memory buffers
+
+public: // interface
+
+  /// Number of allocations satisfied from the pool
+  static long counter_hit[CONFIG_NODE_SIZE];
+
+  /// Number of allocations requiring a new buffer
+  static long counter_miss[CONFIG_NODE_SIZE];
+
+  /// Return a buffer of at least n bytes
+  static void * allocate (std::size_t n);
+
+  /// Return a buffer of n bytes, as passed to allocate(), to the pool
+  static void deallocate (void * buffer, std::size_t n);
+
+  /// Free all buffers currently held in this process's pool
+  static void clear ();
+
+  /// Return the number of buffers currently held in this process's pool
+  static int num_buffers ();
+
+  /// Return the number of bytes currently held in this process's pool
+  static std::size_t num_bytes ();
+
+  /// Maximum number of bytes of free buffers kept per process
+  static std::size_t max_bytes ()
+  { return std::size_t(1) << max_bytes_log2_; }
+
+private: // functions
+
+  /// Return the size class of n bytes, or -1 if too large to pool
+  static int size_class_ (std::size_t n)
+  {
+    int c = min_class_;
+    while (c < max_class_ && (std::size_t(1) << c) < n) ++c;
+    return ((std::size_t(1) << c) < n) ? -1 : c;
+  }
+
+private: // attributes
+
+  /// log2 of smallest and largest pooled buffer sizes
+  enum { min_class_ = 4, max_class_ = 24, num_class_ = max_class_ + 1 };
+
+  /// log2 of the maximum number of bytes of free buffers kept per
+  /// process, so that a transient peak in the number of faces does
+  /// not leave field-sized buffers held indefinitely
+  enum { max_bytes_log2_ = 26 };
+
+  /// Free buffers by process index and size class
+  static std::vector<char *> pool_[CONFIG_NODE_SIZE][num_class_];
+
+  /// Total size of free buffers by process index
+  static std::size_t bytes_[CONFIG_NODE_SIZE];
+
+};
+
+#endif /* DATA_BUFFER_POOL_HPP */
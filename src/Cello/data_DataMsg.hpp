@@ -73,6 +73,14 @@ public: // interface
     coarse_field_list_dst_.clear();
   }
 
+  /// Allocate DataMsg objects from the per-process BufferPool
+  static void * operator new (std::size_t n)
+  { return BufferPool::allocate(n); }
+
+  /// Return DataMsg objects to the per-process BufferPool
+  static void operator delete (void * p, std::size_t n)
+  { BufferPool::deallocate(p,n); }
+
   /// Copy constructor
   DataMsg(const DataMsg & data_msg) throw()
   {
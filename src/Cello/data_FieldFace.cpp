@@ -8,7 +8,6 @@
 #include "cello.hpp"
 #include "data.hpp"
 
-#define FORTRAN_STORE
 // #define DEBUG_NEW_BOX
 // #define TRACE_FIELD_FACE
 // #define TRACE_PROLONG
@@ -93,15 +92,6 @@ void mutex_init_field_face()
 
 long FieldFace::counter[CONFIG_NODE_SIZE] = {0};
 
-#define FORTRAN_NAME(NAME) NAME##_
-
-extern "C" void FORTRAN_NAME(field_face_store_4)
-  (float * field, float * array, int * m3, int * n3, int * accumulate);
-extern "C" void FORTRAN_NAME(field_face_store_8)
-  (double * field, double * array, int * m3, int * n3, int * accumulate);
-extern "C" void FORTRAN_NAME(field_face_store_16)
-  (long double * field, long double * array, int * m3, int * n3, int * accumulate);
-
 enum enum_op_type {
   op_unknown,
   op_load,
@@ -218,7 +208,7 @@ void FieldFace::face_to_array ( Field field, int * n, char ** array) throw()
 	 refresh_->any_fields());
 
   *n = num_bytes_array(field);
-  *array = new char [*n];
+  *array = (char *) BufferPool::allocate(*n);
 
   ASSERT("FieldFace::face_to_array()",
 	 "array size must be > 0",
@@ -581,26 +571,9 @@ int FieldFace::num_bytes_array(Field field) throw()
     precision_type precision = field.precision(index_field);
     int bytes_per_element = cello::sizeof_precision (precision);
 
-    int m3[3],n3[3],g3[3],c3[3];
-
-    field.dimensions (index_field,m3,m3+1,m3+2);
-    field.size                   (n3,n3+1,n3+2);
-    field.ghost_depth(index_field,g3,g3+1,g3+2);
-    field.centering  (index_field,c3,c3+1,c3+2);
-
-    const bool accumulate = refresh_->accumulate(i_f);
-
-    Box box (rank_,n3,g3);
-    set_box_(&box);
-    box.set_centering(c3);
-
-    box_adjust_accumulate_(&box,accumulate,g3);
+    int i3[3],n3[3];
+    array_region (field,i_f,i3,n3);
 
-    bool lpad;
-    int i3[3];
-    TRACE_ONCE;
-    box.get_start_size(i3,n3,BlockType::send,BlockType::send,lpad=true);
-    
 #ifdef DEBUG_NEW_BOX
     if (i_f == 0) {
       CkPrintf ("DEBUG_NEW_BOX num_bytes_array() %d %d %d\n",i3[0],i3[1],i3[2]);
@@ -621,6 +594,32 @@ int FieldFace::num_bytes_array(Field field) throw()
 
 //----------------------------------------------------------------------
 
+void FieldFace::array_region
+(Field field, int i_f, int i3[3], int n3[3]) throw()
+{
+  const int index_field = refresh_->field_list_src()[i_f];
+
+  int g3[3],c3[3];
+
+  field.size                   (n3,n3+1,n3+2);
+  field.ghost_depth(index_field,g3,g3+1,g3+2);
+  field.centering  (index_field,c3,c3+1,c3+2);
+
+  const bool accumulate = refresh_->accumulate(i_f);
+
+  Box box (rank_,n3,g3);
+  set_box_(&box);
+  box.set_centering(c3);
+
+  box_adjust_accumulate_(&box,accumulate,g3);
+
+  bool lpad;
+  TRACE_ONCE;
+  box.get_start_size(i3,n3,BlockType::send,BlockType::send,lpad=true);
+}
+
+//----------------------------------------------------------------------
+
 int FieldFace::data_size () const
 {
   int count = 0;
@@ -689,6 +688,81 @@ char * FieldFace::load_data (char * buffer)
 
 //======================================================================
 
+/// Copy or add a box of values between arrays, where the x-extent NX
+/// is known at compile time (x-face ghost depths 1 to 4)
+template<class T, int NX>
+static void copy_box_fixed_
+(      T * __restrict__ vd, int mdx, int mdy,
+ const T * __restrict__ vs, int msx, int msy,
+ int ny, int nz, bool accumulate)
+{
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      T * d       = vd + mdx*(iy + mdy*iz);
+      const T * s = vs + msx*(iy + msy*iz);
+      if (accumulate) {
+        for (int ix=0; ix<NX; ix++) d[ix] += s[ix];
+      } else {
+        for (int ix=0; ix<NX; ix++) d[ix] = s[ix];
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+/// Copy or add an n3 box of values from vs with strides (msx,msy) to
+/// vd with strides (mdx,mdy)
+template<class T>
+static void copy_box_
+(      T * __restrict__ vd, int mdx, int mdy,
+ const T * __restrict__ vs, int msx, int msy,
+ const int n3[3], bool accumulate)
+{
+  const int nx = n3[0];
+  const int ny = n3[1];
+  const int nz = n3[2];
+
+  if (nx <= 0 || ny <= 0 || nz <= 0) return;
+
+  switch (nx) {
+  case 1: copy_box_fixed_<T,1> (vd,mdx,mdy,vs,msx,msy,ny,nz,accumulate); return;
+  case 2: copy_box_fixed_<T,2> (vd,mdx,mdy,vs,msx,msy,ny,nz,accumulate); return;
+  case 3: copy_box_fixed_<T,3> (vd,mdx,mdy,vs,msx,msy,ny,nz,accumulate); return;
+  case 4: copy_box_fixed_<T,4> (vd,mdx,mdy,vs,msx,msy,ny,nz,accumulate); return;
+  }
+
+  if (accumulate) {
+    // add values
+    for (int iz=0; iz<nz; iz++) {
+      for (int iy=0; iy<ny; iy++) {
+        T * __restrict__ d       = vd + mdx*(iy + mdy*iz);
+        const T * __restrict__ s = vs + msx*(iy + msy*iz);
+#pragma omp simd
+        for (int ix=0; ix<nx; ix++) d[ix] += s[ix];
+      }
+    }
+  } else if (nx == mdx && nx == msx && ny == mdy && ny == msy) {
+    // whole box is contiguous in both arrays
+    memcpy (vd, vs, sizeof(T)*nx*ny*nz);
+  } else if (nx == mdx && nx == msx) {
+    // xy-planes are contiguous in both arrays
+    for (int iz=0; iz<nz; iz++) {
+      memcpy (vd + mdx*mdy*iz, vs + msx*msy*iz, sizeof(T)*nx*ny);
+    }
+  } else {
+    // x-rows are contiguous in both arrays
+    for (int iz=0; iz<nz; iz++) {
+      for (int iy=0; iy<ny; iy++) {
+        memcpy (vd + mdx*(iy + mdy*iz),
+                     vs + msx*(iy + msy*iz), sizeof(T)*nx);
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
 template<class T>
 size_t FieldFace::load_
 ( T * array_face, const T * field_face, 
@@ -696,20 +770,11 @@ size_t FieldFace::load_
 {
   // NOTE: don't check accumulate since loading array; accumulate
   // is handled in corresponding store_() at the receiving end
-  // add values
-
-  for (int iz=0; iz <n3[2]; iz++)  {
-    int kz = iz+i3[2];
-    for (int iy=0; iy < n3[1]; iy++) {
-      int ky = iy+i3[1];
-      for (int ix=0; ix < n3[0]; ix++) {
-	int kx = ix+i3[0];
-	int index_array = ix +   n3[0]*(iy +   n3[1] * iz);
-	int index_field = kx + m3[0]*(ky + m3[1] * kz);
-	array_face[index_array] = field_face[index_field];
-      }
-    }
-  }
+
+  const int i0 = i3[0] + m3[0]*(i3[1] + m3[1]*i3[2]);
+
+  copy_box_ (array_face, n3[0], n3[1],
+             field_face + i0, m3[0], m3[1], n3, false);
 
   return (sizeof(T) * n3[0] * n3[1] * n3[2]);
 
@@ -721,82 +786,10 @@ template<class T> size_t FieldFace::store_
 ( T * ghost, const T * array,
   int m3[3], int n3[3],int i3[3], bool accumulate) throw()
 {
+  const int i0 = i3[0] + m3[0]*(i3[1] + m3[1]*i3[2]);
 
-#ifdef FORTRAN_STORE
-  const bool use_fortran_store = true;
-#else  
-  const bool use_fortran_store = false;
-#endif
-
-  // This is to get around a bug on SDSC Comet where this function
-  // crashes with -O3 (See bugzilla report #90)
-
-  union {
-    float *       ghost_4;
-    double *      ghost_8;
-    long double * ghost_16;
-  };
-  union {
-    float *       array_4;
-    double *      array_8;
-    long double * array_16;
-  };
-
-  ghost_4 = (float *) ghost;
-  array_4 = (float *) array;
-  
-  int im = i3[0] + m3[0]*(i3[1] + m3[1]*i3[2]);
-
-  int iaccumulate = accumulate ? 1 : 0;
-
-  if (use_fortran_store &&
-      (sizeof(T) != sizeof(long double)) ) {
-
-    if (sizeof(T)==sizeof(float)) {
-      FORTRAN_NAME(field_face_store_4)(ghost_4 + im,   array_4, m3,n3,
-                                       &iaccumulate);
-    } else if (sizeof(T)==sizeof(double)) {
-      FORTRAN_NAME(field_face_store_8)(ghost_8 + im,   array_8, m3,n3,
-                                       &iaccumulate);
-    } else if (sizeof(T)==sizeof(long double)) {
-      FORTRAN_NAME(field_face_store_16)(ghost_16 + im, array_16, m3,n3,
-                                        &iaccumulate);
-    } else {
-      ERROR1 ("FieldFace::store_()",
-              "unknown float precision sizeof(T) = %lu\n",sizeof(T));
-    }
-  } else {
-
-    if (accumulate) {
-      // add values
-      for (int iz=0; iz <n3[2]; iz++)  {
-        int kz = iz+i3[2];
-        for (int iy=0; iy < n3[1]; iy++) {
-          int ky = iy+i3[1];
-          for (int ix=0; ix < n3[0]; ix++) {
-            int kx = ix+i3[0];
-            int index_array = ix + n3[0]*(iy + n3[1] * iz);
-            int index_field = kx + m3[0]*(ky + m3[1] * kz);
-            ghost[index_field] += array[index_array];
-          }
-        }
-      }
-    } else {
-      // copy values
-      for (int iz=0; iz <n3[2]; iz++)  {
-        int kz = iz+i3[2];
-        for (int iy=0; iy < n3[1]; iy++) {
-          int ky = iy+i3[1];
-          for (int ix=0; ix < n3[0]; ix++) {
-            int kx = ix+i3[0];
-            int index_array = ix + n3[0]*(iy + n3[1] * iz);
-            int index_field = kx + m3[0]*(ky + m3[1] * kz);
-            ghost[index_field] = array[index_array];
-          }
-        }
-      }
-    }
-  }
+  copy_box_ (ghost + i0, m3[0], m3[1],
+             array, n3[0], n3[1], n3, accumulate);
 
   return (sizeof(T) * n3[0] * n3[1] * n3[2]);
 
@@ -811,33 +804,9 @@ template<class T> void FieldFace::copy_
 {
   const int is0 = is3[0] + ms3[0]*(is3[1] + ms3[1]*is3[2]);
   const int id0 = id3[0] + md3[0]*(id3[1] + md3[1]*id3[2]);
-  T * vd0 = vd + id0;
-  const T * vs0 = vs + is0;
-  const int msx = ms3[0];
-  const int msy = ms3[1];
-  const int mdx = md3[0];
-  const int mdy = md3[1];
-  if (accumulate) {
-    for (int iz=0; iz <ns3[2]; iz++)  {
-      for (int iy=0; iy < ns3[1]; iy++) {
-	for (int ix=0; ix < ns3[0]; ix++) {
-	  int i_src = ix + msx*(iy + msy*iz);
-	  int i_dst = ix + mdx*(iy + mdy*iz);
-	  vd0[i_dst] += vs0[i_src];
-	}
-      }
-    }
-  } else {
-    for (int iz=0; iz <ns3[2]; iz++)  {
-      for (int iy=0; iy < ns3[1]; iy++) {
-	for (int ix=0; ix < ns3[0]; ix++) {
-	  int i_src = ix + msx*(iy + msy*iz);
-	  int i_dst = ix + mdx*(iy + mdy*iz);
-	  vd0[i_dst] = vs0[i_src];
-	}
-      }
-    }
-  }
+
+  copy_box_ (vd + id0, md3[0], md3[1],
+             vs + is0, ms3[0], ms3[1], ns3, accumulate);
 }
 
 //----------------------------------------------------------------------
@@ -28,6 +28,14 @@ public: // interface
   /// Destructor
   ~FieldFace() throw();
 
+  /// Allocate FieldFace objects from the per-process BufferPool
+  static void * operator new (std::size_t n)
+  { return BufferPool::allocate(n); }
+
+  /// Return FieldFace objects to the per-process BufferPool
+  static void operator delete (void * p, std::size_t n)
+  { BufferPool::deallocate(p,n); }
+
   /// Copy constructor
   FieldFace(const FieldFace & FieldFace) throw();
 
@@ -108,7 +116,9 @@ public: // interface
   
   void set_field_list (std::vector<int> field_list);
   
-  /// Create an array with the field's face data
+  /// Create an array with the field's face data; the array is
+  /// allocated from the BufferPool and must be released with
+  /// BufferPool::deallocate(array,n)
   void face_to_array(Field field, int * n, char ** array) throw();
 
   /// Use existing array for field's face data
@@ -125,6 +135,10 @@ public: // interface
 
   int num_bytes_array (Field field) throw();
 
+  /// Return the start i3 and size n3 of the region of the i_f'th
+  /// refreshed field that face_to_array() copies into the array
+  void array_region (Field field, int i_f, int i3[3], int n3[3]) throw();
+
   //--------------------------------------------------
 
   /// Return the number of bytes required to serialize the data object
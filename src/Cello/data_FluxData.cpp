@@ -19,8 +19,40 @@ void FluxData::allocate
   std::vector<int> * cy_list,
   std::vector<int> * cz_list)
 {
-  field_list_ = field_list;
   unsigned nf = field_list.size();
+
+  // Reuse face fluxes from the previous cycle if the layout is unchanged
+
+  std::vector<int> layout = {nx, ny, nz, int(single_array)};
+  layout.insert(layout.end(),field_list.begin(),field_list.end());
+  for (unsigned i_f=0; i_f<nf; i_f++) {
+    layout.push_back(cx_list ? (*cx_list)[i_f] : 0);
+    layout.push_back(cy_list ? (*cy_list)[i_f] : 0);
+    layout.push_back(cz_list ? (*cz_list)[i_f] : 0);
+  }
+
+  release();
+
+  field_list_ = field_list;
+
+  if (layout == layout_cache_ && block_fluxes_cache_.size() == 6*nf) {
+    block_fluxes_.swap(block_fluxes_cache_);
+    neighbor_fluxes_.swap(neighbor_fluxes_cache_);
+    if (single_array) {
+      std::fill(flux_vector_.begin(),flux_vector_.end(),0.0);
+    } else {
+      for (unsigned i=0; i<6*nf; i++) {
+        block_fluxes_[i]->clear();
+        neighbor_fluxes_[i]->clear();
+      }
+    }
+    return;
+  }
+
+  deallocate();
+
+  layout_cache_ = layout;
+
   block_fluxes_.resize(6*nf,nullptr);
   neighbor_fluxes_.resize(6*nf,nullptr);
 
@@ -107,16 +139,36 @@ void FluxData::allocate
 
 //----------------------------------------------------------------------
 
-void FluxData::deallocate()
+void FluxData::release()
 {
-  for (unsigned i=0; i<block_fluxes_.size(); i++) {
-    delete block_fluxes_[i];
+  if (block_fluxes_.size() > 0) {
+    delete_fluxes_(block_fluxes_cache_);
+    delete_fluxes_(neighbor_fluxes_cache_);
+    block_fluxes_cache_.swap(block_fluxes_);
+    neighbor_fluxes_cache_.swap(neighbor_fluxes_);
   }
-  block_fluxes_.clear();
-  for (unsigned i=0; i<neighbor_fluxes_.size(); i++) {
-    delete neighbor_fluxes_[i];
+}
+
+//----------------------------------------------------------------------
+
+void FluxData::deallocate()
+{
+  delete_fluxes_(block_fluxes_);
+  delete_fluxes_(neighbor_fluxes_);
+  delete_fluxes_(block_fluxes_cache_);
+  delete_fluxes_(neighbor_fluxes_cache_);
+  std::vector<cello_float>().swap(flux_vector_);
+  layout_cache_.clear();
+}
+
+//----------------------------------------------------------------------
+
+void FluxData::delete_fluxes_ (std::vector<FaceFluxes *> & face_fluxes)
+{
+  for (unsigned i=0; i<face_fluxes.size(); i++) {
+    delete face_fluxes[i];
   }
-  neighbor_fluxes_.clear();
+  face_fluxes.clear();
 }
 
 //----------------------------------------------------------------------
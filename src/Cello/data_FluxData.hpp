@@ -22,22 +22,22 @@ public: // interface
     : block_fluxes_(),
       neighbor_fluxes_(),
       field_list_(),
-      flux_vector_()
+      flux_vector_(),
+      block_fluxes_cache_(),
+      neighbor_fluxes_cache_(),
+      layout_cache_()
   {
   }
 
   virtual ~FluxData()
   {
-    int n=block_fluxes_.size();
-    for (int i=0; i<n; i++) {
-      delete block_fluxes_[i];
-      delete neighbor_fluxes_[i];
-      block_fluxes_[i] = nullptr;
-      neighbor_fluxes_[i] = nullptr;
-    }
+    deallocate();
   }
 
   FluxData( const FluxData & fd )
+    : block_fluxes_cache_(),
+      neighbor_fluxes_cache_(),
+      layout_cache_()
   {
     int n = fd.block_fluxes_.size();
     block_fluxes_.resize(n);
@@ -85,7 +85,8 @@ public: // interface
   
   /// Allocate all flux arrays for each field in the list of field
   /// indices.  Optional arrays to indicate the centering of fields
-  /// may also be provided
+  /// may also be provided.  Face fluxes kept by release() are reused
+  /// and cleared in place if the sizes, fields, and centering match.
   void allocate
   (int nx, int ny, int nz,
    std::vector<int> field_list,
@@ -94,7 +95,13 @@ public: // interface
    std::vector<int> * cy_list=nullptr,
    std::vector<int> * cz_list=nullptr);
 
-  /// Deallocate all face fluxes for all faces and all fields
+  /// Release all face fluxes at the end of a cycle, keeping their
+  /// storage for reuse by the next call to allocate()
+  void release();
+
+  /// Deallocate all face fluxes for all faces and all fields,
+  /// including storage kept by release().  Called when the Block is
+  /// refined or may migrate
   void deallocate();
 
   /// Return the number of field indices
@@ -187,6 +194,9 @@ protected: // functions
   inline int index_ (int axis, int face, unsigned i_f) const
   { return axis + 3*(face + 2*i_f); }
 
+  /// Delete the face fluxes in the vector and clear it
+  static void delete_fluxes_ (std::vector<FaceFluxes *> & face_fluxes);
+
 protected: // attributes
 
   // NOTE: change pup() function whenever attributes change
@@ -203,6 +213,16 @@ protected: // attributes
   /// Array of all fluxes for FaceFluxes objects
   std::vector<cello_float> flux_vector_;
 
+  /// Face fluxes kept by release() for reuse by allocate() (not
+  /// pup'ed: deallocated before migration)
+  std::vector<FaceFluxes *> block_fluxes_cache_;
+  std::vector<FaceFluxes *> neighbor_fluxes_cache_;
+
+  /// Block size, fields, storage type and centering of the face
+  /// fluxes last created by allocate(), used to check whether
+  /// released face fluxes can be reused
+  std::vector<int> layout_cache_;
+
 };
 
 #endif /* DATA_FLUX_DATA_HPP */
@@ -152,7 +152,7 @@ public: // interface
   { particle_descr_->set_velocity (it,ix,iy,iz); }
 
   /// Byte offsets of attributes into block array.  Not including
-  /// initial offset for 16-byte alignment.
+  /// initial offset for PARTICLE_ALIGN-byte alignment.
 
   int attribute_offset(int it, int ia) const
   { return particle_descr_->attribute_offset(it,ia); }
@@ -285,6 +285,22 @@ public: // interface
   { return particle_data_->attribute_array
       (particle_descr_, it,ia,ib); }
 
+  /// Return a contiguous, aligned view of the given attribute in the
+  /// given batch, for loops that should vectorize.  Only valid for
+  /// particle types that are not interleaved, and T must have the same
+  /// size as the attribute (e.g. enzo_float for "x").  Unlike
+  /// attribute_array(), the stride is always 1.
+
+  template <class T>
+  ParticleSpan<T> attribute_span (int it,int ia,int ib)
+  { return particle_data_->attribute_span<T>
+      (particle_descr_, it,ia,ib); }
+
+  template <class T>
+  ParticleSpan<const T> attribute_span (int it,int ia,int ib) const
+  { return particle_data_->attribute_span<const T>
+      (particle_descr_, it,ia,ib); }
+
   /// Return the number of batches of particles for the given type.
 
   int num_batches (int it) const
@@ -7,6 +7,7 @@
 
 #include "data.hpp"
 #include <algorithm>
+#include <cstring>
 
 // #define DEBUG_PARTICLES
 
@@ -27,10 +28,27 @@ ParticleData::ParticleData()
 
 bool ParticleData::operator== (const ParticleData & particle_data) throw ()
 {
-  return
-    (attribute_array_ == particle_data.attribute_array_) &&
-    (attribute_align_ == particle_data.attribute_align_) &&
-    (particle_count_  == particle_data.particle_count_);
+  if (particle_count_ != particle_data.particle_count_) return false;
+
+  // copies may be aligned differently, so compare values starting at
+  // the aligned start of each batch
+  const size_t nt = attribute_array_.size();
+  if (particle_data.attribute_array_.size() != nt) return false;
+  for (size_t it=0; it<nt; it++) {
+    const size_t nb = attribute_array_[it].size();
+    if (particle_data.attribute_array_[it].size() != nb) return false;
+    for (size_t ib=0; ib<nb; ib++) {
+      const std::vector<char> & a = attribute_array_[it][ib];
+      const std::vector<char> & b = particle_data.attribute_array_[it][ib];
+      if (a.size() != b.size()) return false;
+      if (a.size() == 0) continue;
+      const int align_a = attribute_align_[it][ib];
+      const int align_b = particle_data.attribute_align_[it][ib];
+      const size_t n = a.size() - std::max(align_a,align_b);
+      if (memcmp(&a[0] + align_a, &b[0] + align_b, n) != 0) return false;
+    }
+  }
+  return true;
 }
 
 //----------------------------------------------------------------------
@@ -40,6 +58,8 @@ void ParticleData::pup (PUP::er &p)
   p | attribute_array_;
   p | attribute_align_;
   p | particle_count_;
+
+  if (p.isUnpacking()) align_attribute_arrays_();
 }
 
 //----------------------------------------------------------------------
@@ -1078,6 +1098,9 @@ char * ParticleData::load_data (ParticleDescr * particle_descr,
 	  "Buffer has size %ld but expecting size %d",
 	  (pc-buffer),data_size(particle_descr),
 	  ((pc-buffer) == data_size(particle_descr)));
+
+  align_attribute_arrays_();
+
   return pc;
 }
 
@@ -1175,7 +1198,12 @@ void ParticleData::resize_attribute_array_
     np = particle_descr->batch_size();
   }
 
-  long unsigned new_size = mp*(np) + (PARTICLE_ALIGN - 1) ;
+  // non-interleaved attribute arrays are each padded to PARTICLE_ALIGN
+  // bytes, so use the batch size in bytes rather than mp*np
+  const long unsigned bytes = particle_descr->interleaved(it) ?
+    mp*(np) : particle_descr->batch_bytes(it);
+
+  long unsigned new_size = bytes + (PARTICLE_ALIGN - 1) ;
 
   if (attribute_array_[it][ib].size() != new_size) {
 
@@ -1184,10 +1212,41 @@ void ParticleData::resize_attribute_array_
 	    new_size, new_size >= 0);
 
     attribute_array_[it][ib].resize(new_size);
-    char * array = &attribute_array_[it][ib][0];
-    uintptr_t iarray = (uintptr_t) array;
-    int defect = (iarray % PARTICLE_ALIGN);
-    attribute_align_[it][ib] = (defect == 0) ? 0 : PARTICLE_ALIGN-defect;
+
+    // the array may have been reallocated
+    align_attribute_array_(it,ib);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void ParticleData::align_attribute_array_ (int it, int ib)
+{
+  std::vector<char> & array = attribute_array_[it][ib];
+  if (array.size() == 0) return;
+
+  const int align_old = attribute_align_[it][ib];
+  const uintptr_t iarray = (uintptr_t) (&array[0]);
+  const int defect = (iarray % PARTICLE_ALIGN);
+  const int align_new = (defect == 0) ? 0 : PARTICLE_ALIGN-defect;
+
+  if (align_new != align_old) {
+    // shift the values to the new aligned start.  The array has
+    // PARTICLE_ALIGN - 1 bytes of slack, so this never discards data
+    const size_t n = array.size() - std::max(align_old,align_new);
+    memmove (&array[0] + align_new, &array[0] + align_old, n);
+    attribute_align_[it][ib] = align_new;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void ParticleData::align_attribute_arrays_ ()
+{
+  for (size_t it=0; it<attribute_array_.size(); it++) {
+    for (size_t ib=0; ib<attribute_array_[it].size(); ib++) {
+      align_attribute_array_(it,ib);
+    }
   }
 }
 
@@ -39,6 +39,9 @@ public: // interface
     attribute_align_ = particle_data.attribute_align_;
     particle_count_  = particle_data.particle_count_;
 
+    // copies are generally not aligned the same as the original
+    align_attribute_arrays_();
+
     ParticleDescr * particle_descr = cello::particle_descr();
     id_counter[cello::index_static()] = num_particles(particle_descr);
   }
@@ -54,6 +57,27 @@ public: // interface
       ((ParticleData*)this) -> attribute_array (pd,it,ia,ib);
   }
 
+  /// Return a contiguous view of the given attribute in the given batch.
+  /// The particle type must not be interleaved, and T must have the
+  /// size of the attribute.
+  template <class T>
+  ParticleSpan<T> attribute_span (ParticleDescr *pd, int it, int ia, int ib)
+  {
+    ASSERT2 ("ParticleData::attribute_span()",
+             "Particle type %s is interleaved, so attribute %s "
+             "isn't contiguous",
+             pd->type_name(it).c_str(), pd->attribute_name(it,ia).c_str(),
+             ! pd->interleaved(it));
+    ASSERT3 ("ParticleData::attribute_span()",
+             "Particle attribute %s has %d bytes but was accessed as a "
+             "type with %d bytes",
+             pd->attribute_name(it,ia).c_str(), pd->attribute_bytes(it,ia),
+             int(sizeof(T)), (pd->attribute_bytes(it,ia) == int(sizeof(T))));
+    T * array = (T *) attribute_array(pd,it,ia,ib);
+    return (array == NULL) ?
+      ParticleSpan<T>() : ParticleSpan<T>(array,num_particles(pd,it,ib));
+  }
+
   /// Return the number of batches of particles for the given type.
 
   int num_batches (int it) const;
@@ -184,10 +208,19 @@ private: /// functions
 
   /// long long assign_id_ ()
 
-  /// Allocate attribute_array_ block, aligned at 16 byte boundary
-  /// with updated attribute_align_
+  /// Allocate attribute_array_ block, aligned at PARTICLE_ALIGN byte
+  /// boundary with updated attribute_align_
   void resize_attribute_array_ (ParticleDescr *, int it, int ib, int np);
 
+  /// Move the values in the given batch, if needed, so that they start
+  /// at a PARTICLE_ALIGN byte boundary, and update attribute_align_.
+  /// Required whenever the array may have moved in memory, e.g. after
+  /// being resized, copied, or unpacked.
+  void align_attribute_array_ (int it, int ib);
+
+  /// Apply align_attribute_array_() to all batches
+  void align_attribute_arrays_ ();
+
   void check_arrays_ (ParticleDescr * particle_descr,
 		      std::string file, int line) const;
 
@@ -229,8 +262,8 @@ private: /// attributes
   /// Array of blocks of particle attributes array_[it][ib][iap];
   std::vector< std::vector< std::vector<char> > > attribute_array_;
 
-  /// Alignment adjustment to correct for 16-byte alignment of
-  /// first attribute in each batch
+  /// Alignment adjustment to correct for PARTICLE_ALIGN-byte alignment
+  /// of first attribute in each batch
 
   std::vector< std::vector< char > > attribute_align_;
 
@@ -189,12 +189,14 @@ int ParticleDescr::new_attribute (int it, std::string name, int type)
   attribute_type_[it]. push_back(type);
   attribute_bytes_[it].push_back(attribute_bytes);
 
-  // compute offset of next attribute
+  // compute offset of next attribute: if not interleaved, pad each
+  // attribute array so that the next one is also aligned
 
-  const int increment = attribute_interleaved_[it] ? 1 : batch_size_;
+  const int bytes = attribute_interleaved_[it] ?
+    attribute_bytes_[it][na] :
+    align_(batch_size_ * attribute_bytes_[it][na], PARTICLE_ALIGN);
 
-  attribute_offset_[it].push_back
-    (attribute_offset_[it][na] + increment * attribute_bytes_[it][na]);
+  attribute_offset_[it].push_back (attribute_offset_[it][na] + bytes);
 
   // update particle bytes
   if (attribute_interleaved_[it]) {
@@ -464,6 +466,19 @@ int ParticleDescr::particle_bytes(int it) const
 
 //----------------------------------------------------------------------
 
+int ParticleDescr::batch_bytes(int it) const
+{
+  ASSERT1("ParticleDescr::batch_bytes",
+	  "Trying to access unknown particle type %d",
+	  it,
+	  (0 <= it && it < num_types()));
+
+  return attribute_interleaved_[it] ?
+    batch_size_ * particle_bytes_[it] : attribute_offset_[it].back();
+}
+
+//----------------------------------------------------------------------
+
 int ParticleDescr::constant_bytes(int it,int ic) const
 {
   ASSERT2("ParticleDescr::constant_bytes",
@@ -110,7 +110,9 @@ public: // interface
   std::string attribute_name (int it, int ia) const;
 
   /// Byte offsets of attributes into block array.  Not including
-  /// initial offset for 16-byte alignment.
+  /// initial offset for PARTICLE_ALIGN-byte alignment.  If not
+  /// interleaved, each attribute array is padded to a multiple of
+  /// PARTICLE_ALIGN bytes, so all attribute arrays are aligned.
   int attribute_offset(int it, int ia) const;
 
   /// Define which attributes represent position coordinates (-1 if not defined)
@@ -137,6 +139,10 @@ public: // interface
   /// Return the number of bytes use to represent a particle.
   int particle_bytes (int it) const;
 
+  /// Return the number of bytes used to store a full batch of
+  /// particles, including any padding between attribute arrays
+  int batch_bytes (int it) const;
+
   /// Return the data type of the given attribute.
   int attribute_type (int it,int ia) const;
 
@@ -0,0 +1,86 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     data_ParticleSpan.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Data] Declaration of the ParticleSpan class template
+///
+/// This header doesn't depend on any other Cello header, so that it can
+/// be used by stand-alone kernels and benchmarks.
+
+#ifndef DATA_PARTICLE_SPAN_HPP
+#define DATA_PARTICLE_SPAN_HPP
+
+/// Alignment in bytes of particle batches and (unless the particle type
+/// is interleaved) of each attribute array in a batch.  Large enough for
+/// a full 512-bit vector register or a cache line.
+#define PARTICLE_ALIGN 64
+
+#if defined(__GNUC__)
+#   define PARTICLE_ASSUME_ALIGNED(POINTER) \
+  __builtin_assume_aligned(POINTER,PARTICLE_ALIGN)
+#else
+#   define PARTICLE_ASSUME_ALIGNED(POINTER) (POINTER)
+#endif
+
+template <class T>
+class ParticleSpan {
+
+  /// @class    ParticleSpan
+  /// @ingroup  Data
+  /// @brief    [\ref Data] Contiguous view of one attribute of the
+  ///           particles in one batch
+  ///
+  /// Unlike the arrays returned by Particle::attribute_array(), the
+  /// values are known at compile time to have unit stride and to start at
+  /// a PARTICLE_ALIGN-byte boundary, so that loops over them can be
+  /// vectorized without runtime checks on the layout.  A ParticleSpan
+  /// doesn't own its data, and is invalidated by any operation that may
+  /// reallocate the batch (e.g. inserting, deleting or scattering
+  /// particles, or migrating the Block).
+
+public: // interface
+
+  /// Create an empty span
+  ParticleSpan() throw()
+    : data_(nullptr), size_(0)
+  { }
+
+  /// Create a span of size values starting at the aligned address data
+  ParticleSpan(T * data, int size) throw()
+    : data_(data), size_(size)
+  { }
+
+  /// Return the (aligned) address of the first value
+  T * data() const throw()
+  { return (T *) PARTICLE_ASSUME_ALIGNED(data_); }
+
+  /// Return the number of particles
+  int size() const throw()
+  { return size_; }
+
+  /// Return whether the span has no particles
+  bool empty() const throw()
+  { return size_ == 0; }
+
+  /// Access the value of the ip'th particle
+  T & operator[] (int ip) const throw()
+  { return data()[ip]; }
+
+  /// Iterators, for use with range-based for loops and <algorithm>
+  T * begin() const throw()
+  { return data(); }
+  T * end() const throw()
+  { return data() + size_; }
+
+private: // attributes
+
+  /// Address of the first value
+  T * data_;
+
+  /// Number of values
+  int size_;
+
+};
+
+#endif /* DATA_PARTICLE_SPAN_HPP */
@@ -228,6 +228,27 @@ void FileHdf5::data_slice
 
 //----------------------------------------------------------------------
 
+int FileHdf5::data_slice_complement
+( int n1, int n2, int n3, int n4,
+  int o1, int o2, int o3, int o4) throw()
+{
+  hsize_t start[4]  = {hsize_t(o1),
+		       hsize_t(o2),
+		       hsize_t(o3),
+		       hsize_t(o4)};
+  hsize_t count[4]  = {hsize_t(n1),
+		       hsize_t(n2),
+		       hsize_t(n3),
+		       hsize_t(n4)};
+
+  H5Sselect_all (data_space_id_);
+  H5Sselect_hyperslab (data_space_id_,H5S_SELECT_NOTB,start,0,count,0);
+
+  return H5Sget_select_npoints (data_space_id_);
+}
+
+//----------------------------------------------------------------------
+
 void FileHdf5::mem_create
 ( int mx, int my, int mz,
   int nx, int ny, int nz,
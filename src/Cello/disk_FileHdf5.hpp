@@ -100,6 +100,12 @@ public: // virtual functions
     int n1, int n2, int n3, int n4,
     int o1, int o2, int o3, int o4) throw();
 
+  /// Select all of the data except the given subset, returning the
+  /// number of elements selected
+  int data_slice_complement
+  ( int n1, int n2, int n3, int n4,
+    int o1, int o2, int o3, int o4) throw();
+
   /// Return the size of the disk dataset
   virtual int data_size (int * m4) throw();
   
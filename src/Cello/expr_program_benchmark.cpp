@@ -0,0 +1,271 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     expr_program_benchmark.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Throughput benchmark for compiled parameter expressions
+///
+/// usage: expr_program_benchmark [n [repeats]]
+///
+/// Parses a set of floating-point and logical expressions typical of
+/// initial values, boundary values and masks, and evaluates each on an
+/// n^3 grid `repeats` times in two ways:
+///
+///   - "tree": the recursive evaluation of the expression tree formerly
+///     used by Param, on n^3 arrays of coordinates (as ScalarExpr and
+///     MaskExpr built them)
+///   - "program": ExprProgram::evaluate_grid() on the coordinate vectors
+///
+/// and reports the points per second and speedup of each.  The results
+/// must be bitwise identical; the program exits with status 1 if they
+/// aren't.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "parse.h"
+#include "parameters_ExprProgram.hpp"
+
+extern "C" {
+  struct param_struct * cello_parameters_read(const char *, FILE *);
+}
+
+//----------------------------------------------------------------------
+
+/// Former recursive evaluation of a floating-point expression
+static void tree_float (int n, double * result, double * x, double * y,
+                        double * z, double t, struct node_expr * node)
+{
+  double * left  = NULL;
+  double * right = NULL;
+  if (node->left) {
+    left = new double [n];
+    tree_float(n,left,x,y,z,t,node->left);
+  }
+  if (node->right) {
+    right = new double [n];
+    tree_float(n,right,x,y,z,t,node->right);
+  }
+  int i;
+  switch (node->type) {
+  case enum_node_operation:
+    switch (node->op_value) {
+    case enum_op_add: for (i=0; i<n; i++) result[i] = left[i] + right[i]; break;
+    case enum_op_sub: for (i=0; i<n; i++) result[i] = left[i] - right[i]; break;
+    case enum_op_mul: for (i=0; i<n; i++) result[i] = left[i] * right[i]; break;
+    case enum_op_div: for (i=0; i<n; i++) result[i] = left[i] / right[i]; break;
+    case enum_op_pow: for (i=0; i<n; i++) result[i] = pow(left[i], right[i]); break;
+    }
+    break;
+  case enum_node_float:
+    for (i=0; i<n; i++) result[i] = node->float_value;
+    break;
+  case enum_node_integer:
+    for (i=0; i<n; i++) result[i] = double(node->integer_value);
+    break;
+  case enum_node_variable:
+    switch (node->var_value) {
+    case 'x': for (i=0; i<n; i++) result[i] = x[i]; break;
+    case 'y': for (i=0; i<n; i++) result[i] = y[i]; break;
+    case 'z': for (i=0; i<n; i++) result[i] = z[i]; break;
+    case 't': for (i=0; i<n; i++) result[i] = t;    break;
+    }
+    break;
+  case enum_node_function:
+    for (i=0; i<n; i++) result[i] = (*(node->fun_value))(left[i]);
+    break;
+  }
+  delete [] left;
+  delete [] right;
+}
+
+/// Former recursive evaluation of a logical expression
+static void tree_logical (int n, bool * result, double * x, double * y,
+                          double * z, double t, struct node_expr * node)
+{
+  const bool logical = (node->op_value == enum_op_and ||
+                        node->op_value == enum_op_or);
+  bool   * left_logical  = logical ? new bool [n] : NULL;
+  bool   * right_logical = logical ? new bool [n] : NULL;
+  double * left_float    = logical ? NULL : new double [n];
+  double * right_float   = logical ? NULL : new double [n];
+  if (logical) {
+    tree_logical(n,left_logical, x,y,z,t,node->left);
+    tree_logical(n,right_logical,x,y,z,t,node->right);
+  } else {
+    tree_float(n,left_float, x,y,z,t,node->left);
+    tree_float(n,right_float,x,y,z,t,node->right);
+  }
+  int i;
+  switch (node->op_value) {
+  case enum_op_le: for (i=0; i<n; i++) result[i] = left_float[i] <= right_float[i]; break;
+  case enum_op_lt: for (i=0; i<n; i++) result[i] = left_float[i] <  right_float[i]; break;
+  case enum_op_ge: for (i=0; i<n; i++) result[i] = left_float[i] >= right_float[i]; break;
+  case enum_op_gt: for (i=0; i<n; i++) result[i] = left_float[i] >  right_float[i]; break;
+  case enum_op_eq: for (i=0; i<n; i++) result[i] = left_float[i] == right_float[i]; break;
+  case enum_op_ne: for (i=0; i<n; i++) result[i] = left_float[i] != right_float[i]; break;
+  case enum_op_and: for (i=0; i<n; i++) result[i] = left_logical[i] && right_logical[i]; break;
+  case enum_op_or:  for (i=0; i<n; i++) result[i] = left_logical[i] || right_logical[i]; break;
+  }
+  delete [] left_float;
+  delete [] right_float;
+  delete [] left_logical;
+  delete [] right_logical;
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+static double time_since (T start)
+{
+  return std::chrono::duration<double>
+    (std::chrono::steady_clock::now() - start).count();
+}
+
+int main (int argc, char ** argv)
+{
+  const int n       = (argc > 1) ? atoi(argv[1]) : 64;
+  const int repeats = (argc > 2) ? atoi(argv[2]) : 10;
+  const int m = n*n*n;
+  const double t = 0.25;
+
+  const char * file_name = "expr_program_benchmark.in";
+  FILE * fp = fopen (file_name,"w");
+  fprintf
+    (fp,
+     "Test {\n"
+     "  linear   = 1.0*x + 2.0*y - 5.0*z + t;\n"
+     "  gaussian = 1.0 + 0.5*exp((0.0 - (x - 0.5)^2.0 - (y - 0.5)^2.0 - (z - 0.5)^2.0)/0.01);\n"
+     "  wave     = 1.0 + 1e-3*sin(2.0*3.14159265358979*(x + 2.0*y + 3.0*z - t));\n"
+     "  constant = 2.0 * (3.0 + 4.0) / sqrt(2.0);\n"
+     "  sphere   = (x - 0.5)*(x - 0.5) + (y - 0.5)*(y - 0.5) + (z - 0.5)*(z - 0.5) < 0.04;\n"
+     "  slab     = x < 0.3 || (y >= 0.6 && z - t > 0.1);\n"
+     "}\n");
+  fclose (fp);
+
+  fp = fopen (file_name,"r");
+  struct param_struct * head = cello_parameters_read (file_name,fp);
+  fclose (fp);
+  remove (file_name);
+
+  // coordinate vectors, and the arrays formerly built from them
+  std::vector<double> xv(n), yv(n), zv(n);
+  for (int i=0; i<n; i++) {
+    xv[i] = (i + 0.5) / n;
+    yv[i] = (i + 0.5) / n + 0.01;
+    zv[i] = (i + 0.5) / n + 0.02;
+  }
+  std::vector<double> x(m), y(m), z(m);
+  for (int iz=0; iz<n; iz++) {
+    for (int iy=0; iy<n; iy++) {
+      for (int ix=0; ix<n; ix++) {
+        const int i = ix + n*(iy + n*iz);
+        x[i] = xv[ix];
+        y[i] = yv[iy];
+        z[i] = zv[iz];
+      }
+    }
+  }
+
+  printf ("grid %d^3  repeats %d\n", n, repeats);
+  printf ("%-10s %12s %14s %14s %9s\n",
+          "expression", "instructions", "tree pts/sec", "program pts/sec",
+          "speedup");
+
+  bool ok = true;
+  int count = 0;
+  // the list is circular, starting with a sentinel
+  for (struct param_struct * p = head->next;
+       p->type != enum_parameter_sentinel; p = p->next) {
+    const bool is_float   = (p->type == enum_parameter_float_expr);
+    const bool is_logical = (p->type == enum_parameter_logical_expr);
+    if (! is_float && ! is_logical && p->type != enum_parameter_float)
+      continue;
+    ++count;
+
+    // constant expressions are folded by the parser; compile them from a
+    // single node
+    struct node_expr constant_node;
+    struct node_expr * node = p->op_value;
+    if (p->type == enum_parameter_float) {
+      constant_node.type = enum_node_float;
+      constant_node.float_value = p->float_value;
+      constant_node.left = constant_node.right = NULL;
+      node = &constant_node;
+    }
+
+    ExprProgram program;
+    std::string error;
+    if (! program.compile (node, is_logical, &error)) {
+      printf ("FAILED: %s: %s\n", p->parameter, error.c_str());
+      ok = false;
+      continue;
+    }
+
+    std::vector<double> tree_value(m), program_value(m);
+    std::vector<char>   tree_mask(m), program_mask(m);
+    bool * tree_mask_p    = (bool *) tree_mask.data();
+    bool * program_mask_p = (bool *) program_mask.data();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int r=0; r<repeats; r++) {
+      if (is_logical) {
+        tree_logical (m,tree_mask_p,x.data(),y.data(),z.data(),t,node);
+      } else {
+        tree_float (m,tree_value.data(),x.data(),y.data(),z.data(),t,node);
+      }
+    }
+    const double time_tree = time_since(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int r=0; r<repeats; r++) {
+      if (is_logical) {
+        program.evaluate_grid (program_mask_p, n, n, t,
+                               n, xv.data(), n, yv.data(), n, zv.data());
+      } else {
+        program.evaluate_grid (program_value.data(), n, n, t,
+                               n, xv.data(), n, yv.data(), n, zv.data());
+      }
+    }
+    const double time_program = time_since(start);
+
+    const bool match = is_logical ?
+      (memcmp (tree_mask.data(), program_mask.data(), m) == 0) :
+      (memcmp (tree_value.data(), program_value.data(),
+               m*sizeof(double)) == 0);
+
+    // the pointwise interface must agree with the grid interface
+    std::vector<double> point_value(m);
+    std::vector<char>   point_mask(m);
+    if (is_logical) {
+      program.evaluate (m, (bool *) point_mask.data(),
+                        x.data(), y.data(), z.data(), t);
+    } else {
+      program.evaluate (m, point_value.data(),
+                        x.data(), y.data(), z.data(), t);
+    }
+    const bool match_points = is_logical ?
+      (memcmp (point_mask.data(), program_mask.data(), m) == 0) :
+      (memcmp (point_value.data(), program_value.data(),
+               m*sizeof(double)) == 0);
+
+    const double points = double(repeats)*m;
+    printf ("%-10s %12d %14.4e %14.4e %9.2f%s\n", p->parameter,
+            program.num_instructions(), points/time_tree,
+            points/time_program, time_tree/time_program,
+            (match && match_points) ? "" : "  FAILED");
+    ok = ok && match && match_points;
+  }
+
+  if (count != 6) {
+    printf ("FAILED: parsed %d expressions but expected 6\n", count);
+    ok = false;
+  }
+
+  return ok ? 0 : 1;
+}
@@ -25,6 +25,7 @@ void Memory::initialize_()
 
   if (group_name_.size() == 0) {
     new_group ("Cello");
+    new_group ("Scratch");
   }
 
   fill_new_    = 0xaa;
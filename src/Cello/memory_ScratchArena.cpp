@@ -0,0 +1,136 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     memory_ScratchArena.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Implementation of the ScratchArena class
+
+#include "cello.hpp"
+
+#include "memory.hpp"
+
+ScratchArena ScratchArena::instance_[CONFIG_NODE_SIZE];
+
+//----------------------------------------------------------------------
+
+ScratchArena::ScratchArena()
+  : buffer_(nullptr),
+    capacity_(0),
+    used_(0),
+    reserved_(0),
+    overflow_(),
+    overflow_bytes_(),
+    bytes_overflow_(0),
+    bytes_high_(0),
+    bytes_highest_(0),
+    num_overflow_(0)
+{
+}
+
+//----------------------------------------------------------------------
+
+ScratchArena::~ScratchArena()
+{
+  // The buffer is deliberately not deleted: this runs during static
+  // destruction at exit, possibly after the Memory objects that
+  // would track the deallocation are gone
+}
+
+//----------------------------------------------------------------------
+
+void * ScratchArena::allocate_bytes (size_t bytes)
+{
+  bytes = align_(bytes);
+
+  char * array;
+
+  if (overflow_.empty() && used_ + bytes <= capacity_) {
+    array = aligned_(buffer_) + used_;
+    used_ += bytes;
+  } else {
+    // does not fit (or earlier overflow still live): keep LIFO order
+    // by allocating separately until released
+    char * overflow = new_array_(bytes);
+    overflow_.push_back(overflow);
+    overflow_bytes_.push_back(bytes);
+    bytes_overflow_ += bytes;
+    ++num_overflow_;
+    array = aligned_(overflow);
+  }
+
+  const int64_t bytes_curr = this->bytes();
+  bytes_high_    = std::max(bytes_high_,   bytes_curr);
+  bytes_highest_ = std::max(bytes_highest_,bytes_curr);
+  reserved_      = std::max(reserved_,     size_t(bytes_curr));
+
+  return array;
+}
+
+//----------------------------------------------------------------------
+
+void ScratchArena::release (Mark mark)
+{
+  ASSERT2 ("ScratchArena::release()",
+	   "Releasing to mark %ld beyond current position %ld: "
+	   "arrays must be released in reverse order",
+	   long(mark.used), long(used_),
+	   (mark.used <= used_ && mark.num_overflow <= overflow_.size()));
+
+  while (overflow_.size() > mark.num_overflow) {
+    delete [] overflow_.back();
+    bytes_overflow_ -= overflow_bytes_.back();
+    overflow_.pop_back();
+    overflow_bytes_.pop_back();
+  }
+  used_ = mark.used;
+
+  grow_();
+}
+
+//----------------------------------------------------------------------
+
+void ScratchArena::reserve (size_t bytes)
+{
+  reserved_ = std::max(reserved_,align_(bytes));
+  grow_();
+}
+
+//----------------------------------------------------------------------
+
+void ScratchArena::print () const
+{
+  Monitor * monitor = Monitor::instance();
+  monitor->print ("Memory","Scratch capacity %ld bytes_high %ld "
+		  "bytes_highest %ld overflows %ld",
+		  long(capacity_), long(bytes_high_),
+		  long(bytes_highest_), long(num_overflow_));
+}
+
+//======================================================================
+
+char * ScratchArena::new_array_ (size_t bytes)
+{
+#ifdef CONFIG_USE_MEMORY
+  Memory * memory = Memory::instance();
+  const std::string group = memory->group();
+  memory->set_group("Scratch");
+#endif
+
+  char * array = new char [bytes + alignment];
+
+#ifdef CONFIG_USE_MEMORY
+  memory->set_group(group);
+#endif
+  return array;
+}
+
+//----------------------------------------------------------------------
+
+void ScratchArena::grow_ ()
+{
+  if (used_ == 0 && overflow_.empty() && capacity_ < reserved_) {
+    delete [] buffer_;
+    buffer_   = new_array_(reserved_);
+    capacity_ = reserved_;
+  }
+}
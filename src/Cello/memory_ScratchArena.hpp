@@ -0,0 +1,139 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     memory_ScratchArena.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Memory] Declaration of the ScratchArena class
+
+#ifndef MEMORY_SCRATCH_ARENA_HPP
+#define MEMORY_SCRATCH_ARENA_HPP
+
+class ScratchArena {
+
+  /// @class    ScratchArena
+  /// @ingroup  Memory
+  /// @brief    [\ref Memory] Per-PE reusable buffer for short-lived
+  /// temporary arrays.
+  ///
+  /// Arrays are carved from a single aligned buffer that is kept
+  /// across calls, and released in LIFO order back to a Mark.  A
+  /// request that does not fit is served from a separate overflow
+  /// allocation, and the buffer is grown to the high-water mark the
+  /// next time the arena is empty, so that after the first few calls
+  /// no heap allocations are made.  When CONFIG_USE_MEMORY is defined
+  /// the buffers are counted in the "Scratch" Memory group.
+
+public: // interface
+
+  /// Alignment in bytes of every array returned by allocate()
+  enum { alignment = 64 };
+
+  /// Position to release back to
+  struct Mark {
+    size_t used;
+    size_t num_overflow;
+  };
+
+  /// Get the ScratchArena object for this PE
+  static ScratchArena * instance()
+  { return & instance_[cello::index_static()]; }
+
+  /// Return an uninitialized aligned array of n values of type T
+  template <class T>
+  T * allocate (size_t n)
+  { return (T *) allocate_bytes (n*sizeof(T)); }
+
+  /// Return an uninitialized aligned array of the given size
+  void * allocate_bytes (size_t bytes);
+
+  /// Current position, for releasing allocations made after it
+  Mark mark() const
+  { return {used_, overflow_.size()}; }
+
+  /// Release all allocations made since the given mark
+  void release (Mark mark);
+
+  /// Make sure the buffer can hold at least the given number of
+  /// bytes, e.g. computed from Block dimensions.  Takes effect when
+  /// the arena is next empty if arrays are currently allocated
+  void reserve (size_t bytes);
+
+  /// Size of the reusable buffer
+  int64_t bytes_capacity () const
+  { return capacity_; }
+
+  /// Bytes currently handed out, including overflow allocations
+  int64_t bytes () const
+  { return used_ + bytes_overflow_; }
+
+  /// Maximum bytes handed out since the last reset_high()
+  int64_t bytes_high () const
+  { return bytes_high_; }
+
+  /// Maximum bytes handed out during the run
+  int64_t bytes_highest () const
+  { return bytes_highest_; }
+
+  /// Number of requests that did not fit in the buffer
+  int64_t num_overflow () const
+  { return num_overflow_; }
+
+  /// Reset bytes_high to current
+  void reset_high ()
+  { bytes_high_ = bytes(); }
+
+  /// Print arena summary
+  void print () const;
+
+private: // functions
+
+  ScratchArena();
+
+  ~ScratchArena();
+
+  /// Copying is not allowed (one object per PE)
+  ScratchArena (const ScratchArena &);
+  ScratchArena & operator = (const ScratchArena &);
+
+  /// Allocate an array with room for aligning, counted in the
+  /// "Scratch" Memory group
+  static char * new_array_ (size_t bytes);
+
+  /// Round up to a multiple of alignment
+  static size_t align_ (size_t bytes)
+  { return (bytes + alignment - 1) / alignment * alignment; }
+
+  /// Return the first aligned address in the array
+  static char * aligned_ (char * array)
+  { return (char *) align_((size_t)array); }
+
+  /// Grow the buffer if it is empty and smaller than reserved
+  void grow_ ();
+
+private: // attributes
+
+  /// Reusable buffer as allocated, and its size once aligned
+  char * buffer_;
+  size_t capacity_;
+
+  /// Bytes of the buffer in use
+  size_t used_;
+
+  /// Buffer size requested by reserve() or the high-water mark
+  size_t reserved_;
+
+  /// Arrays that did not fit in the buffer, and their total size
+  std::vector<char *> overflow_;
+  std::vector<size_t> overflow_bytes_;
+  size_t bytes_overflow_;
+
+  /// Statistics
+  int64_t bytes_high_;
+  int64_t bytes_highest_;
+  int64_t num_overflow_;
+
+  /// One ScratchArena per PE
+  static ScratchArena instance_[CONFIG_NODE_SIZE];
+};
+
+#endif /* MEMORY_SCRATCH_ARENA_HPP */
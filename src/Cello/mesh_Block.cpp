@@ -68,6 +68,10 @@ Block::Block ( process_type ip_source, MsgType msg_type )
     name_(""),
     index_method_(-1),
     index_solver_(),
+    method_time_(),
+    method_time_start_(-1.0),
+    refresh_bytes_sent_(0),
+    balance_migrating_(false),
     refresh_()
 {
 #ifdef TRACE_BLOCK
@@ -155,6 +159,10 @@ Block::Block ( MsgRefine * msg )
     name_(""),
     index_method_(-1),
     index_solver_(),
+    method_time_(),
+    method_time_start_(-1.0),
+    refresh_bytes_sent_(0),
+    balance_migrating_(false),
     refresh_()
 {
 #ifdef TRACE_BLOCK
@@ -393,6 +401,10 @@ void Block::pup(PUP::er &p)
   p | name_;
   p | index_method_;
   p | index_solver_;
+  p | method_time_;
+  p | method_time_start_;
+  p | refresh_bytes_sent_;
+  p | balance_migrating_;
   p | refresh_;
   // SKIP method_: initialized when needed
 
@@ -630,7 +642,7 @@ Block::~Block()
     thisProxy[index_parent].p_refresh_child(n,array,ic3);
     // --------------------------------------------------
 
-    delete [] array;
+    BufferPool::deallocate(array,n);
   }
 
   delete data_;
@@ -697,6 +709,10 @@ Block::Block ()
     name_(""),
     index_method_(-1),
     index_solver_(),
+    method_time_(),
+    method_time_start_(-1.0),
+    refresh_bytes_sent_(0),
+    balance_migrating_(false),
     refresh_()
 {
   init_refresh_();
@@ -734,6 +750,10 @@ Block::Block (CkMigrateMessage *m)
     name_(""),
     index_method_(-1),
     index_solver_(),
+    method_time_(),
+    method_time_start_(-1.0),
+    refresh_bytes_sent_(0),
+    balance_migrating_(false),
     refresh_()
 {
   init_refresh_();
@@ -819,6 +839,7 @@ void Block::init_refresh_()
   const int count = cello::simulation()->refresh_count();
   refresh_sync_list_.resize(count);
   refresh_msg_list_.resize(count);
+  refresh_local_list_.resize(count);
   for (int i=0; i<count; i++) {
     refresh_sync_list_[i].reset();
   }
@@ -1160,6 +1181,11 @@ void Block::performance_start_
   Simulation * simulation = cello::simulation();
   if (simulation)
     simulation->performance()->start_region(index_region,file,line);
+
+  // time local Method work for load balancing
+  if (index_region == perf_compute && method_time_start_ < 0.0) {
+    method_time_start_ = CmiWallTimer();
+  }
 }
 
 //----------------------------------------------------------------------
@@ -1170,6 +1196,14 @@ void Block::performance_stop_
   Simulation * simulation = cello::simulation();
   if (simulation)
     simulation->performance()->stop_region(index_region,file,line);
+
+  if (index_region == perf_compute && method_time_start_ >= 0.0) {
+    if (index_method_ >= int(method_time_.size())) {
+      method_time_.resize(index_method_+1,0.0);
+    }
+    method_time_[index_method_] += CmiWallTimer() - method_time_start_;
+    method_time_start_ = -1.0;
+  }
 }
 
 //----------------------------------------------------------------------
@@ -551,6 +551,11 @@ public:
   /// Receive a Refresh data message from an adjacent Block
   void p_refresh_recv (MsgRefresh * msg);
 
+  /// Complete a refresh operation whose final faces were copied
+  /// directly by Blocks on the same process
+  void p_refresh_check_done (int id_refresh)
+  { refresh_check_done(id_refresh); }
+
   int refresh_load_field_faces_ (Refresh & refresh);
   
   /// Scatter particles in ghost zones to neighbors
@@ -563,21 +568,27 @@ public:
   /// Send flux data to neighbors
   int refresh_load_flux_faces_ (Refresh & refresh);
 
+  /// Send field face data to the given neighbor, or append it to
+  /// the neighbor's message in msg_map if aggregating faces
   void refresh_load_field_face_
-  (Refresh & refresh, int refresh_type, Index index, int if3[3], int ic3[3]);
+  (Refresh & refresh, int refresh_type, Index index, int if3[3], int ic3[3],
+   std::map<Index,MsgRefresh *> * msg_map = nullptr);
   /// Send particles in list to corresponding indices
   void particle_send_(Refresh & refresh, int nl,Index index_list[],
                       ParticleData * particle_list[]);
   void refresh_load_flux_face_
   (Refresh & refresh, int refresh_type, Index index, int if3[3], int ic3[3]);
 
+  /// Send the refresh message to the given Block, recording its size
+  /// if needed for load balancing
+  void refresh_send_ (Index index, MsgRefresh * msg_refresh);
+
   void refresh_exit (Refresh & refresh);
 
   /// Get restricted data from child when it is deleted
   void p_refresh_child (int n, char a[],int ic3[3]);
 
   void p_method_flux_correct_refresh();
-  void r_method_flux_correct_sum_fields(CkReductionMsg * msg);
   void r_method_debug_sum_fields(CkReductionMsg * msg);
 
   void r_method_order_morton_continue(CkReductionMsg * msg);
@@ -606,6 +617,11 @@ protected:
   (Refresh refresh,  int refresh_type,
    Index index_neighbor, int if3[3],int ic3[3]);
 
+  /// Copy field face data directly to a neighbor Block on the same
+  /// process, or queue it if the neighbor is not yet ready
+  void refresh_local_face_
+  (Refresh & refresh, Block * block_neighbor, FieldFace * field_face);
+
   /// Send padded array of fields to neighbor for interpolations whose
   /// domains overlap multiple blocks
   void refresh_coarse_send_
@@ -702,6 +718,17 @@ public:
     stopping_load_balance_();
   }
 
+  /// Morton-order load balancing: gather Block costs in the root
+  /// Block, assign contiguous ranges of Blocks to processes, and
+  /// continue when all Blocks have migrated
+  void r_balance_morton_gather (CkReductionMsg * msg);
+  void p_balance_morton_assign (int n, int v3[]);
+  void r_balance_morton_done (CkReductionMsg * msg)
+  {
+    delete msg;
+    stopping_exit_();
+  }
+
   /// Exit the stopping phase
   void p_stopping_exit ()
   {
@@ -724,6 +751,15 @@ protected:
   void stopping_load_balance_();
   void stopping_exit_();
 
+  /// Contribute the Block's cost to the root Block for Morton-order
+  /// load balancing
+  void balance_morton_start_();
+
+  /// Return the Block's cost for load balancing: the time spent in
+  /// Methods plus the cost of refresh data sent since the last
+  /// load balancing step
+  double balance_cost_() const;
+
 public:
   /// Exit the stopping phase to exit
   void p_exit ()
@@ -799,6 +835,9 @@ public: // virtual functions
 
   void ResumeFromSync();
 
+  /// Continue Morton-order load balancing after migrating
+  virtual void ckJustMigrated();
+
   FieldFace * create_face
   (int if3[3], int ic3[3], int g3[3],
    int refresh_type,
@@ -1000,6 +1039,21 @@ protected: // attributes
   /// Stack of currently active solvers
   std::vector<int> index_solver_;
 
+  /// Wall time spent in each Method since the last load balancing
+  /// step, measured over perf_compute regions only so that time
+  /// waiting for refreshes and reductions is excluded
+  std::vector<double> method_time_;
+
+  /// Wall time at which the current perf_compute region was started,
+  /// or negative if not in one
+  double method_time_start_;
+
+  /// Bytes of refresh data sent since the last load balancing step
+  long long refresh_bytes_sent_;
+
+  /// Whether Block is migrating in a Morton-order load balancing step
+  bool balance_migrating_;
+
   /// Refresh object associated with current refresh operation
   /// (Not a pointer since must be one per Block for synchronization counters)
   std::vector<Refresh*> refresh_;
@@ -1007,6 +1061,12 @@ protected: // attributes
   std::vector < Sync > refresh_sync_list_;
   std::vector < std::vector <MsgRefresh * > > refresh_msg_list_;
 
+  /// Field faces from Blocks on the same process waiting to be
+  /// copied directly into this Block's ghost zones, with the
+  /// sending Block's FieldData
+  std::vector < std::vector < std::pair<FieldFace *,FieldData *> > >
+  refresh_local_list_;
+
 };
 
 #endif /* COMM_BLOCK_HPP */
@@ -66,10 +66,17 @@ CProxy_Block Factory::new_block_proxy
 
   CProxy_Block proxy_block;
 
-  CProxy_MappingArray array_map  = CProxy_MappingArray::ckNew(nbx,nby,nbz);
+  const std::string mapping = cello::config()->mesh_mapping;
 
   CkArrayOptions opts;
-  opts.setMap(array_map);
+  if (mapping == "array") {
+    CProxy_MappingArray array_map  = CProxy_MappingArray::ckNew(nbx,nby,nbz);
+    opts.setMap(array_map);
+  } else {
+    CProxy_MappingSfc sfc_map = CProxy_MappingSfc::ckNew
+      (nbx,nby,nbz,cello::rank(),mapping == "hilbert");
+    opts.setMap(sfc_map);
+  }
   proxy_block = CProxy_Block::ckNew(opts);
 
   return proxy_block;
@@ -40,6 +40,8 @@ Hierarchy::Hierarchy
   max_level_(max_level),
   num_blocks_(0),
   num_blocks_level_(),
+  block_vec_(),
+  block_map_(),
   num_particles_(0),
   num_zones_total_(0),
   num_zones_real_(0),
@@ -215,6 +217,35 @@ void Hierarchy::increment_block_count(int count, int level)
 
 //----------------------------------------------------------------------
 
+void Hierarchy::insert_block (Block * block)
+{
+  block_vec_.push_back(block);
+  block_map_[block->index()] = block;
+}
+
+//----------------------------------------------------------------------
+
+bool Hierarchy::delete_block (Block * block)
+{
+  const int n = block_vec_.size();
+  bool found = false;
+  for (int i=0; i<n; i++) {
+    if (found) block_vec_[i-1] = block_vec_[i];
+    if (block_vec_[i] == block) found=true;
+  }
+  if (found) block_vec_.resize(n-1);
+
+  // only remove from map if not already replaced by a newer Block
+  // with the same Index
+  auto it = block_map_.find(block->index());
+  if (it != block_map_.end() && it->second == block) {
+    block_map_.erase(it);
+  }
+  return found;
+}
+
+//----------------------------------------------------------------------
+
 void Hierarchy::increment_particle_count(int64_t count)
 {
   num_particles_ += count;
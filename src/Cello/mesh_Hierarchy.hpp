@@ -32,6 +32,7 @@ public: // interface
     num_blocks_(0),
     num_blocks_level_(),
     block_vec_(),
+    block_map_(),
     num_particles_(0), 
     num_zones_total_(0), 
     num_zones_real_(0), 
@@ -149,23 +150,18 @@ public: // interface
   void increment_block_count(int count, int level);
 
   /// Add Block to the list of blocks (block_vec_ and block_map_)
-  void insert_block (Block * block)
-  {
-    block_vec_.push_back(block);
-  }
+  void insert_block (Block * block);
   
-  /// Remove Block from the list of blocks (block_vec_) and return
-  /// true iff Block is found in the list
-  bool delete_block (Block * block)
+  /// Remove Block from the list of blocks (block_vec_ and
+  /// block_map_) and return true iff Block is found in the list
+  bool delete_block (Block * block);
+
+  /// Return the Block with the given Index if it is on this process,
+  /// or nullptr if it is not
+  Block * local_block (Index index) const
   {
-    const int n = block_vec_.size();
-    bool found = false;
-    for (int i=0; i<n; i++) {
-      if (found) block_vec_[i-1] = block_vec_[i];
-      if (block_vec_[i] == block) found=true;
-    }
-    if (found) block_vec_.resize(n-1);
-    return found;
+    auto it = block_map_.find(index);
+    return (it == block_map_.end()) ? nullptr : it->second;
   }
   
   /// Increment (decrement) number of particles
@@ -243,6 +239,9 @@ protected: // attributes
   /// Pointers to Blocks on this process
   std::vector<Block *> block_vec_;
 
+  /// Blocks on this process by Index (used for same-process refresh)
+  std::map<Index,Block *> block_map_;
+
   /// Current number of particles on this process
   int64_t num_particles_;
 
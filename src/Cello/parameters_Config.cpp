@@ -45,6 +45,8 @@ void Config::pup (PUP::er &p)
   // Balance
 
   p | balance_schedule_index;
+  p | balance_strategy;
+  p | balance_message_cost;
 
   // Boundary
 
@@ -85,6 +87,7 @@ void Config::pup (PUP::er &p)
 
   p | initial_restart;
   p | initial_restart_dir;
+  p | initial_restart_prefetch;
 
   p | initial_trace_name;
   p | initial_trace_field;
@@ -107,6 +110,9 @@ void Config::pup (PUP::er &p)
   p | mesh_min_level;
   p | mesh_max_level;
   p | mesh_max_initial_level;
+  p | mesh_refresh_aggregate;
+  p | mesh_refresh_local;
+  p | mesh_mapping;
 
   // Method
 
@@ -127,6 +133,7 @@ void Config::pup (PUP::er &p)
   p | method_flux_correct_enable;
   p | method_flux_correct_min_digits_fields;
   p | method_flux_correct_min_digits_values;
+  p | method_flux_correct_check_schedule_index;
   p | method_flux_correct_single_array;
   p | method_field_list;
   p | method_particle_list;
@@ -212,6 +219,8 @@ void Config::pup (PUP::er &p)
   p | performance_warnings;
   p | performance_on_schedule_index;
   p | performance_off_schedule_index;
+  p | performance_io_tokens;
+  p | performance_io_scope;
 
   // Physics
   
@@ -401,7 +410,25 @@ void Config::read_balance_ (Parameters * p) throw()
   } else {
     balance_schedule_index = -1;
   }
-  
+
+  // "charm" to use the Charm++ load balancer given on the command
+  // line, or "morton" to divide Blocks among processes along their
+  // Morton ordering, weighted by their measured costs
+
+  balance_strategy = p->value_string ("Balance:strategy","charm");
+
+  if (! (balance_strategy == "charm" ||
+         balance_strategy == "morton")) {
+    ERROR1 ("Config::read_balance_()",
+            "Unknown Balance:strategy \"%s\": must be "
+            "\"charm\" or \"morton\"",
+            balance_strategy.c_str());
+  }
+
+  // Cost in seconds per byte of refresh data received, added to the
+  // measured Method times for "morton" load balancing
+
+  balance_message_cost = p->value_float ("Balance:message_cost",0.0);
 }  
 
 //----------------------------------------------------------------------
@@ -666,6 +693,8 @@ void Config::read_initial_ (Parameters * p) throw()
 
   initial_restart      = p->value_logical ("Initial:restart",false);
   initial_restart_dir  = p->value_string  ("Initial:restart_dir","");
+  initial_restart_prefetch =
+    p->value_logical ("Initial:restart_prefetch",true);
 
   // InitialTrace
   initial_trace_name = p->value_string ("Initial:trace:name","trace");
@@ -742,6 +771,31 @@ void Config::read_mesh_ (Parameters * p) throw()
 		    mesh_min_level);
   }
 
+  // Whether to combine ghost zone faces sent to the same neighbor
+  // Block into a single refresh message
+
+  mesh_refresh_aggregate = p->value_logical("Mesh:refresh_aggregate",false);
+
+  // Whether to copy ghost zone faces directly between Blocks on the
+  // same process instead of sending refresh messages
+
+  mesh_refresh_local = p->value_logical("Mesh:refresh_local",false);
+
+  // How to map Blocks to processes when they are created: "array"
+  // by root-level Block index, or "morton" or "hilbert" along a
+  // space-filling curve through each refinement level
+
+  mesh_mapping = p->value_string("Mesh:mapping","array");
+
+  if (! (mesh_mapping == "array" ||
+         mesh_mapping == "morton" ||
+         mesh_mapping == "hilbert")) {
+    ERROR1 ("Config::read_mesh_()",
+            "Unknown Mesh:mapping \"%s\": must be "
+            "\"array\", \"morton\", or \"hilbert\"",
+            mesh_mapping.c_str());
+  }
+
   // Handle 1D and 2D simulations by adjusting the number of cells along the extra dimensions
   if (mesh_root_rank < 2) mesh_root_size[1] = 1;
   if (mesh_root_rank < 3) mesh_root_size[2] = 1;
@@ -796,6 +850,7 @@ void Config::read_method_ (Parameters * p) throw()
   method_flux_correct_enable.resize(num_method);
   method_flux_correct_min_digits_fields.resize(num_method);
   method_flux_correct_min_digits_values.resize(num_method);
+  method_flux_correct_check_schedule_index.resize(num_method);
   method_field_list.resize(num_method);
   method_particle_list.resize(num_method);
   method_output_blocking[0].resize(num_method);
@@ -915,6 +970,18 @@ void Config::read_method_ (Parameters * p) throw()
       ERROR1("Config::read", "%s has an invalid type", min_digits_name.c_str());
     }
 
+    // Read schedule for checking conserved field sums if any
+    if (p->type(full_name + ":check_schedule:var") != parameter_unknown) {
+      p->group_set(0,"Method");
+      p->group_push(name);
+      p->group_push("check_schedule");
+      method_flux_correct_check_schedule_index[index_method] =
+        read_schedule_(p, name + ":check_schedule");
+      p->group_clear();
+    } else {
+      method_flux_correct_check_schedule_index[index_method] = -1;
+    }
+
     method_flux_correct_single_array =
       p->value_logical (full_name + ":single_array",true);
 
@@ -1399,6 +1466,9 @@ void Config::read_performance_ (Parameters * p) throw()
 
   performance_warnings = p->value_logical("Performance:warnings",false);
 
+  performance_io_tokens = p->value_integer("Performance:io:tokens",0);
+  performance_io_scope  = p->value_string ("Performance:io:scope","global");
+
 #ifdef CONFIG_USE_PROJECTIONS
   
   int i_on = -1;
@@ -39,6 +39,8 @@ public: // interface
     adapt_output(),
     adapt_schedule_index(),
     balance_schedule_index(0),
+    balance_strategy("charm"),
+    balance_message_cost(0.0),
     num_boundary(0),
     boundary_list(),
     boundary_type(),
@@ -62,6 +64,7 @@ public: // interface
     initial_time(0.0),
     initial_restart(false),
     initial_restart_dir(""),
+    initial_restart_prefetch(true),
     initial_trace_name(""),
     initial_trace_field(""),
     initial_trace_mpp(0.0),
@@ -75,6 +78,9 @@ public: // interface
     mesh_min_level(0),
     mesh_max_level(0),
     mesh_max_initial_level(0),
+    mesh_refresh_aggregate(false),
+    mesh_refresh_local(false),
+    mesh_mapping("array"),
     num_method(0),
     method_courant_global(1.0),
     method_list(),
@@ -92,6 +98,7 @@ public: // interface
     method_flux_correct_enable(),
     method_flux_correct_min_digits_fields(),
     method_flux_correct_min_digits_values(),
+    method_flux_correct_check_schedule_index(),
     method_flux_correct_single_array(true),
     method_field_list(),
     method_particle_list(),
@@ -161,6 +168,8 @@ public: // interface
     performance_warnings(false),
     performance_on_schedule_index(-1),
     performance_off_schedule_index(-1),
+    performance_io_tokens(0),
+    performance_io_scope("global"),
     num_physics(0),
     physics_list(),
     num_solvers(),
@@ -214,6 +223,8 @@ public: // interface
       adapt_output(),
       adapt_schedule_index(),
       balance_schedule_index(-1),
+      balance_strategy("charm"),
+      balance_message_cost(0.0),
       num_boundary(0),
       boundary_list(),
       boundary_type(),
@@ -237,6 +248,7 @@ public: // interface
       initial_time(0.0),
       initial_restart(false),
       initial_restart_dir(""),
+      initial_restart_prefetch(true),
       initial_trace_name(""),
       initial_trace_field(""),
       initial_trace_mpp(0.0),
@@ -250,6 +262,9 @@ public: // interface
       mesh_min_level(0),
       mesh_max_level(0),
       mesh_max_initial_level(0),
+      mesh_refresh_aggregate(false),
+      mesh_refresh_local(false),
+      mesh_mapping("array"),
       num_method(0),
       method_courant_global(1.0),
       method_list(),
@@ -267,6 +282,7 @@ public: // interface
       method_flux_correct_enable(),
       method_flux_correct_min_digits_fields(),
       method_flux_correct_min_digits_values(),
+      method_flux_correct_check_schedule_index(),
       method_flux_correct_single_array(true),
       method_field_list(),
       method_particle_list(),
@@ -335,6 +351,8 @@ public: // interface
       performance_warnings(false),
       performance_on_schedule_index(-1),
       performance_off_schedule_index(-1),
+      performance_io_tokens(0),
+      performance_io_scope("global"),
       num_physics(0),
       physics_list(),
       num_solvers(),
@@ -406,6 +424,8 @@ public: // attributes
   // Balance (dynamic load balancing)
 
   int                        balance_schedule_index;
+  std::string                balance_strategy;
+  double                     balance_message_cost;
 
   // Boundary
 
@@ -448,6 +468,7 @@ public: // attributes
   /// restart
   bool                       initial_restart;
   std::string                initial_restart_dir;
+  bool                       initial_restart_prefetch;
 
   // InitialTrace
   std::string                initial_trace_name;
@@ -471,6 +492,9 @@ public: // attributes
   int                        mesh_min_level;
   int                        mesh_max_level;
   int                        mesh_max_initial_level;
+  bool                       mesh_refresh_aggregate;
+  bool                       mesh_refresh_local;
+  std::string                mesh_mapping;
 
   // Method
 
@@ -495,6 +519,7 @@ public: // attributes
   std::vector<bool>          method_flux_correct_enable;
   std::vector<std::vector<std::string>> method_flux_correct_min_digits_fields;
   std::vector<std::vector<double>> method_flux_correct_min_digits_values;
+  std::vector<int>           method_flux_correct_check_schedule_index;
   bool                       method_flux_correct_single_array;
 
   std::vector< std::vector< std::string > > method_field_list;
@@ -585,6 +610,8 @@ public: // attributes
   bool                       performance_warnings;
   int                        performance_on_schedule_index;
   int                        performance_off_schedule_index;
+  int                        performance_io_tokens;
+  std::string                performance_io_scope;
 
   // Physics
   
@@ -0,0 +1,455 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     parameters_ExprProgram.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Implementation of the ExprProgram class
+///
+/// This file must not include any other part of Cello except parse.h, so
+/// that it can be used by stand-alone programs.
+
+#include <math.h>
+#include <stdio.h>
+
+#include <algorithm>
+
+#include "parse.h"
+#include "parameters_ExprProgram.hpp"
+
+const int ExprProgram::chunk_size;
+
+//----------------------------------------------------------------------
+
+namespace {
+
+  /// Apply a binary operation.  Operands that don't vary hold a single
+  /// value.
+  template <class F>
+  inline void apply_ (int n, double * r,
+                      const double * a, bool va,
+                      const double * b, bool vb, F f)
+  {
+    if (va && vb) {
+      for (int i=0; i<n; i++) r[i] = f(a[i],b[i]);
+    } else if (va) {
+      const double bs = b[0];
+      for (int i=0; i<n; i++) r[i] = f(a[i],bs);
+    } else if (vb) {
+      const double as = a[0];
+      for (int i=0; i<n; i++) r[i] = f(as,b[i]);
+    } else {
+      r[0] = f(a[0],b[0]);
+    }
+  }
+
+  /// Apply an operation to two constants, used for constant folding.
+  /// Must match the operations in ExprProgram::evaluate_chunk_()
+  double fold_ (int op, double a, double b)
+  {
+    switch (op) {
+    case enum_op_add: return a + b;
+    case enum_op_sub: return a - b;
+    case enum_op_mul: return a * b;
+    case enum_op_div: return a / b;
+    case enum_op_pow: return pow(a,b);
+    case enum_op_le:  return (a <= b) ? 1.0 : 0.0;
+    case enum_op_lt:  return (a <  b) ? 1.0 : 0.0;
+    case enum_op_ge:  return (a >= b) ? 1.0 : 0.0;
+    case enum_op_gt:  return (a >  b) ? 1.0 : 0.0;
+    case enum_op_eq:  return (a == b) ? 1.0 : 0.0;
+    case enum_op_ne:  return (a != b) ? 1.0 : 0.0;
+    case enum_op_and: return (a != 0.0 && b != 0.0) ? 1.0 : 0.0;
+    case enum_op_or:  return (a != 0.0 || b != 0.0) ? 1.0 : 0.0;
+    }
+    return 0.0;
+  }
+
+}
+
+//----------------------------------------------------------------------
+
+bool ExprProgram::compile
+(const struct node_expr * node, bool logical, std::string * error)
+{
+  code_.clear();
+  free_registers_.clear();
+  num_registers_ = 0;
+  result_ = -1;
+  logical_ = logical;
+
+  Operand operand;
+  if (! compile_(node,logical,&operand,error)) {
+    code_.clear();
+    return false;
+  }
+  result_ = to_register_(operand);
+  free_registers_.clear();
+  return true;
+}
+
+//----------------------------------------------------------------------
+
+bool ExprProgram::compile_
+(const struct node_expr * node, bool logical,
+ Operand * operand, std::string * error)
+{
+  char buffer[80];
+
+  if (node == NULL) {
+    *error = "missing subexpression";
+    return false;
+  }
+
+  operand->reg = -1;
+  operand->depends = 0;
+  operand->value = 0.0;
+
+  switch (node->type) {
+
+  case enum_node_operation: {
+    const int op = node->op_value;
+    const bool is_logical_op = (op == enum_op_and || op == enum_op_or);
+    const bool is_compare_op = (enum_op_le <= op && op <= enum_op_ne);
+    const bool is_float_op   = (enum_op_add <= op && op <= enum_op_pow);
+    if (! logical && ! is_float_op) {
+      snprintf (buffer,sizeof(buffer),
+                "logical operator %d in floating-point expression",op);
+      *error = buffer;
+      return false;
+    }
+    if (logical && is_float_op) {
+      snprintf (buffer,sizeof(buffer),
+                "floating-point operator %d in logical expression",op);
+      *error = buffer;
+      return false;
+    }
+    if (! (is_logical_op || is_compare_op || is_float_op)) {
+      snprintf (buffer,sizeof(buffer),"unknown operator %d",op);
+      *error = buffer;
+      return false;
+    }
+    // operands of "&&" and "||" are logical; all others are
+    // floating-point
+    Operand left, right;
+    if (! compile_(node->left, is_logical_op,&left, error)) return false;
+    if (! compile_(node->right,is_logical_op,&right,error)) return false;
+    if (left.depends == 0 && right.depends == 0) {
+      operand->value = fold_(op,left.value,right.value);
+      return true;
+    }
+    const int a = to_register_(left);
+    const int b = to_register_(right);
+    release_register_(a);
+    release_register_(b);
+    Instruction instruction;
+    instruction.a = a;
+    instruction.b = b;
+    instruction.depends = left.depends | right.depends;
+    instruction.value = 0.0;
+    instruction.function = NULL;
+    switch (op) {
+    case enum_op_add: instruction.op = op_add; break;
+    case enum_op_sub: instruction.op = op_sub; break;
+    case enum_op_mul: instruction.op = op_mul; break;
+    case enum_op_div: instruction.op = op_div; break;
+    case enum_op_pow: instruction.op = op_pow; break;
+    case enum_op_le:  instruction.op = op_le;  break;
+    case enum_op_lt:  instruction.op = op_lt;  break;
+    case enum_op_ge:  instruction.op = op_ge;  break;
+    case enum_op_gt:  instruction.op = op_gt;  break;
+    case enum_op_eq:  instruction.op = op_eq;  break;
+    case enum_op_ne:  instruction.op = op_ne;  break;
+    case enum_op_and: instruction.op = op_and; break;
+    case enum_op_or:  instruction.op = op_or;  break;
+    }
+    instruction.dst = allocate_register_();
+    code_.push_back(instruction);
+    operand->reg = instruction.dst;
+    operand->depends = instruction.depends;
+    return true;
+  }
+
+  case enum_node_float:
+    operand->value = node->float_value;
+    return true;
+
+  case enum_node_integer:
+    operand->value = double(node->integer_value);
+    return true;
+
+  case enum_node_variable: {
+    Instruction instruction;
+    instruction.a = instruction.b = -1;
+    instruction.value = 0.0;
+    instruction.function = NULL;
+    switch (node->var_value) {
+    case 'x': instruction.op = op_x; instruction.depends = depends_x; break;
+    case 'y': instruction.op = op_y; instruction.depends = depends_y; break;
+    case 'z': instruction.op = op_z; instruction.depends = depends_z; break;
+    case 't': instruction.op = op_t; instruction.depends = depends_t; break;
+    default:
+      snprintf (buffer,sizeof(buffer),
+                "unknown variable %c in expression",node->var_value);
+      *error = buffer;
+      return false;
+    }
+    instruction.dst = allocate_register_();
+    code_.push_back(instruction);
+    operand->reg = instruction.dst;
+    operand->depends = instruction.depends;
+    return true;
+  }
+
+  case enum_node_function: {
+    if (node->fun_value == NULL) {
+      *error = "function is NULL";
+      return false;
+    }
+    Operand argument;
+    if (! compile_(node->left,false,&argument,error)) return false;
+    if (argument.depends == 0) {
+      operand->value = (*(node->fun_value))(argument.value);
+      return true;
+    }
+    Instruction instruction;
+    instruction.op = op_function;
+    instruction.a = argument.reg;
+    instruction.b = -1;
+    instruction.depends = argument.depends;
+    instruction.value = 0.0;
+    instruction.function = node->fun_value;
+    release_register_(argument.reg);
+    instruction.dst = allocate_register_();
+    code_.push_back(instruction);
+    operand->reg = instruction.dst;
+    operand->depends = instruction.depends;
+    return true;
+  }
+
+  default:
+    snprintf (buffer,sizeof(buffer),"unknown expression type %d",node->type);
+    *error = buffer;
+    return false;
+  }
+}
+
+//----------------------------------------------------------------------
+
+int ExprProgram::to_register_ (const Operand & operand)
+{
+  if (operand.reg >= 0) return operand.reg;
+  Instruction instruction;
+  instruction.op = op_const;
+  instruction.a = instruction.b = -1;
+  instruction.depends = 0;
+  instruction.value = operand.value;
+  instruction.function = NULL;
+  instruction.dst = allocate_register_();
+  code_.push_back(instruction);
+  return instruction.dst;
+}
+
+//----------------------------------------------------------------------
+
+int ExprProgram::allocate_register_ ()
+{
+  if (free_registers_.empty()) return num_registers_++;
+  const int reg = free_registers_.back();
+  free_registers_.pop_back();
+  return reg;
+}
+
+//----------------------------------------------------------------------
+
+void ExprProgram::release_register_ (int reg)
+{
+  free_registers_.push_back(reg);
+}
+
+//----------------------------------------------------------------------
+
+const double * ExprProgram::evaluate_chunk_
+(int n, int varying,
+ const double * x, const double * y, const double * z, double t,
+ double * registers, const double ** reg, char * is_varying,
+ bool * result_varying) const
+{
+  static const double zero = 0.0;
+
+  for (size_t k=0; k<code_.size(); k++) {
+    const Instruction & in = code_[k];
+    double * r = registers + in.dst*n;
+    const double * a = (in.a >= 0) ? reg[in.a] : NULL;
+    const double * b = (in.b >= 0) ? reg[in.b] : NULL;
+    const bool va = (in.a >= 0) && is_varying[in.a];
+    const bool vb = (in.b >= 0) && is_varying[in.b];
+    const bool v  = va || vb;
+    const int  m  = v ? n : 1;
+    switch (in.op) {
+    case op_const:
+      r[0] = in.value;
+      break;
+    case op_x:
+      reg[in.dst] = x ? x : &zero;
+      is_varying[in.dst] = (x != NULL) && (varying & depends_x);
+      continue;
+    case op_y:
+      reg[in.dst] = y ? y : &zero;
+      is_varying[in.dst] = (y != NULL) && (varying & depends_y);
+      continue;
+    case op_z:
+      reg[in.dst] = z ? z : &zero;
+      is_varying[in.dst] = (z != NULL) && (varying & depends_z);
+      continue;
+    case op_t:
+      r[0] = t;
+      break;
+    case op_add:
+      apply_(n,r,a,va,b,vb,[](double p, double q) { return p + q; });
+      break;
+    case op_sub:
+      apply_(n,r,a,va,b,vb,[](double p, double q) { return p - q; });
+      break;
+    case op_mul:
+      apply_(n,r,a,va,b,vb,[](double p, double q) { return p * q; });
+      break;
+    case op_div:
+      apply_(n,r,a,va,b,vb,[](double p, double q) { return p / q; });
+      break;
+    case op_pow:
+      apply_(n,r,a,va,b,vb,[](double p, double q) { return pow(p,q); });
+      break;
+    case op_le:
+      apply_(n,r,a,va,b,vb,
+             [](double p, double q) { return (p <= q) ? 1.0 : 0.0; });
+      break;
+    case op_lt:
+      apply_(n,r,a,va,b,vb,
+             [](double p, double q) { return (p <  q) ? 1.0 : 0.0; });
+      break;
+    case op_ge:
+      apply_(n,r,a,va,b,vb,
+             [](double p, double q) { return (p >= q) ? 1.0 : 0.0; });
+      break;
+    case op_gt:
+      apply_(n,r,a,va,b,vb,
+             [](double p, double q) { return (p >  q) ? 1.0 : 0.0; });
+      break;
+    case op_eq:
+      apply_(n,r,a,va,b,vb,
+             [](double p, double q) { return (p == q) ? 1.0 : 0.0; });
+      break;
+    case op_ne:
+      apply_(n,r,a,va,b,vb,
+             [](double p, double q) { return (p != q) ? 1.0 : 0.0; });
+      break;
+    case op_and:
+      apply_(n,r,a,va,b,vb,[](double p, double q)
+             { return (p != 0.0 && q != 0.0) ? 1.0 : 0.0; });
+      break;
+    case op_or:
+      apply_(n,r,a,va,b,vb,[](double p, double q)
+             { return (p != 0.0 || q != 0.0) ? 1.0 : 0.0; });
+      break;
+    case op_function:
+      for (int i=0; i<m; i++) r[i] = (*in.function)(a[i]);
+      break;
+    }
+    reg[in.dst] = r;
+    is_varying[in.dst] = v;
+  }
+  *result_varying = is_varying[result_];
+  return reg[result_];
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void ExprProgram::evaluate
+(int n, T * result,
+ const double * x, const double * y, const double * z, double t) const
+{
+  // registers only need to be as long as the longest chunk
+  const int length = std::min(chunk_size, n);
+  std::vector<double> registers (num_registers_*length);
+  std::vector<const double *> reg (num_registers_);
+  std::vector<char> is_varying (num_registers_);
+  const int varying = depends_x | depends_y | depends_z;
+
+  for (int i0=0; i0<n; i0+=chunk_size) {
+    const int m = std::min(chunk_size, n - i0);
+    bool v;
+    const double * r = evaluate_chunk_
+      (m, varying, x ? x+i0 : NULL, y ? y+i0 : NULL, z ? z+i0 : NULL, t,
+       registers.data(), reg.data(), is_varying.data(), &v);
+    T * result_chunk = result + i0;
+    if (v) {
+      for (int i=0; i<m; i++) result_chunk[i] = (T) r[i];
+    } else {
+      const T value = (T) r[0];
+      for (int i=0; i<m; i++) result_chunk[i] = value;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void ExprProgram::evaluate_grid
+(T * result, int ndx, int ndy, double t,
+ int nx, const double * x,
+ int ny, const double * y,
+ int nz, const double * z) const
+{
+  std::vector<double> registers (num_registers_*chunk_size);
+  std::vector<const double *> reg (num_registers_);
+  std::vector<char> is_varying (num_registers_);
+
+  // only x varies along a row
+  const int varying = depends_x;
+
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      T * result_row = result + ndx*(iy + ndy*iz);
+      for (int ix0=0; ix0<nx; ix0+=chunk_size) {
+        const int m = std::min(chunk_size, nx - ix0);
+        bool v;
+        const double * r = evaluate_chunk_
+          (m, varying, x ? x+ix0 : NULL, y ? y+iy : NULL, z ? z+iz : NULL,
+           t, registers.data(), reg.data(), is_varying.data(), &v);
+        T * result_chunk = result_row + ix0;
+        if (v) {
+          for (int i=0; i<m; i++) result_chunk[i] = (T) r[i];
+        } else {
+          const T value = (T) r[0];
+          for (int i=0; i<m; i++) result_chunk[i] = value;
+        }
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+template void ExprProgram::evaluate
+(int, float *, const double *, const double *, const double *, double) const;
+template void ExprProgram::evaluate
+(int, double *, const double *, const double *, const double *, double) const;
+template void ExprProgram::evaluate
+(int, long double *, const double *, const double *, const double *,
+ double) const;
+template void ExprProgram::evaluate
+(int, bool *, const double *, const double *, const double *, double) const;
+
+template void ExprProgram::evaluate_grid
+(float *, int, int, double, int, const double *,
+ int, const double *, int, const double *) const;
+template void ExprProgram::evaluate_grid
+(double *, int, int, double, int, const double *,
+ int, const double *, int, const double *) const;
+template void ExprProgram::evaluate_grid
+(long double *, int, int, double, int, const double *,
+ int, const double *, int, const double *) const;
+template void ExprProgram::evaluate_grid
+(bool *, int, int, double, int, const double *,
+ int, const double *, int, const double *) const;
@@ -0,0 +1,160 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     parameters_ExprProgram.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Parameters] Declaration of the ExprProgram class
+
+#ifndef PARAMETERS_EXPR_PROGRAM_HPP
+#define PARAMETERS_EXPR_PROGRAM_HPP
+
+#include <string>
+#include <vector>
+
+struct node_expr;
+
+class ExprProgram {
+
+  /// @class    ExprProgram
+  /// @ingroup  Parameters
+  /// @brief    [\ref Parameters] Floating-point or logical parameter
+  /// expression compiled into a flat list of instructions
+  ///
+  /// An expression tree is compiled once, with constant subexpressions
+  /// folded, into instructions that each apply one operation to a chunk
+  /// of points.  Each instruction loop is a simple vectorizable loop, so
+  /// the cost of interpreting the instructions is shared by all points in
+  /// the chunk.  Values that are the same for every point of a chunk
+  /// (constants, t, and y and z along a grid row) are only computed once
+  /// per chunk.  Logical values are represented as 1.0 (true) and 0.0
+  /// (false).
+  ///
+  /// This class doesn't depend on any other part of Cello.
+
+public: // interface
+
+  /// Maximum number of points evaluated at a time
+  static const int chunk_size = 256;
+
+  /// Create an empty program
+  ExprProgram() throw()
+    : code_(),
+      num_registers_(0),
+      result_(-1),
+      logical_(false)
+  { }
+
+  /// Compile an expression tree.  Returns false and sets error if the
+  /// expression is invalid, e.g. if a logical operator appears in a
+  /// floating-point expression.
+  bool compile (const struct node_expr * node, bool logical,
+                std::string * error);
+
+  /// Whether the program holds a compiled expression
+  bool is_compiled () const { return result_ >= 0; }
+
+  /// Whether the expression is logical rather than floating-point
+  bool is_logical () const { return logical_; }
+
+  /// Number of instructions
+  int num_instructions () const { return code_.size(); }
+
+  /// Evaluate the expression at the n points (x[i],y[i],z[i]) at time t.
+  /// Any of x, y, z may be NULL, in which case the coordinate is 0.
+  template <class T>
+  void evaluate (int n, T * result,
+                 const double * x, const double * y, const double * z,
+                 double t) const;
+
+  /// Evaluate the expression at the points of the grid defined by the
+  /// coordinate vectors x[nx], y[ny], z[nz] at time t.  The value at
+  /// (x[ix],y[iy],z[iz]) is stored in result[ix + ndx*(iy + ndy*iz)].
+  template <class T>
+  void evaluate_grid (T * result, int ndx, int ndy, double t,
+                      int nx, const double * x,
+                      int ny, const double * y,
+                      int nz, const double * z) const;
+
+private: // types
+
+  /// Operations
+  enum op_type {
+    op_const,
+    op_x, op_y, op_z, op_t,
+    op_add, op_sub, op_mul, op_div, op_pow,
+    op_le, op_lt, op_ge, op_gt, op_eq, op_ne,
+    op_and, op_or,
+    op_function
+  };
+
+  /// Variables an instruction depends on
+  enum {
+    depends_x = 1,
+    depends_y = 2,
+    depends_z = 4,
+    depends_t = 8
+  };
+
+  /// A single instruction: register `dst` = `a` op `b`
+  struct Instruction {
+    int op;
+    int dst, a, b;
+    int depends;
+    double value;
+    double (*function) (double);
+  };
+
+  /// Result of compiling a subexpression: either a register or a
+  /// constant value
+  struct Operand {
+    int reg;
+    int depends;
+    double value;
+  };
+
+private: // functions
+
+  /// Compile a subexpression (recursive)
+  bool compile_ (const struct node_expr * node, bool logical,
+                 Operand * operand, std::string * error);
+
+  /// Make sure the operand is held in a register
+  int to_register_ (const Operand & operand);
+
+  /// Register allocation
+  int allocate_register_ ();
+  void release_register_ (int reg);
+
+  /// Evaluate the program for one chunk of n points.  Instructions whose
+  /// dependencies intersect `varying` are evaluated for all n points; the
+  /// others for a single point.  Register i is stored at
+  /// registers[i*n].  Returns the result register, and sets
+  /// `*result_varying` to whether it holds n values or 1.
+  const double * evaluate_chunk_ (int n, int varying,
+                                  const double * x, const double * y,
+                                  const double * z, double t,
+                                  double * registers,
+                                  const double ** reg,
+                                  char * is_varying,
+                                  bool * result_varying) const;
+
+private: // attributes
+
+  /// Instructions in evaluation order
+  std::vector<Instruction> code_;
+
+  /// Free registers during compilation
+  std::vector<int> free_registers_;
+
+  /// Number of registers required
+  int num_registers_;
+
+  /// Register holding the result, or -1 if not compiled
+  int result_;
+
+  /// Whether the expression is logical
+  bool logical_;
+
+};
+
+#endif /* PARAMETERS_EXPR_PROGRAM_HPP */
@@ -58,7 +58,8 @@ public: // interface
   /// Initialize a Param object
   Param () 
     : type_(parameter_unknown),
-      value_accessed_(false)
+      value_accessed_(false),
+      program_(NULL)
   {};
 
   /// Delete a Param object
@@ -68,7 +69,8 @@ public: // interface
   /// Copy constructor
   Param(const Param & param) throw()
     : type_(parameter_unknown),
-      value_accessed_(false)
+      value_accessed_(false),
+      program_(NULL)
   { INCOMPLETE("Param::Param"); };
 
   /// Assignment operator
@@ -79,25 +81,26 @@ public: // interface
   /// CHARM++ Pack / Unpack function
   void pup (PUP::er &p);
 
-  /// Evaluate a floating-point expression given vectos x,y,z,t
+  /// Evaluate a floating-point expression given vectors x,y,z,t
   void evaluate_float  
   ( int                n, 
     double *           result, 
     double *           x, 
     double *           y, 
     double *           z, 
-    double             t,
-    struct node_expr * node = 0 );
+    double             t);
 
-  /// Evaluate a logical expression given vectos x,y,z,t
+  /// Evaluate a logical expression given vectors x,y,z,t
   void evaluate_logical  
   ( int                n, 
     bool *             result, 
     double *           x, 
     double *           y, 
     double *           z, 
-    double             t,
-    struct node_expr * node = 0);
+    double             t);
+
+  /// Return the compiled floating-point or logical expression
+  const ExprProgram * program ();
 
   /// Set the parameter type and value
   void set(struct param_struct * param);
@@ -194,6 +197,7 @@ private: // functions
   { 
     type_ = parameter_float_expr;
     value_expr_     = value; 
+    compile_program_();
   };
 
   /// Set a logical expression parameter
@@ -201,8 +205,14 @@ private: // functions
   { 
     type_ = parameter_logical_expr;
     value_expr_     = value; 
+    compile_program_();
   };
 
+  /// Compile the expression value_expr_ into program_.  Done when the
+  /// parameter is set rather than on first use, since Blocks on
+  /// different threads of a process may evaluate it concurrently
+  void compile_program_();
+
   /// Deallocate the parameter
   void dealloc_();
 
@@ -241,6 +251,9 @@ private: // attributes
     struct node_expr * value_expr_;
   };
 
+  /// Compiled value_expr_ for expression parameters, or NULL
+  ExprProgram * program_;
+
 };
 
 //----------------------------------------------------------------------
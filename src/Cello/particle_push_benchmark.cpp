@@ -0,0 +1,217 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     particle_push_benchmark.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Throughput benchmark for the particle kick-drift-kick update
+///
+/// usage: particle_push_benchmark [num_particles [batch_size [repeats]]]
+///
+/// Applies the kick-drift-kick update of EnzoMethodPmUpdate to 3D
+/// particles stored in batches of batch_size particles, with three
+/// layouts of the position, velocity and acceleration attributes:
+///
+/// - interleaved: the attributes of a particle are adjacent, and are
+///   accessed with runtime strides
+/// - strided:     each attribute is contiguous within a batch, but is
+///   accessed with runtime strides (as before ParticleSpan was
+///   introduced)
+/// - span:        each attribute is contiguous and aligned within a
+///   batch, and is accessed through a ParticleSpan
+///
+/// It reports the throughput in particles per second and the speedup
+/// over the strided loops, and exits with status 1 if the layouts don't
+/// give identical results.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "data_ParticleSpan.hpp"
+
+typedef double real;
+
+enum { num_attributes = 9 }; // x,y,z, vx,vy,vz, ax,ay,az
+
+//----------------------------------------------------------------------
+
+/// Batches of particles, with attribute ia of particle ip of batch ib
+/// at batch(ib) + ia*attribute_stride + ip*particle_stride
+struct Batches {
+
+  Batches (int num_particles, int batch_size, bool interleaved, int pad)
+    : num_particles(num_particles), batch_size(batch_size),
+      num_batches((num_particles + batch_size - 1) / batch_size),
+      attribute_stride(interleaved ? 1 : batch_size + pad),
+      particle_stride(interleaved ? num_attributes : 1),
+      batch_stride(num_attributes * (interleaved ? batch_size
+                                                 : batch_size + pad)),
+      buffer(num_batches*batch_stride*sizeof(real) + PARTICLE_ALIGN - 1)
+  {
+    for (int ia=0; ia<num_attributes; ia++) stride_[ia] = particle_stride;
+    const uintptr_t defect = (uintptr_t)(buffer.data()) % PARTICLE_ALIGN;
+    start = (real *)(buffer.data() + (defect ? PARTICLE_ALIGN - defect : 0));
+  }
+
+  int np (int ib) const
+  { return std::min(batch_size, num_particles - ib*batch_size); }
+
+  real * attribute (int ib, int ia)
+  { return start + ib*batch_stride + ia*attribute_stride; }
+
+  /// Stride of the given attribute, which (as with
+  /// ParticleDescr::stride()) the compiler can't see is the same for all
+  /// attributes
+  __attribute__((noinline)) int stride (int ia) const
+  { return stride_[ia]; }
+
+  real & value (int ip_global, int ia)
+  {
+    const int ib = ip_global / batch_size;
+    const int ip = ip_global % batch_size;
+    return attribute(ib,ia)[ip*particle_stride];
+  }
+
+  int num_particles, batch_size, num_batches;
+  int attribute_stride, particle_stride, batch_stride;
+  int stride_[num_attributes];
+  std::vector<char> buffer;
+  real * start;
+};
+
+//----------------------------------------------------------------------
+
+/// Update with runtime strides, as in EnzoMethodPmUpdate before
+/// ParticleSpan
+__attribute__((noinline))
+static void push_strided (Batches & p, int rank,
+                          real cp, real cvv, real cva)
+{
+  for (int ib=0; ib<p.num_batches; ib++) {
+    const int np = p.np(ib);
+    for (int axis=0; axis<rank; axis++) {
+      const int dp = p.stride(axis);
+      const int dv = p.stride(axis+3);
+      const int da = p.stride(axis+6);
+      real * x = p.attribute(ib,axis);
+      real * v = p.attribute(ib,axis+3);
+      real * a = p.attribute(ib,axis+6);
+      for (int ip=0; ip<np; ip++) {
+        const int ipdv = ip*dv;
+        const int ipdp = ip*dp;
+        const int ipda = ip*da;
+        v[ipdv] = cvv*v[ipdv] + cva*a[ipda];
+        x[ipdp] += cp*v[ipdv];
+        v[ipdv] = cvv*v[ipdv] + cva*a[ipda];
+      }
+    }
+  }
+}
+
+/// Update through ParticleSpan, as in EnzoMethodPmUpdate
+__attribute__((noinline))
+static void push_span (Batches & p, int rank,
+                       real cp, real cvv, real cva)
+{
+  for (int ib=0; ib<p.num_batches; ib++) {
+    const int np = p.np(ib);
+    for (int axis=0; axis<rank; axis++) {
+      real * x = ParticleSpan<real>(p.attribute(ib,axis),  np).data();
+      real * v = ParticleSpan<real>(p.attribute(ib,axis+3),np).data();
+      const real * a = ParticleSpan<real>(p.attribute(ib,axis+6),np).data();
+      #pragma omp simd
+      for (int ip=0; ip<np; ip++) {
+        v[ip] = cvv*v[ip] + cva*a[ip];
+        x[ip] += cp*v[ip];
+        v[ip] = cvv*v[ip] + cva*a[ip];
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+static void initialize (Batches & p)
+{
+  unsigned long long state = 12345;
+  for (int i=0; i<p.num_particles; i++) {
+    for (int ia=0; ia<num_attributes; ia++) {
+      state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+      p.value(i,ia) = (state >> 11) * (1.0 / 9007199254740992.0) - 0.5;
+    }
+  }
+}
+
+static bool same (Batches & a, Batches & b)
+{
+  for (int i=0; i<a.num_particles; i++) {
+    for (int ia=0; ia<num_attributes; ia++) {
+      if (a.value(i,ia) != b.value(i,ia)) return false;
+    }
+  }
+  return true;
+}
+
+typedef void (*push_function) (Batches &, int, real, real, real);
+
+static double time_push (push_function push, Batches & p, int repeats)
+{
+  const real dt = 1e-3, cosmo_a = 1.0, cosmo_dadt = 0.0;
+  const real cp = dt/cosmo_a;
+  const real coef = 0.25*cosmo_dadt/cosmo_a*dt;
+  const real cvv = (1.0 - coef) / (1.0 + coef);
+  const real cva = 0.5*dt / (1.0 + coef);
+
+  const auto t0 = std::chrono::steady_clock::now();
+  for (int r=0; r<repeats; r++) push (p, 3, cp, cvv, cva);
+  const auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(t1 - t0).count();
+}
+
+//----------------------------------------------------------------------
+
+int main (int argc, char ** argv)
+{
+  const int num_particles = (argc > 1) ? atoi(argv[1]) : 64*1024;
+  const int batch_size    = (argc > 2) ? atoi(argv[2]) : 1024;
+  const int repeats       = (argc > 3) ? atoi(argv[3]) : 2000;
+
+  // pad each attribute array to a multiple of PARTICLE_ALIGN bytes, as
+  // in ParticleDescr::new_attribute()
+  const int align = PARTICLE_ALIGN / sizeof(real);
+  const int pad = (align - batch_size % align) % align;
+
+  Batches interleaved (num_particles, batch_size, true,  0);
+  Batches strided     (num_particles, batch_size, false, 0);
+  Batches span        (num_particles, batch_size, false, pad);
+
+  const struct { const char * name; push_function push; Batches * p; }
+  cases[] = { {"interleaved", push_strided, &interleaved},
+              {"strided",     push_strided, &strided},
+              {"span",        push_span,    &span} };
+
+  printf ("particles %d  batch size %d  repeats %d\n",
+          num_particles, batch_size, repeats);
+  printf ("%-12s %14s %9s\n", "layout", "particles/sec", "speedup");
+
+  double rate_strided = 0.0;
+  double rate[3];
+  for (int i=0; i<3; i++) {
+    initialize (*cases[i].p);
+    const double time = time_push (cases[i].push, *cases[i].p, repeats);
+    rate[i] = (double)repeats * num_particles / time;
+    if (cases[i].p == &strided) rate_strided = rate[i];
+  }
+
+  bool ok = true;
+  for (int i=0; i<3; i++) {
+    const bool match = same (*cases[i].p, strided);
+    ok = ok && match;
+    printf ("%-12s %14.4e %9.2f%s\n", cases[i].name, rate[i],
+            rate[i] / rate_strided, match ? "" : "  FAILED");
+  }
+
+  return ok ? 0 : 1;
+}
@@ -64,6 +64,29 @@ public: // virtual functions
     /* This function intentionally empty */
   }
 
+  /// Number of values this Method appends to the timestep reduction
+  /// in the stopping phase of the current cycle
+  ///
+  /// Must be the same on all Blocks.  Lets diagnostics that need
+  /// global sums piggyback on the timestep reduction instead of
+  /// issuing a reduction of their own.
+  virtual int num_stopping_sum (Block * block) throw()
+  { return 0; }
+
+  /// Write this Block's contribution to the num_stopping_sum() values
+  /// summed in the timestep reduction
+  virtual void stopping_sum (Block * block, long double * sum) throw()
+  {
+    /* This function intentionally empty */
+  }
+
+  /// Receive the num_stopping_sum() values summed over all Blocks
+  virtual void stopping_reduced (Block * block,
+                                 const long double * sum) throw()
+  {
+    /* This function intentionally empty */
+  }
+
   /// Add a new refresh object
   int add_refresh_ (int neighbor_type = neighbor_leaf);
 
@@ -9,12 +9,15 @@
 #include "charm_simulation.hpp"
 #include "test.hpp"
 
+#include <algorithm>
+
 //----------------------------------------------------------------------
 
 MethodFluxCorrect::MethodFluxCorrect
 (std::string group, bool enable,
  const std::vector<std::string>& min_digits_fields,
- const std::vector<double>& min_digits_vals) throw() 
+ const std::vector<double>& min_digits_vals,
+ Schedule * check_schedule) throw() 
   : Method (),
     ir_pre_(-1),
     group_(group),
@@ -22,6 +25,10 @@ MethodFluxCorrect::MethodFluxCorrect
     min_digits_map_(),
     field_sum_(),
     field_sum_0_(),
+    check_schedule_(check_schedule),
+    is_sum_0_(false),
+    is_sum_(-1),
+    is_sum_state_(-1),
     scratch_()
 {
   // Set up post-refresh to refresh all conserved fields in group_
@@ -65,6 +72,21 @@ MethodFluxCorrect::MethodFluxCorrect
 
   field_sum_.resize(nf);
   field_sum_0_.resize(nf);
+
+  // Block Scalar data for caching sums between flux correction and
+  // the stopping phase
+
+  is_sum_ = cello::scalar_descr_long_double()->new_value
+    (name() + ":sum",nf);
+  is_sum_state_ = cello::scalar_descr_int()->new_value
+    (name() + ":sum_state");
+
+  // All Blocks must agree on whether sums are added to the timestep
+  // reduction, which is only guaranteed for cycle schedules
+  ASSERT("MethodFluxCorrect::MethodFluxCorrect",
+         "check_schedule must have var = \"cycle\"",
+         (check_schedule_ == NULL ||
+          check_schedule_->type() == schedule_type_cycle));
 }
 
 //----------------------------------------------------------------------
@@ -82,126 +104,173 @@ void MethodFluxCorrect::compute ( Block * block) throw()
 
 void Block::p_method_flux_correct_refresh()
 {
+  performance_start_(perf_compute,__FILE__,__LINE__);
   static_cast<MethodFluxCorrect*>
     (this->method())->compute_continue_refresh(this);
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+  compute_done();
 }
 
 //----------------------------------------------------------------------
 
 void MethodFluxCorrect::compute_continue_refresh( Block * block ) throw()
+{
+  flux_correct_ (block);
+
+  block->data()->flux_data()->release();
+
+  // Cache sums if they are checked in the next stopping phase, which
+  // follows the cycle update and adapt
+
+  const bool check = (check_schedule_ == NULL) ||
+    check_schedule_->write_this_cycle(block->cycle() + 1,
+                                      block->time() + block->dt());
+  if (check) {
+    long double * sum = psum_(block);
+    std::fill_n(sum,field_sum_.size(),0.0);
+    if (block->is_leaf()) {
+      field_sums_(block,sum);
+      *psum_state_(block) = sum_state_leaf;
+    } else {
+      *psum_state_(block) = sum_state_parent;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+int MethodFluxCorrect::num_stopping_sum (Block * block) throw()
+{
+  const bool check = (check_schedule_ == NULL) ||
+    check_schedule_->write_this_cycle(block->cycle(),block->time());
+
+  return check ? field_sum_.size() : 0;
+}
+
+//----------------------------------------------------------------------
+
+void MethodFluxCorrect::stopping_sum
+(Block * block, long double * sum) throw()
 {
   // accumulate local sums of conserved fields for global sum reduction
 
-  flux_correct_ (block);
+  const int nf = field_sum_.size();
 
+  if (block->cycle() == cello::config()->initial_cycle) {
+
+    // no cycle computed yet: sum the initial conditions
+
+    if (block->is_leaf()) field_sums_(block,sum);
+
+  } else {
+
+    // Use the sums cached after flux correction: Blocks refined by
+    // adapt contribute the sums of their data before refinement, and
+    // the new child Blocks contribute nothing.  Blocks coarsened by
+    // adapt had no cached sums, so sum the data restricted from their
+    // (deleted) children
+
+    const int state = *psum_state_(block);
+    if (state == sum_state_leaf) {
+      const long double * sum_block = psum_(block);
+      for (int i_f=0; i_f<nf; i_f++) {
+        sum[i_f] += sum_block[i_f];
+      }
+    } else if (state == sum_state_parent && block->is_leaf()) {
+      field_sums_(block,sum);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void MethodFluxCorrect::field_sums_
+(Block * block, long double * sum)
+{
   Field field = block->data()->field();
   int mx,my,mz;
   int gx,gy,gz;
   field.dimensions (0,&mx,&my,&mz);
   field.ghost_depth (0,&gx,&gy,&gz);
 
-  cello_float * values;
+  cello_float * density = (cello_float *) field.values("density");
 
-  FluxData * flux_data = block->data()->flux_data();
+  Grouping * groups = cello::field_groups();
 
-  const int nf = flux_data->num_fields();
-  long double * reduce = new long double [nf+1];
-  std::fill_n(reduce,nf+1,0.0);
-  reduce[0] = nf;
+  const int nf = field_sum_.size();
 
-  if (block->is_leaf()) {
+  // scale by relative mesh cell volume/area
 
-    cello_float * density = (cello_float *) field.values("density");
+  const int level = block->level();
+  const int w = 1 << level*cello::rank();
 
-    Grouping * groups = cello::field_groups();
+  for (int i_f=0; i_f<nf; i_f++) {
 
-    for (int i_f=0; i_f<nf; i_f++) {
+    const std::string field_name = groups->item(group_,i_f);
 
-      const int index_field = flux_data->index_field(i_f);
+    const bool scale_by_density =
+      groups->is_in(field_name,"make_field_conservative");
 
-      const bool scale_by_density =
-        groups->is_in(field.field_name(index_field),"make_field_conservative");
+    cello_float * values = (cello_float *) field.values(field_name);
 
-      values = (cello_float *) field.values(index_field);
+    long double sum_field = 0.0;
 
-      if (scale_by_density) {
-        for (int iz=gz; iz<mz-gz; iz++) {
-          for (int iy=gy; iy<my-gy; iy++) {
-            for (int ix=gx; ix<mx-gx; ix++) {
-              int i=ix + mx*(iy + my*iz);
-              reduce[i_f+1] += values[i]*density[i];
-            }
+    if (scale_by_density) {
+      for (int iz=gz; iz<mz-gz; iz++) {
+        for (int iy=gy; iy<my-gy; iy++) {
+          for (int ix=gx; ix<mx-gx; ix++) {
+            int i=ix + mx*(iy + my*iz);
+            sum_field += values[i]*density[i];
           }
         }
-      } else {
-        for (int iz=gz; iz<mz-gz; iz++) {
-          for (int iy=gy; iy<my-gy; iy++) {
-            for (int ix=gx; ix<mx-gx; ix++) {
-              int i=ix + mx*(iy + my*iz);
-              reduce[i_f+1] += values[i];
-            }
+      }
+    } else {
+      for (int iz=gz; iz<mz-gz; iz++) {
+        for (int iy=gy; iy<my-gy; iy++) {
+          for (int ix=gx; ix<mx-gx; ix++) {
+            int i=ix + mx*(iy + my*iz);
+            sum_field += values[i];
           }
         }
       }
-
-      // scale by relative mesh cell volume/area
-
-      const int level = block->level();
-
-      const int w = 1 << level*cello::rank();
-      reduce[i_f+1] /= w;
     }
-  }
-
-  CkCallback callback (CkIndex_Block::r_method_flux_correct_sum_fields(nullptr), 
-                       block->proxy_array());
-
-  block->contribute
-    ((nf+1)*sizeof(long double), reduce, sum_long_double_n_type, callback);
-
-  delete [] reduce;
-}
 
-//----------------------------------------------------------------------
-
-void Block::r_method_flux_correct_sum_fields(CkReductionMsg * msg)
-{
-  static_cast<MethodFluxCorrect*>
-    (this->method())->compute_continue_sum_fields(this,msg);
+    sum[i_f] += sum_field / w;
+  }
 }
 
 //----------------------------------------------------------------------
 
-void MethodFluxCorrect::compute_continue_sum_fields
-( Block * block, CkReductionMsg * msg) throw()
+void MethodFluxCorrect::stopping_reduced
+(Block * block, const long double * sum) throw()
 {
-  FluxData * flux_data = block->data()->flux_data();
-  const int nf = flux_data->num_fields();
-  long double * data = (long double *) msg->getData();
+  const int nf = field_sum_.size();
   for (int i_f=0; i_f<nf; i_f++) {
-    field_sum_[i_f] = data[i_f+1];
+    field_sum_[i_f] = sum[i_f];
   }
-  delete msg;
 
-  Field field = block->data()->field();
+  // save initial sum
+  if (! is_sum_0_) {
+    field_sum_0_ = field_sum_;
+    is_sum_0_ = true;
+  }
 
   // Write conserved field sums to output (root block only)
   
   if (block->index().is_root()) {
 
+    Field field = block->data()->field();
+    Grouping * groups = cello::field_groups();
+
     // for each conserved field
     for (int i_f=0; i_f<nf; i_f++) {
 
-      const int index_field = flux_data->index_field(i_f);
+      const std::string field_name = groups->item(group_,i_f);
+      const int index_field = field.field_id(field_name);
 
-      // save initial sum
-      if (block->cycle() == 0) {
-        field_sum_0_[i_f] = field_sum_[i_f];
-      }
       const int precision = field.precision (index_field);
       const double digits =
         -log10(cello::err_rel(field_sum_0_[i_f],field_sum_[i_f]));
-      const std::string& field_name = field.field_name(index_field);
       cello::monitor()->print
         ("Method", "Field %s sum %20.16Le conserved to %g digits of %d",
          field_name.c_str(),
@@ -218,10 +287,6 @@ void MethodFluxCorrect::compute_continue_sum_fields
       }
     }
   }
-
-  block->data()->flux_data()->deallocate();
-
-  block->compute_done();
 }
 
 //======================================================================
@@ -513,3 +578,21 @@ void MethodFluxCorrect::flux_correct_(Block * block)
     }
   }
 }
+
+//----------------------------------------------------------------------
+
+long double * MethodFluxCorrect::psum_ (Block * block)
+{
+  Scalar<long double> scalar(cello::scalar_descr_long_double(),
+                             block->data()->scalar_data_long_double());
+  return scalar.value(is_sum_);
+}
+
+//----------------------------------------------------------------------
+
+int * MethodFluxCorrect::psum_state_ (Block * block)
+{
+  Scalar<int> scalar(cello::scalar_descr_int(),
+                     block->data()->scalar_data_int());
+  return scalar.value(is_sum_state_);
+}
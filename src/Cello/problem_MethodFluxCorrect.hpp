@@ -22,18 +22,23 @@ public: // interface
   MethodFluxCorrect
   (const std::string group, bool enable,
    const std::vector<std::string>& min_digits_fields,
-   const std::vector<double>& min_digits_values) throw();
+   const std::vector<double>& min_digits_values,
+   Schedule * check_schedule) throw();
 
   /// Destructor
   virtual ~MethodFluxCorrect() throw()
-  {};
+  { delete check_schedule_; };
 
   /// Charm++ PUP::able declarations
   PUPable_decl(MethodFluxCorrect);
 
   /// Charm++ PUP::able migration constructor
   MethodFluxCorrect (CkMigrateMessage *m)
-    : Method(m)
+    : Method(m),
+      check_schedule_(NULL),
+      is_sum_0_(false),
+      is_sum_(-1),
+      is_sum_state_(-1)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -47,11 +52,14 @@ public: // interface
     p | min_digits_map_;
     p | field_sum_;
     p | field_sum_0_;
+    p | check_schedule_; // pupable
+    p | is_sum_0_;
+    p | is_sum_;
+    p | is_sum_state_;
     // don't pup scratch_
   };
 
   void compute_continue_refresh ( Block * block) throw();
-  void compute_continue_sum_fields ( Block * block, CkReductionMsg * msg) throw();
 
 public: // virtual functions
 
@@ -63,9 +71,38 @@ public: // virtual functions
   virtual std::string name () throw ()
   { return "flux_correct"; }
 
+  /// Number of conserved field sums to check this cycle
+  virtual int num_stopping_sum (Block * block) throw();
+
+  /// Accumulate local sums of conserved fields, as cached after flux
+  /// correction in the previous cycle
+  virtual void stopping_sum (Block * block, long double * sum) throw();
+
+  /// Write and check global sums of conserved fields
+  virtual void stopping_reduced (Block * block,
+                                 const long double * sum) throw();
+
+protected: // types
+
+  /// State of a Block's cached conserved field sums
+  enum sum_state_type {
+    sum_state_none,   // no cached sums (Block created by adapt)
+    sum_state_leaf,   // sums cached while the Block was a leaf
+    sum_state_parent  // Block was not a leaf when sums were cached
+  };
+
 protected: // functions
 
   void flux_correct_ (Block * block);
+
+  /// Add the Block's sums of conserved fields to sum
+  void field_sums_ (Block * block, long double * sum);
+
+  /// Return pointer to the Block's cached sums of conserved fields
+  long double * psum_ (Block * block);
+
+  /// Return pointer to the Block's cached sum state
+  int * psum_state_ (Block * block);
   
 protected: // attributes
 
@@ -87,6 +124,23 @@ protected: // attributes
   std::vector<long double> field_sum_;
   std::vector<long double> field_sum_0_;
 
+  /// Cycles on which to check conserved field sums, or NULL for every
+  /// cycle.  Sums are added to the timestep reduction in the stopping
+  /// phase, so no reduction is needed in compute()
+  Schedule * check_schedule_;
+
+  /// Whether field_sum_0_ has been initialized by the first check
+  bool is_sum_0_;
+
+  /// Block Scalar index of the conserved field sums cached after
+  /// flux correction, since the fields may change before the
+  /// stopping phase (e.g. by prolongation when refining)
+  int is_sum_;
+
+  /// Block Scalar index of the state of the cached sums, which is
+  /// sum_state_none for Blocks created by adapt since the cache
+  int is_sum_state_;
+
   /// scratch space for performing the flux correction
   std::vector<cello_float> scratch_;
 };
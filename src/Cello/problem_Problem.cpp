@@ -909,11 +909,23 @@ Method * Problem::create_method_
 
   } else if (name == "flux_correct") {
 
+    const int index_schedule =
+      config->method_flux_correct_check_schedule_index[index_method];
+
+    Schedule * check_schedule = (index_schedule < 0) ? NULL :
+      Schedule::create( config->schedule_var[index_schedule],
+                        config->schedule_type[index_schedule],
+                        config->schedule_start[index_schedule],
+                        config->schedule_stop[index_schedule],
+                        config->schedule_step[index_schedule],
+                        config->schedule_list[index_schedule]);
+
     method = new MethodFluxCorrect
       (config->method_flux_correct_group[index_method],
        config->method_flux_correct_enable[index_method],
        config->method_flux_correct_min_digits_fields[index_method],
-       config->method_flux_correct_min_digits_values[index_method]);
+       config->method_flux_correct_min_digits_values[index_method],
+       check_schedule);
 
   } else if (name == "output") {
 
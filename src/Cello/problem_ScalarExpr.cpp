@@ -5,8 +5,6 @@
 /// @date     2014-03-31
 /// @brief    Implementation of the ScalarExpr class
 
-#include <cstring>
-
 #include "problem.hpp"
 
 //----------------------------------------------------------------------
@@ -70,69 +68,40 @@ void ScalarExpr::evaluate (T * value, double t,
 	  ndx,ndy,ndz,nx,ny,nz,
 	  (ndx >= nx) && (ndy >= ny) && (ndz >= nz));
 
-  bool * mv = 0;
-  if (mask) {
-    mv = new bool [ nx*ny*nz ];
-    mask->evaluate(mv, t, nx,nx,xv, ny,ny,yv, nz,nz,zv);
-  }
-
-  double * value_temp = new double [nx*ny*nz];
-  double * x = new double [ nx*ny*nz ];
-  double * y = new double [ nx*ny*nz ];
-  double * z = new double [ nx*ny*nz ];
-
-  for (int i=0; i<nx*ny*nz; i++) {
-    x[i] = y[i] = z[i] = 0.0;
-  }
-  
-  for (int iz=0; iz<nz; iz++) {
-    for (int iy=0; iy<ny; iy++) {
-      for (int ix=0; ix<nx; ix++) {
-	int i=ix + nx*(iy + ny*iz);
-	x[i] = xv[ix];
-	y[i] = yv[iy];
-	z[i] = zv[iz];
-	value_temp[i] = 0.0;
-      }
-    }
-  }
-
-  int n=nx*ny*nz;
+  // with a mask, deflt may alias value (see Value::evaluate()), so
+  // masked values are evaluated into a temporary array first
+  T * v = mask ? new T [nx*ny*nz] : value;
+  const int mdx = mask ? nx : ndx;
+  const int mdy = mask ? ny : ndy;
 
   if (param_) {
-    param_->evaluate_float(n, value_temp, x,y,z,t);
+    param_->program()->evaluate_grid (v, mdx, mdy, t, nx,xv, ny,yv, nz,zv);
   } else {
-    for (int i=0; i<n; i++) value_temp[i]=value_;
-  }
-
-  if (mask) {
-    for (int ix=0; ix<nx; ix++) {
+    for (int iz=0; iz<nz; iz++) {
       for (int iy=0; iy<ny; iy++) {
-	for (int iz=0; iz<nz; iz++) {
-	  int i=ix + nx*(iy + ny*iz);
-	  int id=ix + ndx*(iy + ndy*iz);
-	  value[id] = mv[i] ? (T) value_temp[i] : deflt[id];
+	for (int ix=0; ix<nx; ix++) {
+	  v[ix + mdx*(iy + mdy*iz)] = (T) value_;
 	}
       }
     }
-  } else {
-    for (int ix=0; ix<nx; ix++) {
+  }
+
+  if (mask) {
+    bool * mv = new bool [ nx*ny*nz ];
+    mask->evaluate(mv, t, nx,nx,xv, ny,ny,yv, nz,nz,zv);
+    for (int iz=0; iz<nz; iz++) {
       for (int iy=0; iy<ny; iy++) {
-	for (int iz=0; iz<nz; iz++) {
+	for (int ix=0; ix<nx; ix++) {
 	  int i=ix + nx*(iy + ny*iz);
 	  int id=ix + ndx*(iy + ndy*iz);
-	  value[id] = (T) (value_temp[i]);
+	  value[id] = mv[i] ? v[i] : deflt[id];
 	}
       }
     }
+    delete [] mv;
+    delete [] v;
   }
 
-  if (mv) { delete [] mv; }
-  delete [] value_temp;
-  delete [] z;
-  delete [] y;
-  delete [] x;
-
 }
 
 
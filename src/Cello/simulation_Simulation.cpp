@@ -934,11 +934,13 @@ void Simulation::monitor_performance()
   // 12+ max_proc_particles
   // 13+ max_node_blocks
   // 14+ max_node_particles
+  // 14a+ max_proc_scratch
+  // 14b+ max_io_wait
   // 15+ max_solver_iters
   
   const int num_solver = problem()->num_solvers();
 
-  int n = 14 + 2*num_solver + ( hierarchy_->max_level() - hierarchy_->min_level() + 1) + nr*nc;
+  int n = 20 + 2*num_solver + ( hierarchy_->max_level() - hierarchy_->min_level() + 1) + nr*nc;
 
   
   long long * counters_region = new long long [nc];
@@ -947,7 +949,7 @@ void Simulation::monitor_performance()
   const int in = cello::index_static();
   
   int m=0;
-  const int num_max = 4 + num_solver;
+  const int num_max = 6 + num_solver;
   counters_reduce[m++] = n - num_max - 2;
   counters_reduce[m++] = num_max;
   
@@ -959,6 +961,10 @@ void Simulation::monitor_performance()
   counters_reduce[m++] = DataMsg::counter[in];        // 5
   counters_reduce[m++] = FieldFace::counter[in];      // 6
   counters_reduce[m++] = ParticleData::counter[in];   // 7
+  counters_reduce[m++] = BufferPool::counter_hit[in]; // 7a
+  counters_reduce[m++] = BufferPool::counter_miss[in];// 7b
+  counters_reduce[m++] = IoAdmission::counter_grant[in];     // 7c
+  counters_reduce[m++] = IoAdmission::counter_wait_usec[in]; // 7d
   counters_reduce[m++] = hierarchy_->num_particles(); // 8
   for (int i=0; i<num_solver; i++) {
     counters_reduce[m++] = cello::simulation()->get_solver_num_iter(i); // 9
@@ -987,6 +993,8 @@ void Simulation::monitor_performance()
   counters_reduce[m++] = hierarchy_->num_particles(); // 12  max_proc_particles
   counters_reduce[m++] = Hierarchy::num_blocks_node;  // 13  max_node_blocks
   counters_reduce[m++] = Hierarchy::num_particles_node;// 14 max_node_particles
+  counters_reduce[m++] = ScratchArena::instance()->bytes_high(); // 14a
+  counters_reduce[m++] = IoAdmission::counter_wait_usec_max[in]; // 14b
   for (int i=0; i<num_solver; i++) {
     counters_reduce[m++] = cello::simulation()->get_solver_max_iter(i); // 15 max_node_particles
   }
@@ -1030,6 +1038,10 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
   const long long data_msg    = counters_reduce[m++];   // 5
   const long long field_face  = counters_reduce[m++];   // 6
   const long long particle_data = counters_reduce[m++]; // 7
+  const long long pool_hit    = counters_reduce[m++];   // 7a
+  const long long pool_miss   = counters_reduce[m++];   // 7b
+  const long long io_grant    = counters_reduce[m++];   // 7c
+  const long long io_wait     = counters_reduce[m++];   // 7d
   const long long num_particles = counters_reduce[m++]; // 8
 
   const int num_solver = problem()->num_solvers();
@@ -1046,6 +1058,10 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
   monitor()->print("Performance","counter num-data-msg %lld", data_msg);
   monitor()->print("Performance","counter num-field-face %lld", field_face);
   monitor()->print("Performance","counter num-particle-data %lld", particle_data);
+  monitor()->print("Performance","counter num-buffer-pool-hit %lld", pool_hit);
+  monitor()->print("Performance","counter num-buffer-pool-miss %lld", pool_miss);
+  monitor()->print("Performance","counter num-io-grant %lld", io_grant);
+  monitor()->print("Performance","counter io-wait-usec %lld", io_wait);
 
   monitor()->print("Performance","simulation num-particles total %lld",
 		   num_particles);
@@ -1104,6 +1120,8 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
   const long long max_proc_particles = counters_reduce[m++]; // 12
   const long long max_node_blocks    = counters_reduce[m++]; // 13
   const long long max_node_particles = counters_reduce[m++]; // 14
+  const long long max_proc_scratch   = counters_reduce[m++]; // 14a
+  const long long max_io_wait        = counters_reduce[m++]; // 14b
 
   for (int i=0; i<num_solver; i++) {
     const long long max_solver_iters       = counters_reduce[m++]; // 15
@@ -1122,6 +1140,10 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
     ("Performance","simulation max-proc-particles %lld", max_proc_particles);
   monitor()->print
     ("Performance","simulation max-node-particles %lld", max_node_particles);
+  monitor()->print
+    ("Performance","simulation max-proc-scratch-bytes %lld", max_proc_scratch);
+  monitor()->print
+    ("Performance","simulation max-io-wait-usec %lld", max_io_wait);
 
   const double avg_proc_blocks = 1.0*num_blocks_total/CkNumPes();
   const double avg_node_blocks = 1.0*num_blocks_total/CkNumNodes();
@@ -1165,5 +1187,6 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
   delete msg;
 
   Memory::instance()->reset_high();
+  ScratchArena::instance()->reset_high();
 
 }
@@ -357,12 +357,27 @@ PARALLEL_MAIN_BEGIN
 	  face_lower.face_to_array (field_lower, &n, &array);
 	  face_upper.array_to_face (array,field_upper);
 
-	  delete [] array;
+	  BufferPool::deallocate (array,n);
+
+	  // same-sized face array is reused from the pool
+	  const long hit = BufferPool::counter_hit[cello::index_static()];
 
 	  face_upper.face_to_array (field_upper,&n, &array);
 	  face_lower.array_to_face (array,field_lower);
 
-	  delete [] array;
+	  unit_assert
+	    (BufferPool::counter_hit[cello::index_static()] == hit + 1);
+
+	  BufferPool::deallocate (array,n);
+
+	  // free buffers kept by the pool are limited in total size
+	  {
+	    const std::size_t m = BufferPool::max_bytes() / 4;
+	    std::vector<void *> buffers;
+	    for (int i=0; i<8; i++) buffers.push_back(BufferPool::allocate(m));
+	    for (int i=0; i<8; i++) BufferPool::deallocate(buffers[i],m);
+	    unit_assert (BufferPool::num_bytes() <= BufferPool::max_bytes());
+	  }
 
 	  // test data_size(), save_data(), load_data() 
 
@@ -387,6 +402,53 @@ PARALLEL_MAIN_BEGIN
   unit_func("face_to_array / array_to_face");
   unit_assert(test_fields(field_descr,field_data.data(),nbx,nby,nbz,mx,my,mz));
 
+  //----------------------------------------------------------------------
+  // Benchmark face_to_array / array_to_face bandwidth per face axis
+  //----------------------------------------------------------------------
+
+  {
+    const char * axis_name[3] = {"x","y","z"};
+    const int num_iter = 10000;
+
+    Field field_lower (field_descr,field_data[0]);
+    Field field_upper (field_descr,field_data[1]);
+
+    std::vector<int> field_list = {0,1,2};
+    Refresh refresh;
+    refresh.set_field_list(field_list);
+
+    for (int axis = 0; axis < 3; axis++) {
+
+      FieldFace face_lower (3);
+      FieldFace face_upper (3);
+
+      face_lower.set_refresh_type(refresh_same);
+      face_upper.set_refresh_type(refresh_same);
+      face_lower.set_ghost(g33[0][0],g33[0][1],g33[0][2]);
+      face_upper.set_ghost(g33[0][0],g33[0][1],g33[0][2]);
+      face_lower.set_face(axis==0 ? 1:0, axis==1 ? 1:0, axis==2 ? 1:0);
+      face_upper.set_face(axis==0 ? -1:0, axis==1 ? -1:0, axis==2 ? -1:0);
+      face_lower.set_refresh(&refresh,false);
+      face_upper.set_refresh(&refresh,false);
+
+      const int n = face_lower.num_bytes_array(field_lower);
+      std::vector<char> array (n);
+
+      Timer timer;
+      timer.start();
+      for (int iter = 0; iter < num_iter; iter++) {
+        face_lower.face_to_array (field_lower, array.data());
+        face_upper.array_to_face (array.data(), field_upper);
+      }
+      const double time = timer.stop();
+
+      // bytes loaded into and stored from the array
+      const double bytes = 2.0 * n * num_iter;
+      CkPrintf ("FieldFace benchmark %s-face %d bytes  %g GB/s\n",
+                axis_name[axis], n, (time > 0.0) ? 1e-9*bytes/time : 0.0);
+    }
+  }
+
   //----------------------------------------------------------------------	
   // clean up
   //----------------------------------------------------------------------	
@@ -225,6 +225,55 @@ PARALLEL_MAIN_BEGIN
     }
   }
 
+  unit_func ("release()");
+
+  FaceFluxes * ff_released = flux_data.block_fluxes(0,0,0);
+
+  flux_data.release();
+
+  unit_assert (flux_data.block_fluxes(0,0,0) == nullptr);
+  unit_assert (flux_data.neighbor_fluxes(0,0,0) == nullptr);
+
+  unit_func ("allocate()");
+
+  // same layout: released face fluxes are reused and cleared
+
+  flux_data.allocate(n3[0],n3[1],n3[2],field_list);
+
+  unit_assert (flux_data.block_fluxes(0,0,0) == ff_released);
+
+  for (int i_f=0; i_f<n_f; i_f++) {
+    for (int axis=0; axis<3; axis++) {
+      for (int face=0; face<2; face++) {
+        FaceFluxes * ff_blk = flux_data.block_fluxes(axis,face,i_f);
+        FaceFluxes * ff_nbr = flux_data.neighbor_fluxes(axis,face,i_f);
+        unit_assert (ff_blk != nullptr);
+        unit_assert (ff_nbr != nullptr);
+        const int m = ff_blk->get_size();
+        const cello_float * fluxes_blk = ff_blk->flux_array();
+        const cello_float * fluxes_nbr = ff_nbr->flux_array();
+        bool is_zero = true;
+        for (int i=0; i<m; i++) {
+          is_zero = is_zero && (fluxes_blk[i] == 0.0) && (fluxes_nbr[i] == 0.0);
+        }
+        unit_assert (is_zero);
+      }
+    }
+  }
+
+  // different centering: face fluxes are recreated
+
+  flux_data.allocate(n3[0],n3[1],n3[2],field_list,true,
+                     &cx_list,&cy_list,&cz_list);
+
+  for (int i_f=0; i_f<n_f; i_f++) {
+    FaceFluxes * ff_blk = flux_data.block_fluxes(0,0,i_f);
+    int mx,my,mz;
+    ff_blk->get_size(&mx,&my,&mz);
+    unit_assert (my == n3[1] + cy_list[i_f]);
+    unit_assert (mz == n3[2] + cz_list[i_f]);
+  }
+
   unit_func ("deallocate()");
 
   flux_data.deallocate();
@@ -284,6 +284,7 @@ PARALLEL_MAIN_BEGIN
   unit_assert(particle.attribute_offset(it_dark,ia_dark_x) == k*mp);  k+=4;
   unit_assert(particle.attribute_offset(it_dark,ia_dark_y) == k*mp);  k+=4;
   unit_assert(particle.attribute_offset(it_dark,ia_dark_z) == k*mp);  k+=4;
+  unit_assert(particle_descr->batch_bytes(it_dark) == k*mp);
 
   // interleaved
   unit_assert(particle.attribute_bytes(it_trace,ia_trace_x) == 4);
@@ -395,6 +396,25 @@ PARALLEL_MAIN_BEGIN
   }
   unit_assert(count_particles == 30000);
 
+  unit_func("attribute_span()");
+  int error_span = 0;
+  for (int ib=0; ib<nb; ib++) {
+    int np = particle.num_particles(it_dark,ib);
+    ParticleSpan<float>  x  = particle.attribute_span<float>
+      (it_dark,ia_dark_x, ib);
+    ParticleSpan<double> vz = particle.attribute_span<double>
+      (it_dark,ia_dark_vz,ib);
+    if (x.size() != np || vz.size() != np) error_span++;
+    if ((uintptr_t)x.data()  % PARTICLE_ALIGN != 0) error_span++;
+    if ((uintptr_t)vz.data() % PARTICLE_ALIGN != 0) error_span++;
+    for (int ip=0; ip<np; ip++) {
+      index = ip + ib*mp;
+      if (x[ip]  != 10*index)   error_span++;
+      if (vz[ip] != 10*index+5) error_span++;
+    }
+  }
+  unit_assert(error_span == 0);
+
   // test position() and velocity()
   std::vector<double> xp(mp), yp(mp), zp(mp);
   std::vector<double> vxp(mp),vyp(mp),vzp(mp);
@@ -1052,6 +1072,24 @@ PARALLEL_MAIN_BEGIN
   unit_assert (buffer_next - buffer == n);
   unit_assert (p_dst == new_p);
 
+  unit_func("ParticleData()");
+  // copies may be allocated with a different alignment, but must still
+  // be aligned and compare equal
+  ParticleData copy_p_data (new_p_data);
+  Particle copy_p (particle_descr,&copy_p_data);
+  unit_assert (copy_p == new_p);
+  int error_copy_align = 0;
+  for (int it=0; it<copy_p.num_types(); it++) {
+    if (copy_p.interleaved(it)) continue;
+    for (int ib=0; ib<copy_p.num_batches(it); ib++) {
+      for (int ia=0; ia<copy_p.num_attributes(it); ia++) {
+        if ((uintptr_t)copy_p.attribute_array(it,ia,ib) % PARTICLE_ALIGN)
+          error_copy_align++;
+      }
+    }
+  }
+  unit_assert (error_copy_align == 0);
+
   delete [] buffer;
   // printf ("error_gather_int %d\n",error_gather_int);
 
@@ -0,0 +1,125 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file      test_ScratchArena.cpp
+/// @author    James Bordner (jobordner@ucsd.edu)
+/// @date      2026-10-17
+/// @brief     Program implementing unit tests for the ScratchArena class
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "memory.hpp"
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("ScratchArena");
+
+  ScratchArena * scratch = ScratchArena::instance();
+
+  //----------------------------------------------------------------------
+  // reserve()
+  //----------------------------------------------------------------------
+
+  unit_func("reserve");
+
+  scratch->reserve (1000*sizeof(double));
+  unit_assert (scratch->bytes_capacity() >= int64_t(1000*sizeof(double)));
+  unit_assert (scratch->bytes() == 0);
+
+  //----------------------------------------------------------------------
+  // allocate()
+  //----------------------------------------------------------------------
+
+  unit_func("allocate");
+
+  const ScratchArena::Mark mark_0 = scratch->mark();
+
+  double * a1 = scratch->allocate<double>(100);
+  float  * a2 = scratch->allocate<float>(17);
+  int    * a3 = scratch->allocate<int>(25);
+
+  unit_assert (((size_t)a1 % ScratchArena::alignment) == 0);
+  unit_assert (((size_t)a2 % ScratchArena::alignment) == 0);
+  unit_assert (((size_t)a3 % ScratchArena::alignment) == 0);
+
+  for (int i=0; i<100; i++) a1[i] = 1.0*i;
+  for (int i=0; i<17;  i++) a2[i] = 2.0*i;
+  for (int i=0; i<25;  i++) a3[i] = 3*i;
+
+  bool arrays_ok = true;
+  for (int i=0; i<100; i++) arrays_ok = arrays_ok && (a1[i] == 1.0*i);
+  for (int i=0; i<17;  i++) arrays_ok = arrays_ok && (a2[i] == 2.0f*i);
+  unit_assert (arrays_ok);
+
+  unit_assert (scratch->num_overflow() == 0);
+  const int64_t bytes_3 = scratch->bytes();
+  unit_assert (bytes_3 >= int64_t(100*sizeof(double) +
+                                  17*sizeof(float) + 25*sizeof(int)));
+
+  //----------------------------------------------------------------------
+  // release()
+  //----------------------------------------------------------------------
+
+  unit_func("release");
+
+  scratch->release(mark_0);
+  unit_assert (scratch->bytes() == 0);
+
+  // the buffer is reused: the same request returns the same array
+  double * b1 = scratch->allocate<double>(100);
+  unit_assert (b1 == a1);
+  scratch->release(mark_0);
+
+  //----------------------------------------------------------------------
+  // overflow
+  //----------------------------------------------------------------------
+
+  unit_func("overflow");
+
+  const int64_t capacity = scratch->bytes_capacity();
+  const size_t n_big = 2*capacity / sizeof(double);
+
+  scratch->allocate<double>(10);
+  const ScratchArena::Mark mark_1 = scratch->mark();
+  const int64_t bytes_1 = scratch->bytes();
+  double * c2 = scratch->allocate<double>(n_big);
+  unit_assert (((size_t)c2 % ScratchArena::alignment) == 0);
+  for (size_t i=0; i<n_big; i++) c2[i] = 1.0;
+  unit_assert (scratch->num_overflow() == 1);
+  scratch->release(mark_1);
+  unit_assert (scratch->bytes() == bytes_1);
+  scratch->release(mark_0);
+
+  // buffer grows to the high-water mark once empty, after which the
+  // same requests fit without overflowing
+  unit_assert (scratch->bytes_capacity() >= scratch->bytes_highest());
+  scratch->allocate<double>(10);
+  scratch->allocate<double>(n_big);
+  unit_assert (scratch->num_overflow() == 1);
+  scratch->release(mark_0);
+
+  //----------------------------------------------------------------------
+  // bytes_high()
+  //----------------------------------------------------------------------
+
+  unit_func("bytes_high");
+
+  unit_assert (scratch->bytes_high() >= int64_t(n_big*sizeof(double)));
+  scratch->reset_high();
+  unit_assert (scratch->bytes_high() == 0);
+  unit_assert (scratch->bytes_highest() >= int64_t(n_big*sizeof(double)));
+
+  scratch->print();
+
+  unit_finalize();
+
+  exit_();
+
+}
+
+PARALLEL_MAIN_END
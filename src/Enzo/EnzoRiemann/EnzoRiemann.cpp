@@ -14,7 +14,9 @@
 #include "EnzoRiemann.hpp"
 
 // private headers:
+#include "EnzoRiemannInputLUT.hpp"
 #include "EnzoRiemannLUT.hpp"
+#include "EnzoRiemannSimd.hpp"
 #include "EnzoRiemannUtils.hpp"
 #include "EnzoRiemannImpl.hpp"
 #include "EnzoRiemannHLL.hpp"
@@ -39,6 +39,9 @@ public: // interface
     bool mhd;
     /// Indicates if the specific internal energy is an integration quantity
     bool internal_energy;
+    /// The instruction set of the vectorized kernels ("auto", "none",
+    /// "avx2" or "avx512"). An empty string is treated as "none".
+    std::string simd;
   };
 
   /// Factory method for constructing the EnzoRiemann object.
@@ -57,6 +60,7 @@ public: // interface
       p | factory_args.solver;
       p | factory_args.mhd;
       p | factory_args.internal_energy;
+      p | factory_args.simd;
 
       if (p.isUnpacking()){
         riemann_ptr = EnzoRiemann::construct_riemann(factory_args);
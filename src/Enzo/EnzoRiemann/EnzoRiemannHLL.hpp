@@ -41,6 +41,11 @@ struct EinfeldtWavespeed
   using LUT = EnzoRiemannLUT<inputLUT>;
   using EOSStructT = EOSStructIdeal;
 
+  /// The vectorized kernel implementing `HLLKernel<EinfeldtWavespeed>`
+  static constexpr enzo_riemann_simd::kind simd_hll_kind =
+    (LUT::has_bfields) ? enzo_riemann_simd::kind::hlle_mhd
+                       : enzo_riemann_simd::kind::hlle;
+
   FORCE_INLINE void operator()(const lutarray<LUT> wl, const lutarray<LUT> wr,
                                const lutarray<LUT> Ul, const lutarray<LUT> Ur,
                                enzo_float pressure_l, enzo_float pressure_r,
@@ -190,6 +195,10 @@ public:
   using LUT = EnzoRiemannLUT<inputLUT>;
   using EOSStructT = EOSStructIdeal;
 
+  /// There is no vectorized kernel for this wavespeed estimator
+  static constexpr enzo_riemann_simd::kind simd_hll_kind =
+    enzo_riemann_simd::kind::unsupported;
+
   void operator()(const lutarray<LUT> wl, const lutarray<LUT> wr,
                   const lutarray<LUT> Ul, const lutarray<LUT> Ur,
                   enzo_float pressure_l, enzo_float pressure_r,
@@ -230,6 +239,9 @@ public: // typedefs
   using LUT = typename WaveSpeedFunctor::LUT;
   using EOSStructT = typename WaveSpeedFunctor::EOSStructT;
 
+  static constexpr enzo_riemann_simd::kind simd_kind =
+    WaveSpeedFunctor::simd_hll_kind;
+
 public: // fields
   const KernelConfig<EOSStructT> config;
 
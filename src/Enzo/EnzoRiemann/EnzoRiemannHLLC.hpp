@@ -26,6 +26,9 @@ public: // typedefs
   using LUT = typename WaveSpeedFunctor::LUT;
   using EOSStructT = EOSStructIdeal;
 
+  static constexpr enzo_riemann_simd::kind simd_kind =
+    enzo_riemann_simd::kind::hllc;
+
 public: // fields
   const KernelConfig<EOSStructT> config;
 
@@ -30,6 +30,9 @@ public: // typedefs
   using LUT = EnzoRiemannLUT<MHDLUT>;
   using EOSStructT = EOSStructIdeal;
 
+  static constexpr enzo_riemann_simd::kind simd_kind =
+    enzo_riemann_simd::kind::hlld;
+
   struct Cons1D { enzo_float d, mx, my, mz, e, by, bz; };
 
 public: // fields
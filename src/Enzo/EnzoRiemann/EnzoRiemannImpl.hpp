@@ -16,44 +16,7 @@
 // defining RIEMANN_DEBUG adds some extra error checking, useful for debugging
 //#define RIEMANN_DEBUG
 
-//----------------------------------------------------------------------
-
-struct HydroLUT {
-  /// @class    HydroLUT
-  /// @ingroup  Enzo
-  /// @brief    [\ref Enzo] Encapsulates a compile-time LUT for pure
-  ///           hydrodynamics that is used for implementing Riemann Solvers
-
-  enum vals { density=0,
-	      velocity_i,
-	      velocity_j,
-	      velocity_k,
-	      total_energy,
-	      num_entries};
-
-  // in the future, automatically calculate the following
-  static const std::size_t specific_start = 1;
-};
-
-//----------------------------------------------------------------------
-
-struct MHDLUT{
-  /// @class    MHDLUT
-  /// @ingroup  Enzo
-  /// @brief    [\ref Enzo] Encapsulates a compile-time LUT for MHD that is
-  ///           that is to be used for implementing Riemann Solvers
-  enum vals { density=0,
-	      bfield_i,
-	      bfield_j,
-	      bfield_k,
-	      velocity_i,
-	      velocity_j,
-	      velocity_k,
-	      total_energy,
-	      num_entries};
-  // in the future, automatically calculate the following
-  static const std::size_t specific_start = 4;
-};
+// HydroLUT and MHDLUT are defined in EnzoRiemannInputLUT.hpp
 
 //----------------------------------------------------------------------
 
@@ -169,6 +132,14 @@ class EnzoRiemannImpl : public EnzoRiemann
   ///      Solver when the correct name is specified.
   ///   4. Update the documentation with the name of the newly available
   ///      RiemannSolver
+  ///
+  /// `KernelFunctor` must also define `static constexpr
+  /// enzo_riemann_simd::kind simd_kind`. When this names one of the
+  /// explicitly vectorized kernels (see EnzoRiemannSimd.hpp) and an
+  /// instruction set other than "none" was selected, each row of interfaces
+  /// is solved by the vectorized kernel instead of calling `KernelFunctor`
+  /// once per interface. New solvers without a vectorized version should
+  /// use `enzo_riemann_simd::kind::unsupported`.
 
   using LUT = typename KernelFunctor::LUT;
   using EOSStructT = typename KernelFunctor::EOSStructT;
@@ -180,6 +151,8 @@ class EnzoRiemannImpl : public EnzoRiemann
                 "KernelFunctor must define the method: "
                 "void KernelFunctor::operator() (int,int,int)");
 
+  static_assert(LUT::num_entries <= enzo_riemann_simd::max_lut_entries,
+                "enzo_riemann_simd::max_lut_entries is too small");
 
 
 public: // interface
@@ -214,8 +187,13 @@ private: // helper methods
   /// @note
   /// for purposes of getting icc to vectorize code, it seems to be important
   /// that this method's contents are separated from `EnzoRiemannImpl::solve`
+  ///
+  /// @param row_solver The vectorized kernel used to solve each row of cell
+  ///     interfaces. When this is `nullptr`, `KernelFunctor` is used.
   static void solve_(const KernelConfig<EOSStructT> config,
-                     const int stale_depth) noexcept;
+                     const int stale_depth,
+                     enzo_riemann_simd::row_function_t<enzo_float> row_solver)
+    noexcept;
 
 private: //attributes
 
@@ -233,6 +211,9 @@ private: //attributes
 
   /// Holds lazily allocated scratch arrays
   enzo_riemann_utils::ScratchArrays_* scratch_ptr_;
+
+  /// The vectorized row solver (or `nullptr` to use `KernelFunctor`)
+  enzo_riemann_simd::row_function_t<enzo_float> row_solver_;
 };
 
 //----------------------------------------------------------------------
@@ -258,6 +239,16 @@ EnzoRiemannImpl<KernelFunctor>::EnzoRiemannImpl
   }
 
   scratch_ptr_ = new enzo_riemann_utils::ScratchArrays_();
+
+  enzo_riemann_simd::isa simd_isa = enzo_riemann_simd::isa::none;
+  const bool known_isa =
+    enzo_riemann_simd::parse_isa(factory_args.simd.c_str(), &simd_isa);
+  ASSERT1("EnzoRiemannImpl::EnzoRiemannImpl",
+          "\"%s\" is not a known instruction set for the vectorized Riemann "
+          "Solver kernels. Known names are \"auto\", \"none\", \"avx2\" "
+          "and \"avx512\".", factory_args.simd.c_str(), known_isa);
+  row_solver_ = enzo_riemann_simd::row_function<enzo_float>
+    (simd_isa, KernelFunctor::simd_kind);
 }
 
 //----------------------------------------------------------------------
@@ -303,7 +294,7 @@ void EnzoRiemannImpl<KernelFunctor>::solve
                                            internal_energy_flux,
                                            velocity_i_bar_array};
 
-  solve_(config, stale_depth);
+  solve_(config, stale_depth, row_solver_);
 
   enzo_riemann_utils::solve_passive_advection(prim_map_l, prim_map_r, flux_map,
                                               flux_map.at("density"),
@@ -319,7 +310,8 @@ void EnzoRiemannImpl<KernelFunctor>::solve
 
 template <class KernelFunctor>
 void EnzoRiemannImpl<KernelFunctor>::solve_
-(const KernelConfig<EOSStructT> config, const int stale_depth)
+(const KernelConfig<EOSStructT> config, const int stale_depth,
+ enzo_riemann_simd::row_function_t<enzo_float> row_solver)
   noexcept
 {
   const KernelFunctor kernel{config};
@@ -329,6 +321,38 @@ void EnzoRiemannImpl<KernelFunctor>::solve_
   const int my = config.flux_arr.shape(2);
   const int mx = config.flux_arr.shape(3);
 
+  if (row_solver != nullptr) {
+    // map the LUT entries to the (unpermuted) indices of the arrays. This
+    // permutes the components of vector quantities the same way as the
+    // kernels do.
+    int index[LUT::num_entries];
+    for (int i = 0; i < LUT::num_entries; i++){ index[i] = i; }
+    for (int c = 0; c < 3; c++){
+      index[LUT::velocity_i + c] = LUT::velocity_i + (config.dim + c) % 3;
+      if (LUT::has_bfields){
+        index[LUT::bfield_i + c] = LUT::bfield_i + (config.dim + c) % 3;
+      }
+    }
+
+    enzo_riemann_simd::RowArgs<enzo_float> args;
+    args.n = mx - 2*stale_depth;
+    args.gamma = config.eos.get_gamma();
+    for (int iz = stale_depth; iz < mz - stale_depth; iz++) {
+      for (int iy = stale_depth; iy < my - stale_depth; iy++) {
+        for (int i = 0; i < LUT::num_entries; i++){
+          args.prim_l[i] = &config.prim_arr_l(index[i],iz,iy,stale_depth);
+          args.prim_r[i] = &config.prim_arr_r(index[i],iz,iy,stale_depth);
+          args.flux[i] = &config.flux_arr(index[i],iz,iy,stale_depth);
+        }
+        args.internal_energy_flux =
+          &config.internal_energy_flux_arr(iz,iy,stale_depth);
+        args.velocity_i_bar = &config.velocity_i_bar_arr(iz,iy,stale_depth);
+        row_solver(args);
+      }
+    }
+    return;
+  }
+
   // compute the flux at all non-stale cell interfaces
   for (int iz = stale_depth; iz < mz - stale_depth; iz++) {
     for (int iy = stale_depth; iy < my - stale_depth; iy++) {
@@ -0,0 +1,57 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     EnzoRiemannInputLUT.hpp
+/// @author   Matthew Abruzzo (matthewabruzzo@gmail.com)
+/// @date     Thurs May 16 2019
+/// @brief    [\ref Enzo] Declaration of the compile-time LUTs that are
+/// wrapped by EnzoRiemannLUT to implement the Riemann Solvers.
+///
+/// These are kept free of other dependencies so that they can also be used
+/// by the explicitly vectorized kernels (see EnzoRiemannSimd.hpp), which are
+/// compiled without the rest of the Enzo layer.
+
+#ifndef ENZO_ENZO_RIEMANN_INPUT_LUT_HPP
+#define ENZO_ENZO_RIEMANN_INPUT_LUT_HPP
+
+#include <cstddef>
+
+//----------------------------------------------------------------------
+
+struct HydroLUT {
+  /// @class    HydroLUT
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Encapsulates a compile-time LUT for pure
+  ///           hydrodynamics that is used for implementing Riemann Solvers
+
+  enum vals { density=0,
+	      velocity_i,
+	      velocity_j,
+	      velocity_k,
+	      total_energy,
+	      num_entries};
+
+  // in the future, automatically calculate the following
+  static const std::size_t specific_start = 1;
+};
+
+//----------------------------------------------------------------------
+
+struct MHDLUT{
+  /// @class    MHDLUT
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Encapsulates a compile-time LUT for MHD that is
+  ///           that is to be used for implementing Riemann Solvers
+  enum vals { density=0,
+	      bfield_i,
+	      bfield_j,
+	      bfield_k,
+	      velocity_i,
+	      velocity_j,
+	      velocity_k,
+	      total_energy,
+	      num_entries};
+  // in the future, automatically calculate the following
+  static const std::size_t specific_start = 4;
+};
+
+#endif /* ENZO_ENZO_RIEMANN_INPUT_LUT_HPP */
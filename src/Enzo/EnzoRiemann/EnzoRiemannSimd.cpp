@@ -0,0 +1,108 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     EnzoRiemannSimd.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Enzo] Runtime selection of the vectorized Riemann Solver
+/// kernels
+///
+/// This file is compiled for the baseline instruction set and must not
+/// include any other part of Enzo-E or Cello.
+
+#include <cstring>
+
+#include "EnzoRiemannSimdKernels.hpp"
+
+namespace enzo_riemann_simd {
+
+  //----------------------------------------------------------------------
+
+  bool is_available(isa set)
+  {
+    switch (set) {
+    case isa::none:
+      return true;
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+    case isa::avx2:
+      return (row_kernels_avx2_<double>() != nullptr &&
+              __builtin_cpu_supports("avx2"));
+    case isa::avx512:
+      return (row_kernels_avx512_<double>() != nullptr &&
+              __builtin_cpu_supports("avx512f"));
+#endif
+    default:
+      return false;
+    }
+  }
+
+  //----------------------------------------------------------------------
+
+  isa host_isa()
+  {
+    static const isa set =
+      is_available(isa::avx512) ? isa::avx512 :
+      (is_available(isa::avx2) ? isa::avx2 : isa::none);
+    return set;
+  }
+
+  //----------------------------------------------------------------------
+
+  bool parse_isa(const char * name, isa * set)
+  {
+    isa requested;
+    if (name == nullptr || strcmp(name,"") == 0 || strcmp(name,"none") == 0) {
+      requested = isa::none;
+    } else if (strcmp(name,"auto") == 0) {
+      *set = host_isa();
+      return true;
+    } else if (strcmp(name,"avx2") == 0) {
+      requested = isa::avx2;
+    } else if (strcmp(name,"avx512") == 0) {
+      requested = isa::avx512;
+    } else {
+      return false;
+    }
+    // fall back to narrower instruction sets
+    while (! is_available(requested)) {
+      requested = (isa)((int)requested - 1);
+    }
+    *set = requested;
+    return true;
+  }
+
+  //----------------------------------------------------------------------
+
+  const char * isa_name(isa set)
+  {
+    switch (set) {
+    case isa::avx2:   return "avx2";
+    case isa::avx512: return "avx512";
+    default:          return "none";
+    }
+  }
+
+  //----------------------------------------------------------------------
+
+  template <typename T>
+  static const RowKernels<T> * row_kernels_(isa set)
+  {
+    if (! is_available(set)) return nullptr;
+    switch (set) {
+    case isa::avx2:   return row_kernels_avx2_<T>();
+    case isa::avx512: return row_kernels_avx512_<T>();
+    default: {
+      static const RowKernels<T> kernels = make_row_kernels_<ScalarOps<T>>();
+      return &kernels;
+    }
+    }
+  }
+
+  template <>
+  const RowKernels<float> * row_kernels<float>(isa set)
+  { return row_kernels_<float>(set); }
+
+  template <>
+  const RowKernels<double> * row_kernels<double>(isa set)
+  { return row_kernels_<double>(set); }
+
+}
@@ -0,0 +1,105 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     EnzoRiemannSimd.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Enzo] Interface to the explicitly vectorized Riemann
+/// Solver kernels
+///
+/// The kernels compute the fluxes at a row of contiguous cell interfaces
+/// (along the x-axis) several interfaces at a time.  They are compiled once
+/// for each supported instruction set, in translation units that include
+/// nothing but this header, EnzoRiemannInputLUT.hpp and
+/// EnzoRiemannSimdKernels.hpp.  This keeps instructions that the host may
+/// not support from leaking into inline functions shared with the rest of
+/// the code.  The instruction set is chosen at runtime.
+
+#ifndef ENZO_ENZO_RIEMANN_SIMD_HPP
+#define ENZO_ENZO_RIEMANN_SIMD_HPP
+
+namespace enzo_riemann_simd {
+
+  /// Instruction sets with a vectorized implementation
+  enum class isa { none = 0, avx2, avx512 };
+
+  /// Riemann Solver kernels with a vectorized implementation
+  enum class kind { unsupported = -1,
+                    hlle = 0,  // HLLKernel<EinfeldtWavespeed<HydroLUT>>
+                    hlle_mhd,  // HLLKernel<EinfeldtWavespeed<MHDLUT>>
+                    hllc,      // HLLCKernel
+                    hlld,      // HLLDKernel
+                    num_kinds };
+
+  /// Upper bound on the number of LUT entries of any kernel
+  const int max_lut_entries = 8;
+
+  /// Arguments for solving a row of `n` cell interfaces.
+  ///
+  /// Each pointer addresses the first interface of the row, and consecutive
+  /// interfaces are contiguous in memory.  The pointer arrays are indexed
+  /// by the kernel's input LUT (`HydroLUT` or `MHDLUT`), after the
+  /// `i`,`j`,`k` components of vector quantities have been permuted to
+  /// match the direction of the solve (as in `KernelConfig`).  Primitives
+  /// hold the pressure in place of the total energy.
+  template <typename T>
+  struct RowArgs {
+    int n;
+    T gamma;
+    const T * prim_l[max_lut_entries];
+    const T * prim_r[max_lut_entries];
+    T * flux[max_lut_entries];
+    T * internal_energy_flux;
+    T * velocity_i_bar;
+  };
+
+  template <typename T>
+  using row_function_t = void (*)(const RowArgs<T> &);
+
+  /// Table of row solvers for a given instruction set and precision
+  template <typename T>
+  struct RowKernels {
+    /// number of interfaces solved at a time
+    int width;
+    row_function_t<T> solve[(int)kind::num_kinds];
+  };
+
+  /// Return the table of row solvers for an instruction set, or nullptr if
+  /// it was not compiled in.  `isa::none` returns the same kernels compiled
+  /// with a width of 1, which is useful as a reference.
+  template <typename T> const RowKernels<T> * row_kernels(isa set);
+  template <> const RowKernels<float> *  row_kernels<float>(isa set);
+  template <> const RowKernels<double> * row_kernels<double>(isa set);
+
+  /// Whether the instruction set was compiled in and is supported by the
+  /// host processor
+  bool is_available(isa set);
+
+  /// The widest instruction set that is available
+  isa host_isa();
+
+  /// Parse "auto", "none", "avx2" or "avx512" (an empty string is treated
+  /// as "none").  Requests for an instruction set that isn't available fall
+  /// back to the widest one that is.  Returns false for unknown names.
+  bool parse_isa(const char * name, isa * set);
+
+  /// Name of an instruction set
+  const char * isa_name(isa set);
+
+  /// Return the row solver to use for the kernel, or nullptr if the scalar
+  /// `KernelFunctor` should be used instead
+  template <typename T>
+  inline row_function_t<T> row_function(isa set, kind k)
+  {
+    if (set == isa::none || k == kind::unsupported) return nullptr;
+    const RowKernels<T> * kernels = row_kernels<T>(set);
+    return (kernels == nullptr) ? nullptr : kernels->solve[(int)k];
+  }
+
+  /// Vectorized kernels are not compiled for extended precision
+  template <>
+  inline row_function_t<long double> row_function<long double>(isa, kind)
+  { return nullptr; }
+
+}
+
+#endif /* ENZO_ENZO_RIEMANN_SIMD_HPP */
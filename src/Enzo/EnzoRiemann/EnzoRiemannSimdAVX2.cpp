@@ -0,0 +1,140 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     EnzoRiemannSimdAVX2.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Enzo] AVX2 instantiation of the vectorized Riemann
+/// Solver kernels
+///
+/// This file is compiled with -mavx2 (see CMakeLists.txt) and must not
+/// include any other part of Enzo-E or Cello.
+
+#include "EnzoRiemannSimdKernels.hpp"
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+namespace enzo_riemann_simd {
+
+  namespace {
+
+    struct Avx2OpsDouble {
+      typedef double T;
+      typedef __m256d V;
+      typedef __m256d M;
+      static const int width = 4;
+
+      static RIEMANN_SIMD_INLINE __m256i tail_(int n)
+      { return _mm256_cmpgt_epi64(_mm256_set1_epi64x(n),
+                                  _mm256_setr_epi64x(0,1,2,3)); }
+
+      static RIEMANN_SIMD_INLINE V set1(T a) { return _mm256_set1_pd(a); }
+      static RIEMANN_SIMD_INLINE V loadu(const T * p)
+      { return _mm256_loadu_pd(p); }
+      static RIEMANN_SIMD_INLINE void storeu(T * p, V a)
+      { _mm256_storeu_pd(p, a); }
+      static RIEMANN_SIMD_INLINE V load_tail(const T * p, int n)
+      {
+        const __m256i m = tail_(n);
+        return _mm256_blendv_pd(_mm256_set1_pd(1.0), _mm256_maskload_pd(p, m),
+                                _mm256_castsi256_pd(m));
+      }
+      static RIEMANN_SIMD_INLINE void store_tail(T * p, V a, int n)
+      { _mm256_maskstore_pd(p, tail_(n), a); }
+
+      static RIEMANN_SIMD_INLINE V sqrt(V a) { return _mm256_sqrt_pd(a); }
+      static RIEMANN_SIMD_INLINE V abs(V a)
+      { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+      // operands are swapped so that ties and NaNs behave as std::min/max
+      static RIEMANN_SIMD_INLINE V min(V a, V b) { return _mm256_min_pd(b, a); }
+      static RIEMANN_SIMD_INLINE V max(V a, V b) { return _mm256_max_pd(b, a); }
+
+      static RIEMANN_SIMD_INLINE M lt(V a, V b)
+      { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+      static RIEMANN_SIMD_INLINE M le(V a, V b)
+      { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+      static RIEMANN_SIMD_INLINE M gt(V a, V b)
+      { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+      static RIEMANN_SIMD_INLINE M ge(V a, V b)
+      { return _mm256_cmp_pd(a, b, _CMP_GE_OQ); }
+      static RIEMANN_SIMD_INLINE M mand(M a, M b) { return _mm256_and_pd(a, b); }
+      static RIEMANN_SIMD_INLINE V select(M m, V a, V b)
+      { return _mm256_blendv_pd(b, a, m); }
+    };
+
+    struct Avx2OpsFloat {
+      typedef float T;
+      typedef __m256 V;
+      typedef __m256 M;
+      static const int width = 8;
+
+      static RIEMANN_SIMD_INLINE __m256i tail_(int n)
+      { return _mm256_cmpgt_epi32(_mm256_set1_epi32(n),
+                                  _mm256_setr_epi32(0,1,2,3,4,5,6,7)); }
+
+      static RIEMANN_SIMD_INLINE V set1(T a) { return _mm256_set1_ps(a); }
+      static RIEMANN_SIMD_INLINE V loadu(const T * p)
+      { return _mm256_loadu_ps(p); }
+      static RIEMANN_SIMD_INLINE void storeu(T * p, V a)
+      { _mm256_storeu_ps(p, a); }
+      static RIEMANN_SIMD_INLINE V load_tail(const T * p, int n)
+      {
+        const __m256i m = tail_(n);
+        return _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_maskload_ps(p, m),
+                                _mm256_castsi256_ps(m));
+      }
+      static RIEMANN_SIMD_INLINE void store_tail(T * p, V a, int n)
+      { _mm256_maskstore_ps(p, tail_(n), a); }
+
+      static RIEMANN_SIMD_INLINE V sqrt(V a) { return _mm256_sqrt_ps(a); }
+      static RIEMANN_SIMD_INLINE V abs(V a)
+      { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+      static RIEMANN_SIMD_INLINE V min(V a, V b) { return _mm256_min_ps(b, a); }
+      static RIEMANN_SIMD_INLINE V max(V a, V b) { return _mm256_max_ps(b, a); }
+
+      static RIEMANN_SIMD_INLINE M lt(V a, V b)
+      { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+      static RIEMANN_SIMD_INLINE M le(V a, V b)
+      { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+      static RIEMANN_SIMD_INLINE M gt(V a, V b)
+      { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+      static RIEMANN_SIMD_INLINE M ge(V a, V b)
+      { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+      static RIEMANN_SIMD_INLINE M mand(M a, M b) { return _mm256_and_ps(a, b); }
+      static RIEMANN_SIMD_INLINE V select(M m, V a, V b)
+      { return _mm256_blendv_ps(b, a, m); }
+    };
+
+  }
+
+  template <>
+  const RowKernels<double> * row_kernels_avx2_<double>()
+  {
+    static const RowKernels<double> kernels
+      = make_row_kernels_<Avx2OpsDouble>();
+    return &kernels;
+  }
+
+  template <>
+  const RowKernels<float> * row_kernels_avx2_<float>()
+  {
+    static const RowKernels<float> kernels = make_row_kernels_<Avx2OpsFloat>();
+    return &kernels;
+  }
+
+}
+
+#else /* ! __AVX2__ */
+
+namespace enzo_riemann_simd {
+
+  template <>
+  const RowKernels<double> * row_kernels_avx2_<double>() { return nullptr; }
+
+  template <>
+  const RowKernels<float> * row_kernels_avx2_<float>() { return nullptr; }
+
+}
+
+#endif /* __AVX2__ */
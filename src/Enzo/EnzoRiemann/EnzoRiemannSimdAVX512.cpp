@@ -0,0 +1,135 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     EnzoRiemannSimdAVX512.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Enzo] AVX-512 instantiation of the vectorized Riemann
+/// Solver kernels
+///
+/// This file is compiled with -mavx512f (see CMakeLists.txt) and must not
+/// include any other part of Enzo-E or Cello.
+
+#include "EnzoRiemannSimdKernels.hpp"
+
+#if defined(__AVX512F__)
+
+// GCC 12 reports _mm512_undefined_pd() within its own intrinsics as
+// possibly uninitialized
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+#include <immintrin.h>
+
+namespace enzo_riemann_simd {
+
+  namespace {
+
+    // comparisons produce mask registers, and selects are masked blends
+
+    struct Avx512OpsDouble {
+      typedef double T;
+      typedef __m512d V;
+      typedef __mmask8 M;
+      static const int width = 8;
+
+      static RIEMANN_SIMD_INLINE M tail_(int n)
+      { return (M)((1u << n) - 1u); }
+
+      static RIEMANN_SIMD_INLINE V set1(T a) { return _mm512_set1_pd(a); }
+      static RIEMANN_SIMD_INLINE V loadu(const T * p)
+      { return _mm512_loadu_pd(p); }
+      static RIEMANN_SIMD_INLINE void storeu(T * p, V a)
+      { _mm512_storeu_pd(p, a); }
+      static RIEMANN_SIMD_INLINE V load_tail(const T * p, int n)
+      { return _mm512_mask_loadu_pd(_mm512_set1_pd(1.0), tail_(n), p); }
+      static RIEMANN_SIMD_INLINE void store_tail(T * p, V a, int n)
+      { _mm512_mask_storeu_pd(p, tail_(n), a); }
+
+      static RIEMANN_SIMD_INLINE V sqrt(V a) { return _mm512_sqrt_pd(a); }
+      static RIEMANN_SIMD_INLINE V abs(V a) { return _mm512_abs_pd(a); }
+      // operands are swapped so that ties and NaNs behave as std::min/max
+      static RIEMANN_SIMD_INLINE V min(V a, V b) { return _mm512_min_pd(b, a); }
+      static RIEMANN_SIMD_INLINE V max(V a, V b) { return _mm512_max_pd(b, a); }
+
+      static RIEMANN_SIMD_INLINE M lt(V a, V b)
+      { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+      static RIEMANN_SIMD_INLINE M le(V a, V b)
+      { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+      static RIEMANN_SIMD_INLINE M gt(V a, V b)
+      { return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ); }
+      static RIEMANN_SIMD_INLINE M ge(V a, V b)
+      { return _mm512_cmp_pd_mask(a, b, _CMP_GE_OQ); }
+      static RIEMANN_SIMD_INLINE M mand(M a, M b) { return (M)(a & b); }
+      static RIEMANN_SIMD_INLINE V select(M m, V a, V b)
+      { return _mm512_mask_blend_pd(m, b, a); }
+    };
+
+    struct Avx512OpsFloat {
+      typedef float T;
+      typedef __m512 V;
+      typedef __mmask16 M;
+      static const int width = 16;
+
+      static RIEMANN_SIMD_INLINE M tail_(int n)
+      { return (M)((1u << n) - 1u); }
+
+      static RIEMANN_SIMD_INLINE V set1(T a) { return _mm512_set1_ps(a); }
+      static RIEMANN_SIMD_INLINE V loadu(const T * p)
+      { return _mm512_loadu_ps(p); }
+      static RIEMANN_SIMD_INLINE void storeu(T * p, V a)
+      { _mm512_storeu_ps(p, a); }
+      static RIEMANN_SIMD_INLINE V load_tail(const T * p, int n)
+      { return _mm512_mask_loadu_ps(_mm512_set1_ps(1.0f), tail_(n), p); }
+      static RIEMANN_SIMD_INLINE void store_tail(T * p, V a, int n)
+      { _mm512_mask_storeu_ps(p, tail_(n), a); }
+
+      static RIEMANN_SIMD_INLINE V sqrt(V a) { return _mm512_sqrt_ps(a); }
+      static RIEMANN_SIMD_INLINE V abs(V a) { return _mm512_abs_ps(a); }
+      static RIEMANN_SIMD_INLINE V min(V a, V b) { return _mm512_min_ps(b, a); }
+      static RIEMANN_SIMD_INLINE V max(V a, V b) { return _mm512_max_ps(b, a); }
+
+      static RIEMANN_SIMD_INLINE M lt(V a, V b)
+      { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+      static RIEMANN_SIMD_INLINE M le(V a, V b)
+      { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+      static RIEMANN_SIMD_INLINE M gt(V a, V b)
+      { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+      static RIEMANN_SIMD_INLINE M ge(V a, V b)
+      { return _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ); }
+      static RIEMANN_SIMD_INLINE M mand(M a, M b) { return (M)(a & b); }
+      static RIEMANN_SIMD_INLINE V select(M m, V a, V b)
+      { return _mm512_mask_blend_ps(m, b, a); }
+    };
+
+  }
+
+  template <>
+  const RowKernels<double> * row_kernels_avx512_<double>()
+  {
+    static const RowKernels<double> kernels
+      = make_row_kernels_<Avx512OpsDouble>();
+    return &kernels;
+  }
+
+  template <>
+  const RowKernels<float> * row_kernels_avx512_<float>()
+  {
+    static const RowKernels<float> kernels
+      = make_row_kernels_<Avx512OpsFloat>();
+    return &kernels;
+  }
+
+}
+
+#else /* ! __AVX512F__ */
+
+namespace enzo_riemann_simd {
+
+  template <>
+  const RowKernels<double> * row_kernels_avx512_<double>() { return nullptr; }
+
+  template <>
+  const RowKernels<float> * row_kernels_avx512_<float>() { return nullptr; }
+
+}
+
+#endif /* __AVX512F__ */
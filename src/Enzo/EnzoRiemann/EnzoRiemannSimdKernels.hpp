@@ -0,0 +1,761 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     EnzoRiemannSimdKernels.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Enzo] Lane-parallel implementations of the HLLE, HLLC
+/// and HLLD Riemann Solver kernels
+///
+/// Each kernel is a transcription of the corresponding scalar kernel
+/// (HLLKernel<EinfeldtWavespeed<LUT>>, HLLCKernel and HLLDKernel) with
+/// `enzo_float` replaced by a pack of lanes.  Every branch of the scalar
+/// kernels is evaluated on all lanes and the results are combined with
+/// masks.  The order of floating point operations follows the scalar
+/// kernels, so the results are identical when neither is compiled with
+/// floating point contraction or value-unsafe optimizations.
+///
+/// The pack type and its operations are supplied by an "Ops" class:
+///
+///     struct Ops {
+///       typedef ... T;   // element type (float or double)
+///       typedef ... V;   // pack of `width` elements supporting + - * /
+///       typedef ... M;   // mask produced by comparisons
+///       static const int width;
+///       static V set1(T);
+///       static V loadu(const T*);   static void storeu(T*, V);
+///       // the first n lanes; the remaining lanes of load_tail are set to 1
+///       static V load_tail(const T*, int n);
+///       static void store_tail(T*, V, int n);
+///       static V sqrt(V);  static V abs(V);
+///       static V min(V,V); static V max(V,V);  // as std::min and std::max
+///       static M lt(V,V);  static M le(V,V);  static M gt(V,V);
+///       static M ge(V,V);
+///       static M mand(M,M);
+///       static V select(M m, V a, V b);      // m ? a : b
+///     };
+///
+/// This header must only be included by EnzoRiemannSimd*.cpp
+
+#ifndef ENZO_ENZO_RIEMANN_SIMD_KERNELS_HPP
+#define ENZO_ENZO_RIEMANN_SIMD_KERNELS_HPP
+
+#include "EnzoRiemannInputLUT.hpp"
+#include "EnzoRiemannSimd.hpp"
+
+#define RIEMANN_SIMD_INLINE inline __attribute__((always_inline))
+
+// matches SMALL_NUMBER in EnzoRiemannHLLD.hpp
+#define RIEMANN_SIMD_SMALL_NUMBER 1.0e-8
+
+namespace enzo_riemann_simd {
+
+  //----------------------------------------------------------------------
+
+  /// Scalar operations: compiles the kernels with a width of one
+  template <typename TT>
+  struct ScalarOps {
+    typedef TT T;
+    typedef TT V;
+    typedef bool M;
+    static const int width = 1;
+    static RIEMANN_SIMD_INLINE V set1(T a) { return a; }
+    static RIEMANN_SIMD_INLINE V loadu(const T * p) { return *p; }
+    static RIEMANN_SIMD_INLINE void storeu(T * p, V a) { *p = a; }
+    static RIEMANN_SIMD_INLINE V load_tail(const T * p, int) { return *p; }
+    static RIEMANN_SIMD_INLINE void store_tail(T * p, V a, int) { *p = a; }
+    static RIEMANN_SIMD_INLINE float sqrt(float a)
+    { return __builtin_sqrtf(a); }
+    static RIEMANN_SIMD_INLINE double sqrt(double a)
+    { return __builtin_sqrt(a); }
+    static RIEMANN_SIMD_INLINE V abs(V a) { return (a < 0) ? -a : a; }
+    static RIEMANN_SIMD_INLINE V min(V a, V b) { return (b < a) ? b : a; }
+    static RIEMANN_SIMD_INLINE V max(V a, V b) { return (a < b) ? b : a; }
+    static RIEMANN_SIMD_INLINE M lt(V a, V b) { return a < b; }
+    static RIEMANN_SIMD_INLINE M le(V a, V b) { return a <= b; }
+    static RIEMANN_SIMD_INLINE M gt(V a, V b) { return a > b; }
+    static RIEMANN_SIMD_INLINE M ge(V a, V b) { return a >= b; }
+    static RIEMANN_SIMD_INLINE M mand(M a, M b) { return a && b; }
+    static RIEMANN_SIMD_INLINE V select(M m, V a, V b) { return m ? a : b; }
+  };
+
+  //----------------------------------------------------------------------
+
+  /// Loads and stores the lanes of a row starting at interface ix.  When
+  /// Tail is true, only the first n lanes are valid.  The invalid lanes
+  /// are filled with a uniform state (density, pressure, velocity and
+  /// magnetic field all equal to 1), which keeps them free of division by
+  /// zero; their results are never stored.
+  template <class O, bool Tail>
+  struct LaneIO_ {
+    typedef typename O::T T;
+    typedef typename O::V V;
+    int ix;
+    int n;
+    RIEMANN_SIMD_INLINE V load(const T * p) const
+    { return Tail ? O::load_tail(p + ix, n) : O::loadu(p + ix); }
+    RIEMANN_SIMD_INLINE void store(T * p, V a) const
+    { if (Tail) { O::store_tail(p + ix, a, n); } else { O::storeu(p + ix, a); } }
+  };
+
+  //----------------------------------------------------------------------
+
+  /// Primitives on one side of the interfaces (components are already
+  /// permuted: i is along the direction of the solve)
+  template <class O>
+  struct Prim_ {
+    typename O::V d, vi, vj, vk, bi, bj, bk, p;
+  };
+
+  /// Conserved quantities on one side of the interfaces (and also used
+  /// for fluxes)
+  template <class O>
+  struct Cons_ {
+    typename O::V d, mi, mj, mk, e, bi, bj, bk;
+  };
+
+  template <class LUT> struct has_bfields_
+  { static const bool value = false; };
+  template <> struct has_bfields_<MHDLUT>
+  { static const bool value = true; };
+
+  template <class LUT, class O, class IO>
+  RIEMANN_SIMD_INLINE Prim_<O> load_hydro_prim_
+  (const typename O::T * const * prim, const IO & io)
+  {
+    Prim_<O> w;
+    w.d  = io.load(prim[LUT::density]);
+    w.vi = io.load(prim[LUT::velocity_i]);
+    w.vj = io.load(prim[LUT::velocity_j]);
+    w.vk = io.load(prim[LUT::velocity_k]);
+    // this actually stores pressure:
+    w.p  = io.load(prim[LUT::total_energy]);
+    w.bi = w.bj = w.bk = O::set1(0);
+    return w;
+  }
+
+  template <class O, class IO>
+  RIEMANN_SIMD_INLINE Prim_<O> load_mhd_prim_
+  (const typename O::T * const * prim, const IO & io)
+  {
+    Prim_<O> w = load_hydro_prim_<MHDLUT,O>(prim, io);
+    w.bi = io.load(prim[MHDLUT::bfield_i]);
+    w.bj = io.load(prim[MHDLUT::bfield_j]);
+    w.bk = io.load(prim[MHDLUT::bfield_k]);
+    return w;
+  }
+
+  template <bool MHD, class LUT, class O, class IO>
+  RIEMANN_SIMD_INLINE Prim_<O> load_prim_
+  (const typename O::T * const * prim, const IO & io)
+  {
+    return MHD ? load_mhd_prim_<O>(prim, io)
+               : load_hydro_prim_<LUT,O>(prim, io);
+  }
+
+  //----------------------------------------------------------------------
+
+  /// squared magnitude, with the same association as squared_mag_vec3D
+  template <class V>
+  RIEMANN_SIMD_INLINE V squared_mag_(V i, V j, V k)
+  { return ((i*i) + ((j*j) + (k*k))); }
+
+  /// mirrors enzo_riemann_utils::compute_conserved
+  template <bool MHD, class O>
+  RIEMANN_SIMD_INLINE Cons_<O> conserved_(const Prim_<O> & w,
+                                          typename O::V gamma)
+  {
+    typedef typename O::V V;
+    Cons_<O> u;
+    u.d  = w.d;
+    u.mi = w.vi * w.d;
+    u.mj = w.vj * w.d;
+    u.mk = w.vk * w.d;
+    u.bi = w.bi;
+    u.bj = w.bj;
+    u.bk = w.bk;
+    const V internal_edens = w.p / (gamma - O::set1(1.0));
+    const V kinetic_edens = (O::set1(0.5) * w.d) * squared_mag_(w.vi,w.vj,w.vk);
+    u.e = internal_edens + kinetic_edens;
+    if (MHD) { u.e = u.e + O::set1(0.5) * squared_mag_(w.bi, w.bj, w.bk); }
+    return u;
+  }
+
+  /// mirrors enzo_riemann_utils::fast_magnetosonic_speed
+  template <bool MHD, class O>
+  RIEMANN_SIMD_INLINE typename O::V fast_speed_(const Prim_<O> & w,
+                                                typename O::V gamma)
+  {
+    typedef typename O::V V;
+    const V cs2 = gamma * w.p / w.d;
+    if (!MHD) return O::sqrt(cs2);
+    const V B2 = squared_mag_(w.bi, w.bj, w.bk);
+    const V inv_density = O::set1(1.0) / w.d;
+    const V va2 = B2 * inv_density;
+    const V va2_cos2 = (w.bi * w.bi) * inv_density;
+    const V sum = cs2 + va2;
+    return O::sqrt(O::set1(0.5) *
+                   (va2 + cs2 + O::sqrt(sum*sum - O::set1(4.) * cs2 * va2_cos2)));
+  }
+
+  /// mirrors enzo_riemann_utils::active_fluxes
+  template <bool MHD, class O>
+  RIEMANN_SIMD_INLINE Cons_<O> active_fluxes_(const Prim_<O> & w,
+                                              const Cons_<O> & u)
+  {
+    Cons_<O> f;
+    if (MHD) {
+      const typename O::V ptot =
+        w.p + O::set1(0.5) * squared_mag_(w.bi, w.bj, w.bk);
+      f.d  = u.mi;
+      f.mi = u.mi*w.vi - w.bi*w.bi + ptot;
+      f.mj = u.mi*w.vj - w.bj*w.bi;
+      f.mk = u.mi*w.vk - w.bk*w.bi;
+      f.e  = ((u.e + ptot)*w.vi
+              - (w.bi*w.vi + (w.bj*w.vj + w.bk*w.vk))*w.bi);
+      f.bi = O::set1(0);
+      f.bj = w.bj*w.vi - w.bi*w.vj;
+      f.bk = w.bk*w.vi - w.bi*w.vk;
+    } else {
+      f.d  = u.mi;
+      f.mi = u.mi*w.vi + w.p;
+      f.mj = u.mi*w.vj;
+      f.mk = u.mi*w.vk;
+      f.e  = (u.e + w.p)*w.vi;
+      f.bi = f.bj = f.bk = O::set1(0);
+    }
+    return f;
+  }
+
+  /// mirrors enzo_riemann_utils::passive_eint_flux
+  template <class O>
+  RIEMANN_SIMD_INLINE typename O::V passive_eint_flux_
+  (const Prim_<O> & wl, const Prim_<O> & wr, typename O::V gamma,
+   typename O::V density_flux)
+  {
+    typedef typename O::V V;
+    const V gm1 = gamma - O::set1(1.0);
+    const V eint_l = wl.p / (gm1 * wl.d);
+    const V eint_r = wr.p / (gm1 * wr.d);
+    const V upwind = O::select(O::gt(density_flux, O::set1(0)), eint_l, eint_r);
+    return upwind * density_flux;
+  }
+
+  //----------------------------------------------------------------------
+
+  /// mirrors EinfeldtWavespeed<LUT>::operator()
+  template <bool MHD, class O>
+  RIEMANN_SIMD_INLINE void einfeldt_wavespeeds_
+  (const Prim_<O> & wl, const Prim_<O> & wr,
+   const Cons_<O> & ul, const Cons_<O> & ur, typename O::V gamma,
+   typename O::V * bp, typename O::V * bm)
+  {
+    typedef typename O::V V;
+    const V one = O::set1(1.0);
+    const V half = O::set1(0.5);
+
+    const V c_l = fast_speed_<MHD,O>(wl, gamma);
+    const V c_r = fast_speed_<MHD,O>(wr, gamma);
+
+    const V left_speed = (wl.vi - c_l);
+    const V right_speed = (wr.vi + c_r);
+
+    const V sqrtrho_l = O::sqrt(wl.d);
+    const V sqrtrho_r = O::sqrt(wr.d);
+    const V inv_sqrtrho_tot = one/(sqrtrho_l + sqrtrho_r);
+
+    const V vi_roe = (sqrtrho_l * wl.vi + sqrtrho_r * wr.vi) * inv_sqrtrho_tot;
+    const V vj_roe = (sqrtrho_l * wl.vj + sqrtrho_r * wr.vj) * inv_sqrtrho_tot;
+    const V vk_roe = (sqrtrho_l * wl.vk + sqrtrho_r * wr.vk) * inv_sqrtrho_tot;
+    const V v_roe2 = vi_roe*vi_roe + vj_roe*vj_roe + vk_roe*vk_roe;
+
+    V ptot_l = wl.p;
+    V ptot_r = wr.p;
+    if (MHD) {
+      ptot_l = ptot_l + half * squared_mag_(wl.bi, wl.bj, wl.bk);
+      ptot_r = ptot_r + half * squared_mag_(wr.bi, wr.bj, wr.bk);
+    }
+
+    const V h_l = (ul.e + ptot_l) / wl.d;
+    const V h_r = (ur.e + ptot_r) / wr.d;
+    const V h_roe = (sqrtrho_l * h_l + sqrtrho_r * h_r) * inv_sqrtrho_tot;
+
+    V c_roe;
+    if (MHD) {
+      // mirrors EinfeldtWavespeed<LUT>::roe_cfast_
+      const V rho_roe = sqrtrho_l*sqrtrho_r;
+      const V bi_roe = wl.bi;
+      const V bj_roe = (sqrtrho_l * wr.bj + sqrtrho_r * wl.bj) * inv_sqrtrho_tot;
+      const V bk_roe = (sqrtrho_l * wr.bk + sqrtrho_r * wl.bk) * inv_sqrtrho_tot;
+      const V b_roe2 = bi_roe*bi_roe + bj_roe*bj_roe + bk_roe*bk_roe;
+
+      const V gamma_prime = gamma - one;
+      const V dbj = wl.bj - wr.bj;
+      const V dbk = wl.bk - wr.bk;
+      const V x_prime = ((dbj*dbj + dbk*dbk) * half * (gamma_prime - one) *
+                         inv_sqrtrho_tot);
+      const V y_prime = ((gamma_prime - one) * (wl.d + wr.d) * half / rho_roe);
+      const V tilde_a2 = (gamma_prime * (h_roe - half * v_roe2 - b_roe2/rho_roe)
+                          - x_prime);
+      const V tilde_vai2 = bi_roe * bi_roe / rho_roe;
+      const V tilde_va2 = (tilde_vai2 + (gamma_prime - y_prime) *
+                           (bj_roe * bj_roe + bk_roe * bk_roe) / rho_roe);
+      const V sum = tilde_a2 + tilde_va2;
+      c_roe = O::sqrt(half * (tilde_a2 + tilde_va2 +
+                              O::sqrt(sum*sum - O::set1(4) * tilde_a2 *
+                                      tilde_vai2)));
+    } else {
+      // mirrors EinfeldtWavespeed<LUT>::roe_cs_
+      const V temp = h_roe - half * v_roe2;
+      c_roe = O::sqrt((gamma - one) * O::max(temp, O::set1(0)));
+    }
+
+    *bp = O::max(vi_roe + c_roe, right_speed);
+    *bm = O::min(vi_roe - c_roe, left_speed);
+  }
+
+  //----------------------------------------------------------------------
+
+  /// mirrors HLLKernel<EinfeldtWavespeed<LUT>>
+  template <class LUT>
+  struct HLLEFace_ {
+    template <class O, class IO>
+    static RIEMANN_SIMD_INLINE void apply(const RowArgs<typename O::T> & a,
+                                          const IO & io)
+    {
+      typedef typename O::V V;
+      const bool MHD = has_bfields_<LUT>::value;
+
+      const Prim_<O> wl = load_prim_<MHD,LUT,O>(a.prim_l, io);
+      const Prim_<O> wr = load_prim_<MHD,LUT,O>(a.prim_r, io);
+      const V gamma = O::set1(a.gamma);
+
+      const Cons_<O> ul = conserved_<MHD,O>(wl, gamma);
+      const Cons_<O> ur = conserved_<MHD,O>(wr, gamma);
+      const Cons_<O> fl = active_fluxes_<MHD,O>(wl, ul);
+      const Cons_<O> fr = active_fluxes_<MHD,O>(wr, ur);
+
+      V bp, bm;
+      einfeldt_wavespeeds_<MHD,O>(wl, wr, ul, ur, gamma, &bp, &bm);
+      bp = O::max(bp, O::set1(0));
+      bm = O::min(bm, O::set1(0));
+      const V inv_speed_diff = O::set1(1.) / (bp - bm);
+
+#define RIEMANN_SIMD_HLL_FLUX(q)                                        \
+      ((bp*fl.q - bm*fr.q + (ur.q - ul.q)*bp*bm) * inv_speed_diff)
+
+      const V flux_d = RIEMANN_SIMD_HLL_FLUX(d);
+      io.store(a.flux[LUT::density],    flux_d);
+      io.store(a.flux[LUT::velocity_i], RIEMANN_SIMD_HLL_FLUX(mi));
+      io.store(a.flux[LUT::velocity_j], RIEMANN_SIMD_HLL_FLUX(mj));
+      io.store(a.flux[LUT::velocity_k], RIEMANN_SIMD_HLL_FLUX(mk));
+      if (MHD) {
+        io.store(a.flux[MHDLUT::bfield_i], RIEMANN_SIMD_HLL_FLUX(bi));
+        io.store(a.flux[MHDLUT::bfield_j], RIEMANN_SIMD_HLL_FLUX(bj));
+        io.store(a.flux[MHDLUT::bfield_k], RIEMANN_SIMD_HLL_FLUX(bk));
+      }
+      io.store(a.flux[LUT::total_energy], RIEMANN_SIMD_HLL_FLUX(e));
+
+#undef RIEMANN_SIMD_HLL_FLUX
+
+      io.store(a.internal_energy_flux,
+               passive_eint_flux_<O>(wl, wr, gamma, flux_d));
+      io.store(a.velocity_i_bar, (bp*wl.vi - bm*wr.vi) * inv_speed_diff);
+    }
+  };
+
+  //----------------------------------------------------------------------
+
+  /// mirrors HLLCKernel
+  struct HLLCFace_ {
+    template <class O, class IO>
+    static RIEMANN_SIMD_INLINE void apply(const RowArgs<typename O::T> & a,
+                                          const IO & io)
+    {
+      typedef typename O::V V;
+      typedef typename O::M M;
+      typedef HydroLUT LUT;
+      const V zero = O::set1(0);
+
+      const Prim_<O> wl = load_hydro_prim_<LUT,O>(a.prim_l, io);
+      const Prim_<O> wr = load_hydro_prim_<LUT,O>(a.prim_r, io);
+      const V gamma = O::set1(a.gamma);
+
+      const Cons_<O> cons_l = conserved_<false,O>(wl, gamma);
+      const Cons_<O> cons_r = conserved_<false,O>(wr, gamma);
+
+      V cs_l, cs_r;
+      einfeldt_wavespeeds_<false,O>(wl, wr, cons_l, cons_r, gamma,
+                                    &cs_r, &cs_l);
+
+      const V bm = O::min(cs_l, zero);
+      const V bp = O::max(cs_r, zero);
+
+      // contact wave speed (cw) and pressure (cp)
+      const V tl = (wl.p - (cs_l - wl.vi) * wl.d * wl.vi);
+      const V tr = (wr.p - (cs_r - wr.vi) * wr.d * wr.vi);
+      const V dl =  wl.d * (cs_l - wl.vi);
+      const V dr = -wr.d * (cs_r - wr.vi);
+      const V q1 = O::set1(1.0) / (dl+dr);
+      const V cw = (tr - tl)*q1;
+      V cp = (dl*tr + dr*tl)*q1;
+
+      // weights for the fluxes: both branches of the scalar kernel
+      const M right_moving = O::ge(cw, zero);
+      const V sl = O::select(right_moving, cw / (cw - bm), zero);
+      const V sr = O::select(right_moving, zero, -cw / (bp - cw));
+      const V sm = O::select(right_moving, -bm / (cw - bm), bp / (bp - cw));
+
+      // apply floor to contact pressure
+      cp = O::max(cp, zero);
+
+      const V momentumi_l = cons_l.mi;
+      const V momentumi_r = cons_r.mi;
+
+      const V dfl = momentumi_l - bm*wl.d;
+      const V dfr = momentumi_r - bp*wr.d;
+
+      const V ufl = momentumi_l * (wl.vi - bm) + wl.p;
+      const V ufr = momentumi_r * (wr.vi - bp) + wr.p;
+
+      const V vfl = (wl.d * wl.vj * (wl.vi - bm));
+      const V vfr = (wr.d * wr.vj * (wr.vi - bp));
+
+      const V wfl = (wl.d * wl.vk * (wl.vi - bm));
+      const V wfr = (wr.d * wr.vk * (wr.vi - bp));
+
+      const V efl = (cons_l.e * (wl.vi - bm) + wl.p * wl.vi);
+      const V efr = (cons_r.e * (wr.vi - bp) + wr.p * wr.vi);
+
+      const V flux_d = sl*dfl + sr*dfr;
+      io.store(a.flux[LUT::density], flux_d);
+      io.store(a.flux[LUT::velocity_i], (sl*ufl + sr*ufr) + (sm * cp));
+      io.store(a.flux[LUT::velocity_j], sl*vfl + sr*vfr);
+      io.store(a.flux[LUT::velocity_k], sl*wfl + sr*wfr);
+      io.store(a.flux[LUT::total_energy], (sl*efl + sr*efr) + (sm * cp * cw));
+
+      io.store(a.internal_energy_flux,
+               passive_eint_flux_<O>(wl, wr, gamma, flux_d));
+      io.store(a.velocity_i_bar, (sl * (wl.vi - bm) + sr * (wr.vi - bp)));
+    }
+  };
+
+  //----------------------------------------------------------------------
+
+  /// mirrors HLLDKernel
+  struct HLLDFace_ {
+
+    template <class O>
+    struct State_ { typename O::V d, mx, my, mz, e, by, bz; };
+
+    template <class O>
+    static RIEMANN_SIMD_INLINE State_<O> select_
+    (typename O::M m, const State_<O> & a, const State_<O> & b)
+    {
+      State_<O> out;
+      out.d  = O::select(m, a.d,  b.d);
+      out.mx = O::select(m, a.mx, b.mx);
+      out.my = O::select(m, a.my, b.my);
+      out.mz = O::select(m, a.mz, b.mz);
+      out.e  = O::select(m, a.e,  b.e);
+      out.by = O::select(m, a.by, b.by);
+      out.bz = O::select(m, a.bz, b.bz);
+      return out;
+    }
+
+    /// ul* or ur*: eqns (39), (44)-(48) of Miyoshi & Kusano
+    template <class O>
+    static RIEMANN_SIMD_INLINE State_<O> star_state_
+    (const Prim_<O> & w, const State_<O> & u, typename O::V sd,
+     typename O::V sdm, typename O::V sdm_inv, typename O::V spd2,
+     typename O::V pt, typename O::V ptst, typename O::V bxi,
+     typename O::V bxsq, typename O::V * vbst)
+    {
+      typedef typename O::V V;
+      State_<O> ust;
+      ust.d = u.d * sd * sdm_inv;
+      const V ust_d_inv = O::set1(1.0)/ust.d;
+      ust.mx = ust.d * spd2;
+
+      const V denom = u.d*sd*sdm - bxsq;
+      const typename O::M degenerate =
+        O::lt(O::abs(denom), O::set1(RIEMANN_SIMD_SMALL_NUMBER)*ptst);
+      const V tmp_m = bxi*(sd - sdm)/denom;
+      const V tmp_b = (u.d*(sd*sd) - bxsq)/denom;
+      ust.my = O::select(degenerate, ust.d * w.vj,
+                         ust.d * (w.vj - u.by*tmp_m));
+      ust.mz = O::select(degenerate, ust.d * w.vk,
+                         ust.d * (w.vk - u.bz*tmp_m));
+      ust.by = O::select(degenerate, u.by, u.by * tmp_b);
+      ust.bz = O::select(degenerate, u.bz, u.bz * tmp_b);
+
+      *vbst = (ust.mx*bxi + (ust.my*ust.by + ust.mz*ust.bz)) * ust_d_inv;
+      ust.e = (sd*u.e - pt*w.vi + ptst*spd2 +
+               bxi*(w.vi*bxi + (w.vj*u.by + w.vk*u.bz) - *vbst))*sdm_inv;
+      return ust;
+    }
+
+    /// spd * (a - b) for each quantity
+    template <class O>
+    static RIEMANN_SIMD_INLINE State_<O> jump_
+    (typename O::V spd, const State_<O> & a, const State_<O> & b)
+    {
+      State_<O> out;
+      out.d  = spd * (a.d  - b.d);
+      out.mx = spd * (a.mx - b.mx);
+      out.my = spd * (a.my - b.my);
+      out.mz = spd * (a.mz - b.mz);
+      out.e  = spd * (a.e  - b.e);
+      out.by = spd * (a.by - b.by);
+      out.bz = spd * (a.bz - b.bz);
+      return out;
+    }
+
+    template <class O>
+    static RIEMANN_SIMD_INLINE State_<O> sum_
+    (const State_<O> & a, const State_<O> & b)
+    {
+      State_<O> out;
+      out.d  = a.d  + b.d;
+      out.mx = a.mx + b.mx;
+      out.my = a.my + b.my;
+      out.mz = a.mz + b.mz;
+      out.e  = a.e  + b.e;
+      out.by = a.by + b.by;
+      out.bz = a.bz + b.bz;
+      return out;
+    }
+
+    template <class O, class IO>
+    static RIEMANN_SIMD_INLINE void apply(const RowArgs<typename O::T> & a,
+                                          const IO & io)
+    {
+      typedef typename O::V V;
+      typedef typename O::M M;
+      typedef MHDLUT LUT;
+      const V zero = O::set1(0);
+      const V half = O::set1(0.5);
+
+      const V gamma = O::set1(a.gamma);
+      const V igm1 = O::set1(1.0) / (gamma - O::set1(1.0));
+
+      //--- Step 1.  Load L/R states into local variables
+      const Prim_<O> wli = load_mhd_prim_<O>(a.prim_l, io);
+      const Prim_<O> wri = load_mhd_prim_<O>(a.prim_r, io);
+
+      const V bxi = wli.bi;
+      const V bxsq = bxi*bxi;
+      const V pbl = half*(bxsq + (wli.bj*wli.bj + wli.bk*wli.bk));
+      const V pbr = half*(bxsq + (wri.bj*wri.bj + wri.bk*wri.bk));
+      const V kel = half*wli.d*(wli.vi*wli.vi + (wli.vj*wli.vj +
+                                                 wli.vk*wli.vk));
+      const V ker = half*wri.d*(wri.vi*wri.vi + (wri.vj*wri.vj +
+                                                 wri.vk*wri.vk));
+
+      State_<O> ul, ur;
+      ul.d  = wli.d;
+      ul.mx = wli.vi*ul.d;
+      ul.my = wli.vj*ul.d;
+      ul.mz = wli.vk*ul.d;
+      ul.e  = wli.p*igm1 + kel + pbl;
+      ul.by = wli.bj;
+      ul.bz = wli.bk;
+
+      ur.d  = wri.d;
+      ur.mx = wri.vi*ur.d;
+      ur.my = wri.vj*ur.d;
+      ur.mz = wri.vk*ur.d;
+      ur.e  = wri.p*igm1 + ker + pbr;
+      ur.by = wri.bj;
+      ur.bz = wri.bk;
+
+      //--- Step 2.  Compute L & R wave speeds
+      const V cfl = fast_speed_<true,O>(wli, gamma);
+      const V cfr = fast_speed_<true,O>(wri, gamma);
+
+      V spd[5];
+      spd[0] = O::min(wli.vi - cfl, wri.vi - cfr);
+      spd[4] = O::max(wli.vi + cfl, wri.vi + cfr);
+
+      //--- Step 3.  Compute L/R fluxes
+      const V ptl = wli.p + pbl;
+      const V ptr = wri.p + pbr;
+
+      State_<O> fl, fr;
+      fl.d  = ul.mx;
+      fl.mx = ul.mx*wli.vi + ptl - bxsq;
+      fl.my = ul.my*wli.vi - bxi*ul.by;
+      fl.mz = ul.mz*wli.vi - bxi*ul.bz;
+      fl.e  = wli.vi*(ul.e + ptl - bxsq) - bxi*(wli.vj*ul.by + wli.vk*ul.bz);
+      fl.by = ul.by*wli.vi - bxi*wli.vj;
+      fl.bz = ul.bz*wli.vi - bxi*wli.vk;
+
+      fr.d  = ur.mx;
+      fr.mx = ur.mx*wri.vi + ptr - bxsq;
+      fr.my = ur.my*wri.vi - bxi*ur.by;
+      fr.mz = ur.mz*wri.vi - bxi*ur.bz;
+      fr.e  = wri.vi*(ur.e + ptr - bxsq) - bxi*(wri.vj*ur.by + wri.vk*ur.bz);
+      fr.by = ur.by*wri.vi - bxi*wri.vj;
+      fr.bz = ur.bz*wri.vi - bxi*wri.vk;
+
+      //--- Step 4.  Compute middle and Alfven wave speeds
+      const V sdl = spd[0] - wli.vi;
+      const V sdr = spd[4] - wri.vi;
+
+      spd[2] = (sdr*ur.mx - sdl*ul.mx + (ptl - ptr))/(sdr*ur.d - sdl*ul.d);
+
+      const V sdml = spd[0] - spd[2];
+      const V sdmr = spd[4] - spd[2];
+      const V sdml_inv = O::set1(1.0)/sdml;
+      const V sdmr_inv = O::set1(1.0)/sdmr;
+
+      const V ptstl = ptl + ul.d*sdl*(spd[2]-wli.vi);
+      const V ptstr = ptr + ur.d*sdr*(spd[2]-wri.vi);
+      const V ptst = half*(ptstr + ptstl);
+
+      //--- Step 5.  Compute intermediate states
+      V vbstl, vbstr;
+      State_<O> ulst = star_state_<O>(wli, ul, sdl, sdml, sdml_inv, spd[2],
+                                      ptl, ptst, bxi, bxsq, &vbstl);
+      State_<O> urst = star_state_<O>(wri, ur, sdr, sdmr, sdmr_inv, spd[2],
+                                      ptr, ptst, bxi, bxsq, &vbstr);
+      const V ulst_d_inv = O::set1(1.0)/ulst.d;
+      const V urst_d_inv = O::set1(1.0)/urst.d;
+      const V sqrtdl = O::sqrt(ulst.d);
+      const V sqrtdr = O::sqrt(urst.d);
+
+      spd[1] = spd[2] - O::abs(bxi)/sqrtdl;
+      spd[3] = spd[2] + O::abs(bxi)/sqrtdr;
+
+      // ul** and ur** - if Bx is near zero, same as *-states
+      State_<O> uldst, urdst;
+      {
+        const V invsumd = O::set1(1.0)/(sqrtdl + sqrtdr);
+        const V bxsig = O::select(O::gt(bxi, zero), O::set1(1.0),
+                                  O::set1(-1.0));
+
+        uldst.d = ulst.d;
+        urdst.d = urst.d;
+
+        uldst.mx = ulst.mx;
+        urdst.mx = urst.mx;
+
+        // eqn (59) of M&K
+        V tmp = invsumd*(sqrtdl*(ulst.my*ulst_d_inv) +
+                         sqrtdr*(urst.my*urst_d_inv) +
+                         bxsig*(urst.by - ulst.by));
+        uldst.my = uldst.d * tmp;
+        urdst.my = urdst.d * tmp;
+
+        // eqn (60) of M&K
+        tmp = invsumd*(sqrtdl*(ulst.mz*ulst_d_inv) +
+                       sqrtdr*(urst.mz*urst_d_inv) +
+                       bxsig*(urst.bz - ulst.bz));
+        uldst.mz = uldst.d * tmp;
+        urdst.mz = urdst.d * tmp;
+
+        // eqn (61) of M&K
+        tmp = invsumd*(sqrtdl*urst.by + sqrtdr*ulst.by +
+                       bxsig*sqrtdl*sqrtdr*((urst.my*urst_d_inv) -
+                                            (ulst.my*ulst_d_inv)));
+        uldst.by = urdst.by = tmp;
+
+        // eqn (62) of M&K
+        tmp = invsumd*(sqrtdl*urst.bz + sqrtdr*ulst.bz +
+                       bxsig*sqrtdl*sqrtdr*((urst.mz*urst_d_inv) -
+                                            (ulst.mz*ulst_d_inv)));
+        uldst.bz = urdst.bz = tmp;
+
+        // eqn (63) of M&K
+        tmp = spd[2]*bxi + (uldst.my*uldst.by + uldst.mz*uldst.bz)/uldst.d;
+        uldst.e = ulst.e - sqrtdl*bxsig*(vbstl - tmp);
+        urdst.e = urst.e + sqrtdr*bxsig*(vbstr - tmp);
+
+        const M weak_bx = O::lt(half*bxsq,
+                                O::set1(RIEMANN_SIMD_SMALL_NUMBER)*ptst);
+        uldst = select_<O>(weak_bx, ulst, uldst);
+        urdst = select_<O>(weak_bx, urst, urdst);
+      }
+
+      //--- Step 6.  Compute flux
+      const State_<O> jump_ldst = jump_<O>(spd[1], uldst, ulst);
+      const State_<O> jump_lst  = jump_<O>(spd[0], ulst, ul);
+      const State_<O> jump_rdst = jump_<O>(spd[3], urdst, urst);
+      const State_<O> jump_rst  = jump_<O>(spd[4], urst, ur);
+
+      // the scalar kernel's chain of if/else-if blocks is applied in
+      // reverse, so that the first true condition takes precedence
+      const State_<O> flst  = sum_<O>(fl, jump_lst);
+      const State_<O> frst  = sum_<O>(fr, jump_rst);
+      State_<O> flxi = frst;                                      // Fr*
+      flxi = select_<O>(O::gt(spd[3], zero), sum_<O>(frst, jump_rdst), flxi);
+      flxi = select_<O>(O::ge(spd[2], zero), sum_<O>(flst, jump_ldst), flxi);
+      flxi = select_<O>(O::ge(spd[1], zero), flst, flxi);
+      flxi = select_<O>(O::le(spd[4], zero), fr, flxi);
+      flxi = select_<O>(O::ge(spd[0], zero), fl, flxi);
+
+      io.store(a.flux[LUT::density], flxi.d);
+      io.store(a.flux[LUT::velocity_i], flxi.mx);
+      io.store(a.flux[LUT::velocity_j], flxi.my);
+      io.store(a.flux[LUT::velocity_k], flxi.mz);
+      io.store(a.flux[LUT::bfield_i], zero);
+      io.store(a.flux[LUT::bfield_j], flxi.by);
+      io.store(a.flux[LUT::bfield_k], flxi.bz);
+      io.store(a.flux[LUT::total_energy], flxi.e);
+
+      io.store(a.internal_energy_flux,
+               passive_eint_flux_<O>(wli, wri, gamma, flxi.d));
+
+      // interface velocity (see HLLDKernel for the conventions)
+      const V S_M = spd[2];
+      const V S_l = spd[0];
+      const V S_r = spd[4];
+      const V l_coef = (S_l - wli.vi)/(S_l - S_M);
+      const V r_coef = (S_r - wri.vi)/(S_r - S_M);
+      V vi_bar = S_M * r_coef;
+      vi_bar = O::select(O::ge(S_M, zero), S_M * l_coef, vi_bar);
+      vi_bar = O::select(O::lt(S_r, zero), wri.vi, vi_bar);
+      vi_bar = O::select(O::gt(S_l, zero), wli.vi, vi_bar);
+      io.store(a.velocity_i_bar, vi_bar);
+    }
+  };
+
+  //----------------------------------------------------------------------
+
+  /// Tables of row solvers compiled for wider instruction sets (defined in
+  /// EnzoRiemannSimdAVX2.cpp and EnzoRiemannSimdAVX512.cpp).  These return
+  /// nullptr when the compiler didn't target the instruction set.
+  template <typename T> const RowKernels<T> * row_kernels_avx2_();
+  template <typename T> const RowKernels<T> * row_kernels_avx512_();
+
+  //----------------------------------------------------------------------
+
+  /// Solve a row: full packs first, then the remaining interfaces with a
+  /// partially filled pack
+  template <class O, class Face>
+  void solve_row_(const RowArgs<typename O::T> & a)
+  {
+    const int n = a.n;
+    int ix = 0;
+    for (; ix + O::width <= n; ix += O::width) {
+      Face::template apply<O>(a, LaneIO_<O,false>{ix, O::width});
+    }
+    if (ix < n) {
+      Face::template apply<O>(a, LaneIO_<O,true>{ix, n - ix});
+    }
+  }
+
+  template <class O>
+  RowKernels<typename O::T> make_row_kernels_()
+  {
+    RowKernels<typename O::T> out;
+    out.width = O::width;
+    out.solve[(int)kind::hlle]     = &solve_row_<O, HLLEFace_<HydroLUT>>;
+    out.solve[(int)kind::hlle_mhd] = &solve_row_<O, HLLEFace_<MHDLUT>>;
+    out.solve[(int)kind::hllc]     = &solve_row_<O, HLLCFace_>;
+    out.solve[(int)kind::hlld]     = &solve_row_<O, HLLDFace_>;
+    return out;
+  }
+
+}
+
+#endif /* ENZO_ENZO_RIEMANN_SIMD_KERNELS_HPP */
@@ -439,27 +439,31 @@ namespace enzo_riemann_utils{
 
     /// Load scratch-space arrays
     ///
-    /// If the scratch-space arrays have not been pre-allocated, they will be
-    /// allocated by this method
+    /// If the scratch-space arrays have not been pre-allocated (or are too
+    /// small, e.g. when the fluxes of a tile of a block were requested
+    /// first), they will be allocated by this method
     void get_arrays(int mx, int my, int mz,
                     CelloArray<enzo_float,3>& internal_energy_flux,
                     CelloArray<enzo_float,3>& velocity_i_bar_array) noexcept
     {
-      if (internal_energy_flux_.is_null()){
+      if (internal_energy_flux_.is_null() ||
+          (mz > internal_energy_flux_.shape(0)) ||
+          (my > internal_energy_flux_.shape(1)) ||
+          (mx > internal_energy_flux_.shape(2))){
         // make the scratch space bigger than necessary (since the shape will
         // change slightly every time that they are used)
         //
         // given `dim` we could be more precise about the max shape
-        internal_energy_flux_ = EFlt3DArray(mz+1,my+1,mx+1);
-        velocity_i_bar_array_ = EFlt3DArray(mz+1,my+1,mx+1);
+        int nz = mz+1, ny = my+1, nx = mx+1;
+        if (!internal_energy_flux_.is_null()){
+          nz = std::max(nz, internal_energy_flux_.shape(0));
+          ny = std::max(ny, internal_energy_flux_.shape(1));
+          nx = std::max(nx, internal_energy_flux_.shape(2));
+        }
+        internal_energy_flux_ = EFlt3DArray(nz,ny,nx);
+        velocity_i_bar_array_ = EFlt3DArray(nz,ny,nx);
       }
 
-      ASSERT("ScratchArrays_::get_arrays",
-             "preallocated scratch-arrays are too small",
-             (mz <= internal_energy_flux_.shape(0)) &
-             (my <= internal_energy_flux_.shape(1)) &
-             (mx <= internal_energy_flux_.shape(2)));
-
       internal_energy_flux = internal_energy_flux_.subarray
         (CSlice(0, mz),CSlice(0,my),CSlice(0,mx));
       velocity_i_bar_array = velocity_i_bar_array_.subarray
@@ -0,0 +1,187 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     riemann_benchmark.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Throughput benchmark for the vectorized Riemann Solver kernels
+///
+/// usage: riemann_benchmark [faces_per_row [rows [repeats]]]
+///
+/// For each vectorized solver (HLLE, HLLC, HLLE for MHD and HLLD) and each
+/// instruction set available on the host, this solves `repeats` times a
+/// set of `rows` rows of `faces_per_row` cell interfaces with randomly
+/// generated left and right states, and reports the throughput in faces
+/// per second along with the speedup over the width-1 (scalar) kernels.
+/// The default row length of 37 is the number of x-faces of a block with
+/// 32 cells and 3 ghost zones per side, once the stale faces are removed;
+/// it isn't a multiple of the pack width, so the partial packs are
+/// exercised as well.
+///
+/// The results of each instruction set are checked against the scalar
+/// kernels; the program exits with status 1 if they differ by more than
+/// roundoff.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "EnzoRiemannInputLUT.hpp"
+#include "EnzoRiemannSimd.hpp"
+
+using namespace enzo_riemann_simd;
+
+typedef double real;
+
+//----------------------------------------------------------------------
+
+/// Holds the inputs and outputs of a set of rows
+struct Rows {
+  Rows (int n, int rows, int num_entries)
+    : n(n), rows(rows), num_entries(num_entries),
+      prim_l(num_entries*rows*n), prim_r(num_entries*rows*n),
+      flux(num_entries*rows*n), eint_flux(rows*n), vi_bar(rows*n)
+  { }
+
+  RowArgs<real> args (int row, real gamma)
+  {
+    RowArgs<real> a;
+    a.n = n;
+    a.gamma = gamma;
+    for (int q = 0; q < num_entries; q++) {
+      const int offset = (q*rows + row)*n;
+      a.prim_l[q] = prim_l.data() + offset;
+      a.prim_r[q] = prim_r.data() + offset;
+      a.flux[q] = flux.data() + offset;
+    }
+    a.internal_energy_flux = eint_flux.data() + row*n;
+    a.velocity_i_bar = vi_bar.data() + row*n;
+    return a;
+  }
+
+  int n, rows, num_entries;
+  std::vector<real> prim_l, prim_r, flux, eint_flux, vi_bar;
+};
+
+//----------------------------------------------------------------------
+
+/// Uniform random number in [lo,hi) from a fixed-seed generator
+static real uniform (real lo, real hi)
+{
+  static unsigned long long state = 12345;
+  state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+  return lo + (hi - lo) * ((state >> 11) * (1.0 / 9007199254740992.0));
+}
+
+template <class LUT>
+static void fill_side (std::vector<real> & prim, int size, bool mhd,
+                       const std::vector<real> * bfield_i)
+{
+  for (int i = 0; i < size; i++) {
+    prim[LUT::density*size + i]    = uniform(0.1, 2.0);
+    prim[LUT::velocity_i*size + i] = uniform(-2.0, 2.0);
+    prim[LUT::velocity_j*size + i] = uniform(-2.0, 2.0);
+    prim[LUT::velocity_k*size + i] = uniform(-2.0, 2.0);
+    prim[LUT::total_energy*size + i] = uniform(0.1, 2.0);
+  }
+  if (mhd) {
+    for (int i = 0; i < size; i++) {
+      // the longitudinal field is continuous across the interface
+      prim[MHDLUT::bfield_i*size + i] = (bfield_i == nullptr) ?
+        uniform(-1.0, 1.0) : (*bfield_i)[MHDLUT::bfield_i*size + i];
+      prim[MHDLUT::bfield_j*size + i] = uniform(-1.0, 1.0);
+      prim[MHDLUT::bfield_k*size + i] = uniform(-1.0, 1.0);
+    }
+  }
+}
+
+static real max_rel_diff (const std::vector<real> & a,
+                          const std::vector<real> & b)
+{
+  real out = 0.0;
+  for (std::size_t i = 0; i < a.size(); i++) {
+    const real scale = std::fmax(std::fmax(std::fabs(a[i]), std::fabs(b[i])),
+                                 1e-300);
+    out = std::fmax(out, std::fabs(a[i] - b[i]) / scale);
+  }
+  return out;
+}
+
+static double solve_rows (row_function_t<real> solve, Rows & rows,
+                          real gamma, int repeats)
+{
+  const auto t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < repeats; r++) {
+    for (int row = 0; row < rows.rows; row++) {
+      solve(rows.args(row, gamma));
+    }
+  }
+  const auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(t1 - t0).count();
+}
+
+//----------------------------------------------------------------------
+
+int main (int argc, char ** argv)
+{
+  const int n       = (argc > 1) ? atoi(argv[1]) : 37;
+  const int rows    = (argc > 2) ? atoi(argv[2]) : 38*38;
+  const int repeats = (argc > 3) ? atoi(argv[3]) : 200;
+  const real gamma = 5.0/3.0;
+  const real tolerance = 1e-12;
+
+  const struct { const char * name; kind k; bool mhd; } solvers[] =
+    { {"hlle",     kind::hlle,     false},
+      {"hllc",     kind::hllc,     false},
+      {"hlle_mhd", kind::hlle_mhd, true},
+      {"hlld",     kind::hlld,     true} };
+  const isa sets[] = {isa::none, isa::avx2, isa::avx512};
+
+  printf ("faces per row %d  rows %d  repeats %d  host isa %s\n",
+          n, rows, repeats, isa_name(host_isa()));
+  printf ("%-10s %-8s %6s %14s %9s %14s\n",
+          "solver", "isa", "width", "faces/sec", "speedup", "max rel diff");
+
+  bool ok = true;
+  for (const auto & solver : solvers) {
+    const int num_entries = solver.mhd ? (int)MHDLUT::num_entries
+                                       : (int)HydroLUT::num_entries;
+    Rows reference(n, rows, num_entries);
+    if (solver.mhd) {
+      fill_side<MHDLUT>(reference.prim_l, rows*n, true, nullptr);
+      fill_side<MHDLUT>(reference.prim_r, rows*n, true, &reference.prim_l);
+    } else {
+      fill_side<HydroLUT>(reference.prim_l, rows*n, false, nullptr);
+      fill_side<HydroLUT>(reference.prim_r, rows*n, false, nullptr);
+    }
+    Rows work = reference;
+
+    double faces_per_sec_scalar = 0.0;
+    for (isa set : sets) {
+      if (! is_available(set)) continue;
+      const RowKernels<real> * kernels = row_kernels<real>(set);
+      const row_function_t<real> solve = kernels->solve[(int)solver.k];
+
+      // check against the scalar kernels
+      solve_rows(solve, (set == isa::none) ? reference : work, gamma, 1);
+      const real diff = std::fmax
+        (std::fmax(max_rel_diff(reference.flux, work.flux),
+                   max_rel_diff(reference.eint_flux, work.eint_flux)),
+         max_rel_diff(reference.vi_bar, work.vi_bar));
+      const bool match = (set == isa::none) || (diff <= tolerance);
+      ok = ok && match;
+
+      const double time = solve_rows(solve, work, gamma, repeats);
+      const double faces_per_sec = (double)repeats * rows * n / time;
+      if (set == isa::none) faces_per_sec_scalar = faces_per_sec;
+
+      printf ("%-10s %-8s %6d %14.4e %9.2f %14.3e%s\n",
+              solver.name, isa_name(set), kernels->width, faces_per_sec,
+              faces_per_sec / faces_per_sec_scalar,
+              (set == isa::none) ? 0.0 : diff, match ? "" : "  FAILED");
+    }
+  }
+
+  return ok ? 0 : 1;
+}
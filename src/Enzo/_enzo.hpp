@@ -96,6 +96,7 @@ enum enzo_sync_id {
   enzo_sync_id_solver_mg0_last,
   enzo_sync_id_solver_mg0_post,
   enzo_sync_id_solver_mg0_pre,
+  enzo_sync_id_solver_mg_amr_coarse,
   enzo_sync_id_solver_jacobi_1,
   enzo_sync_id_solver_jacobi_2,
   enzo_sync_id_solver_jacobi_3
@@ -260,6 +261,7 @@ extern "C" {
 #include "enzo_EnzoMethodHydro.hpp"
 #include "enzo_EnzoMethodMergeSinks.hpp"
 #include "enzo_EnzoMethodMHDVlct.hpp"
+#include "enzo_EnzoPmDepositKernels.hpp"
 #include "enzo_EnzoMethodPmDeposit.hpp"
 #include "enzo_EnzoMethodPmUpdate.hpp"
 #include "enzo_EnzoMethodPpm.hpp"
@@ -273,6 +275,7 @@ extern "C" {
 
 #include "enzo_EnzoMatrixDiagonal.hpp"
 #include "enzo_EnzoMatrixIdentity.hpp"
+#include "enzo_EnzoMatrixLaplaceKernels.hpp"
 #include "enzo_EnzoMatrixLaplace.hpp"
 
 #include "enzo_EnzoMsgCheck.hpp"
@@ -291,6 +294,7 @@ extern "C" {
 #include "enzo_EnzoSolverDiagonal.hpp"
 #include "enzo_EnzoSolverJacobi.hpp"
 #include "enzo_EnzoSolverMg0.hpp"
+#include "enzo_EnzoSolverMgAmr.hpp"
 
 #include "enzo_EnzoStopping.hpp"
 
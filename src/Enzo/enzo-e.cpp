@@ -36,6 +36,10 @@
 #include "main.hpp"
 #include "charm_enzo.hpp"
 
+#ifdef CONFIG_SMP_MODE
+#  include "CkLoopAPI.h"
+#endif
+
 // The following needs to be included once and only once
 // This may not be the perfect place for this, but it is when it is included in
 // multiple object files
@@ -139,6 +143,12 @@ PARALLEL_MAIN_BEGIN
   }
 #endif
 
+#ifdef CONFIG_SMP_MODE
+  // Create the CkLoop helper threads used for splitting work within
+  // a Block across the PEs of a node, e.g. EnzoMethodGrackle
+  CkLoop_Init();
+#endif
+
  //--------------------------------------------------
 
   proxy_main     = thishandle;
@@ -151,6 +161,12 @@ PARALLEL_MAIN_BEGIN
     (parameter_file, strlen(parameter_file)+1);
   // --------------------------------------------------
 
+  // Create the IoAdmission group limiting concurrent file readers and
+  // writers
+  proxy_io_admission = CProxy_IoAdmission::ckNew
+    (g_enzo_config.performance_io_tokens,
+     g_enzo_config.performance_io_scope);
+
 }
 
 PARALLEL_MAIN_END
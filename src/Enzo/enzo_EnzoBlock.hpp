@@ -214,6 +214,11 @@ public: /// entry methods
 
   void p_initial_hdf5_recv(MsgInitial * msg_initial);
 
+  /// Continue initial conditions after the IoAdmission service admits
+  /// this Block's reader
+  void p_initial_hdf5_read();
+  void p_initial_music_read();
+
   /// TEMP
   double timestep() { return dt; }
 
@@ -233,8 +238,9 @@ public: /// entry methods
   /// checkpoint files based on Ordering object
   void p_check_write_first(int num_files, std::string ordering, std::string);
 
-  /// Call to single Block to return data for checkpoint
-  void p_check_write_next(int num_files, std::string ordering);
+  /// Call to single Block to return data for checkpoint, and forward
+  /// the request to the next count Blocks in the ordering
+  void p_check_write_next(int num_files, std::string ordering, int count);
 
   /// Exit EnzoMethodCheck
   void p_check_done();
@@ -280,6 +286,30 @@ public: /// entry methods
 
   void p_solver_cg_matvec();
 
+  /// EnzoSolverCg pipelined entry method: SUM(B) ==> refresh R
+  void r_solver_cg_pipe_0 (CkReductionMsg * msg);
+
+  /// EnzoSolverCg pipelined entry method: W = MATVEC (A,R)
+  void p_solver_cg_pipe_start ();
+
+  /// EnzoSolverCg pipelined entry method: Y = MATVEC (A,W)
+  void p_solver_cg_pipe_matvec ();
+
+  /// EnzoSolverCg pipelined entry method: DOT(R,R), DOT(W,R)
+  void r_solver_cg_pipe_reduce (CkReductionMsg * msg);
+
+  /// EnzoSolverCg batched entry method: DOT(R[k],R[k]), SUM(B[k])
+  void r_solver_cg_batch_0 (CkReductionMsg * msg);
+
+  /// EnzoSolverCg batched entry method: Y[k] = MATVEC (A,D[k])
+  void p_solver_cg_batch_matvec ();
+
+  /// EnzoSolverCg batched entry method: DOT(D[k],Y[k])
+  void r_solver_cg_batch_1 (CkReductionMsg * msg);
+
+  /// EnzoSolverCg batched entry method: DOT(R[k],R[k])
+  void r_solver_cg_batch_2 (CkReductionMsg * msg);
+
   //--------------------------------------------------
 
   /// EnzoSolverBiCGStab entry method: SUM(B) and COUNT(B)
@@ -346,6 +376,16 @@ public: /// entry methods
   void solver_mg0_prolong_recv(FieldMsg * msg);
   void p_solver_mg0_restrict_recv(FieldMsg * msg);
 
+  // EnzoSolverMgAmr
+
+  void p_solver_mg_amr_descend();
+  void p_solver_mg_amr_pre_smooth();
+  void p_solver_mg_amr_solve_coarse();
+  void p_solver_mg_amr_post_smooth();
+  void p_solver_mg_amr_restrict_recv(FieldMsg * msg);
+  void p_solver_mg_amr_prolong_recv(FieldMsg * msg);
+  void r_solver_mg_amr_end_cycle(CkReductionMsg * msg);
+
   // EnzoMethodFeedbackSTARSS
 
   void p_method_feedback_starss_end();
@@ -369,6 +409,11 @@ protected: // methods
   ( EnzoMsgCheck ** msg_check, int num_files, std::string ordering,
     std::string name_dir = "", bool * is_first = nullptr);
 
+  /// Return the next Block in the ordering and whether this is the
+  /// last Block in its file, from an EnzoMsgCheck
+  void get_check_next_
+  ( EnzoMsgCheck * msg_check, Index * index_next, bool * is_last);
+
   /// Initialize restart data in Block
   void restart_set_data_(EnzoMsgCheck * );
 
@@ -103,6 +103,8 @@ EnzoConfig::EnzoConfig() throw ()
   initial_hdf5_format(),
   initial_hdf5_blocking(),
   initial_hdf5_monitor_iter(),
+  initial_hdf5_read_mode(),
+  initial_hdf5_slab_depth(1),
   initial_hdf5_field_files(),
   initial_hdf5_field_datasets(),
   initial_hdf5_field_names(),
@@ -130,13 +132,9 @@ EnzoConfig::EnzoConfig() throw ()
   initial_music_particle_coords(),
   initial_music_particle_types(),
   initial_music_particle_attributes(),
-  initial_music_throttle_internode(),
   initial_music_throttle_intranode(),
   initial_music_throttle_node_files(),
   initial_music_throttle_close_count(),
-  initial_music_throttle_group_size(),
-  initial_music_throttle_seconds_stagger(),
-  initial_music_throttle_seconds_delay(),
   // EnzoInitialPm
   initial_pm_field(""),
   initial_pm_mpp(0.0),
@@ -201,6 +199,7 @@ EnzoConfig::EnzoConfig() throw ()
   method_check_ordering("order_morton"),
   method_check_dir(),
   method_check_monitor_iter(0),
+  method_check_window(1),
   // EnzoInitialMergeSinksTest
   initial_merge_sinks_test_particle_data_filename(""),
   // EnzoInitialAccretionTest
@@ -282,6 +281,7 @@ EnzoConfig::EnzoConfig() throw ()
   method_grackle_chemistry(),
   method_grackle_use_cooling_timestep(false),
   method_grackle_radiation_redshift(-1.0),
+  method_grackle_num_slabs(1),
 #endif
   // EnzoMethodGravity
   method_gravity_grav_const(0.0),
@@ -289,6 +289,8 @@ EnzoConfig::EnzoConfig() throw ()
   method_gravity_order(4),
   method_gravity_dt_max(0.0),
   method_gravity_accumulate(false),
+  method_gravity_batch_density(),
+  method_gravity_batch_potential(),
   /// EnzoMethodBackgroundAcceleration
   method_background_acceleration_flavor(""),
   method_background_acceleration_mass(0.0),
@@ -303,6 +305,7 @@ EnzoConfig::EnzoConfig() throw ()
   method_background_acceleration_apply_acceleration(true), // for debugging
   /// EnzoMethodPmDeposit
   method_pm_deposit_alpha(0.5),
+  method_pm_deposit_scheme("cic"),
   /// EnzoMethodPmUpdate
   method_pm_update_max_dt(std::numeric_limits<double>::max()),
   /// EnzoMethodMHDVlct
@@ -311,6 +314,8 @@ EnzoConfig::EnzoConfig() throw ()
   method_vlct_full_dt_reconstruct_method(""),
   method_vlct_theta_limiter(0.0),
   method_vlct_mhd_choice(""),
+  method_vlct_tile_size(0),
+  method_vlct_riemann_simd(""),
   /// EnzoMethodMergeSinks
   method_merge_sinks_merging_radius_cells(0.0),
   /// EnzoMethodAccretion
@@ -342,6 +347,12 @@ EnzoConfig::EnzoConfig() throw ()
   solver_precondition(),
   solver_coarse_level(),
   solver_is_unigrid(),
+  /// EnzoSolverCg
+  solver_pipelined(),
+  solver_batch_size(),
+  /// EnzoSolverMgAmr
+  solver_num_pre_smooth(),
+  solver_num_post_smooth(),
   stopping_redshift()
 
 {
@@ -490,6 +501,8 @@ void EnzoConfig::pup (PUP::er &p)
   p | initial_hdf5_format;
   PUParray(p, initial_hdf5_blocking,3);
   p | initial_hdf5_monitor_iter;
+  p | initial_hdf5_read_mode;
+  p | initial_hdf5_slab_depth;
   p | initial_hdf5_field_files;
   p | initial_hdf5_field_datasets;
   p | initial_hdf5_field_names;
@@ -510,12 +523,8 @@ void EnzoConfig::pup (PUP::er &p)
   p | initial_music_particle_files;
   p | initial_music_particle_types;
   p | initial_music_throttle_close_count;
-  p | initial_music_throttle_group_size;
-  p | initial_music_throttle_internode;
   p | initial_music_throttle_intranode;
   p | initial_music_throttle_node_files;
-  p | initial_music_throttle_seconds_delay;
-  p | initial_music_throttle_seconds_stagger;
 
   p | initial_pm_field;
   p | initial_pm_mpp;
@@ -591,6 +600,7 @@ void EnzoConfig::pup (PUP::er &p)
   p | method_check_ordering;
   p | method_check_dir;
   p | method_check_monitor_iter;
+  p | method_check_window;
 
   PUParray(p,initial_accretion_test_sink_position,3);
   PUParray(p,initial_accretion_test_sink_velocity,3);
@@ -677,6 +687,8 @@ void EnzoConfig::pup (PUP::er &p)
   p | method_gravity_order;
   p | method_gravity_dt_max;
   p | method_gravity_accumulate;
+  p | method_gravity_batch_density;
+  p | method_gravity_batch_potential;
 
   p | method_background_acceleration_flavor;
   p | method_background_acceleration_mass;
@@ -693,6 +705,7 @@ void EnzoConfig::pup (PUP::er &p)
   PUParray(p,method_background_acceleration_center,3);
 
   p | method_pm_deposit_alpha;
+  p | method_pm_deposit_scheme;
   p | method_pm_update_max_dt;
 
   p | method_vlct_riemann_solver;
@@ -700,6 +713,8 @@ void EnzoConfig::pup (PUP::er &p)
   p | method_vlct_full_dt_reconstruct_method;
   p | method_vlct_theta_limiter;
   p | method_vlct_mhd_choice;
+  p | method_vlct_tile_size;
+  p | method_vlct_riemann_simd;
 
   p | method_merge_sinks_merging_radius_cells;
 
@@ -730,6 +745,10 @@ void EnzoConfig::pup (PUP::er &p)
   p | solver_precondition;
   p | solver_coarse_level;
   p | solver_is_unigrid;
+  p | solver_pipelined;
+  p | solver_batch_size;
+  p | solver_num_pre_smooth;
+  p | solver_num_post_smooth;
 
   p | stopping_redshift;
 
@@ -744,6 +763,7 @@ void EnzoConfig::pup (PUP::er &p)
   if (method_grackle_use_grackle) {
     p  | method_grackle_use_cooling_timestep;
     p  | method_grackle_radiation_redshift;
+    p  | method_grackle_num_slabs;
     if (p.isUnpacking()) { method_grackle_chemistry = new chemistry_data; }
     p | *method_grackle_chemistry;
   } else {
@@ -920,6 +940,9 @@ void EnzoConfig::read_initial_hdf5_(Parameters * p)
 
   initial_hdf5_monitor_iter = p->value_integer (name_initial + "monitor_iter", 0);
 
+  initial_hdf5_read_mode  = p->value_string (name_initial + "read_mode", "block");
+  initial_hdf5_slab_depth = p->value_integer (name_initial + "slab_depth", 1);
+
   const int num_files = p->list_length (name_initial + "file_list");
 
   for (int index_file=0; index_file<num_files; index_file++) {
@@ -999,21 +1022,26 @@ void EnzoConfig::read_initial_music_(Parameters * p)
     }
   }
   // "sleep_by_process", "limit_per_node"
-  initial_music_throttle_internode = p->value_logical
-    ("Initial:music:throttle_internode",false);
   initial_music_throttle_intranode = p->value_logical
     ("Initial:music:throttle_intranode",false);
   initial_music_throttle_node_files = p->value_logical
     ("Initial:music:throttle_node_files",false);
   initial_music_throttle_close_count = p->value_integer
     ("Initial:music:throttle_close_count",0);
-  initial_music_throttle_group_size = p->value_integer
-    ("Initial:music:throttle_group_size",std::numeric_limits<int>::max());
-  initial_music_throttle_seconds_stagger = p->value_float
-    ("Initial:music:throttle_seconds_stagger",0.0);
-  initial_music_throttle_seconds_delay = p->value_float
-    ("Initial:music:throttle_seconds_delay",0.0);
 
+  // the sleep-based internode throttling was replaced by
+  // Performance:io:tokens
+  const char * removed_params[] = { "Initial:music:throttle_internode",
+                                    "Initial:music:throttle_group_size",
+                                    "Initial:music:throttle_seconds_stagger",
+                                    "Initial:music:throttle_seconds_delay" };
+  for (const char * param : removed_params) {
+    ASSERT1 ("EnzoConfig::read_initial_music_",
+             "\"%s\" is no longer supported: use "
+             "\"Performance:io:tokens\" to limit the number of concurrent "
+             "readers instead",
+             param, (p->param(param) == nullptr));
+  }
 }
 
 //----------------------------------------------------------------------
@@ -1490,6 +1518,11 @@ void EnzoConfig::read_method_grackle_(Parameters * p)
     method_grackle_radiation_redshift = p->value_float
       ("Method:grackle:radiation_redshift", -1.0);
 
+    // number of slabs each Block is split into for solving on
+    // separate threads (SMP builds only; 0 for one per thread)
+    method_grackle_num_slabs = p->value_integer
+      ("Method:grackle:num_slabs", 1);
+
     // Set Grackle parameters from parameter file
     method_grackle_chemistry->with_radiative_cooling = p->value_integer
       ("Method:grackle:with_radiative_cooling",
@@ -1818,6 +1851,10 @@ void EnzoConfig::read_method_vlct_(Parameters * p)
     ("Method:mhd_vlct:full_dt_reconstruct_method","plm");
   method_vlct_theta_limiter = p->value_float
     ("Method:mhd_vlct:theta_limiter", 1.5);
+  method_vlct_tile_size = p->value_integer
+    ("Method:mhd_vlct:tile_size", 0);
+  method_vlct_riemann_simd = p->value_string
+    ("Method:mhd_vlct:riemann_simd", "none");
 
   // we should raise an error if mhd_choice is not specified
   bool uses_vlct = false;
@@ -1853,6 +1890,26 @@ void EnzoConfig::read_method_gravity_(Parameters * p)
 
   method_gravity_dt_max = p->value_float
     ("Method:gravity:dt_max",1.0e10);
+
+  // Additional density fields whose potentials are solved for
+  // together with the gravitational potential
+
+  const int num_batch = p->list_length("Method:gravity:batch_density");
+
+  ASSERT2 ("EnzoConfig::read_method_gravity_()",
+           "Method:gravity:batch_density length %d must match "
+           "Method:gravity:batch_potential length %d",
+           num_batch, p->list_length("Method:gravity:batch_potential"),
+           num_batch == p->list_length("Method:gravity:batch_potential"));
+
+  method_gravity_batch_density.resize(num_batch);
+  method_gravity_batch_potential.resize(num_batch);
+  for (int i=0; i<num_batch; i++) {
+    method_gravity_batch_density[i] =
+      p->list_value_string(i,"Method:gravity:batch_density");
+    method_gravity_batch_potential[i] =
+      p->list_value_string(i,"Method:gravity:batch_potential");
+  }
 }
 
 //----------------------------------------------------------------------
@@ -1878,6 +1935,11 @@ void EnzoConfig::read_method_check_(Parameters * p)
     }
   }
   method_check_monitor_iter = p->value_integer("monitor_iter",0);
+  method_check_window = p->value_integer("window",1);
+
+  ASSERT1("EnzoConfig::read_method_check_",
+          "Method:check:window = %d must be at least 1",
+          method_check_window, (method_check_window >= 1));
 }
 
 //----------------------------------------------------------------------
@@ -1939,6 +2001,8 @@ void EnzoConfig::read_method_sink_maker_(Parameters * p)
 void EnzoConfig::read_method_pm_deposit_(Parameters * p)
 {
   method_pm_deposit_alpha = p->value_float ("Method:pm_deposit:alpha",0.5);
+  method_pm_deposit_scheme = p->value_string
+    ("Method:pm_deposit:scheme","cic");
 }
 
 //----------------------------------------------------------------------
@@ -2342,6 +2406,10 @@ void EnzoConfig::read_solvers_(Parameters * p)
   solver_precondition.resize(num_solvers);
   solver_coarse_level.resize(num_solvers);
   solver_is_unigrid.resize(num_solvers);
+  solver_pipelined.resize(num_solvers);
+  solver_batch_size.resize(num_solvers);
+  solver_num_pre_smooth.resize(num_solvers);
+  solver_num_post_smooth.resize(num_solvers);
 
   for (int index_solver=0; index_solver<num_solvers; index_solver++) {
 
@@ -2405,6 +2473,18 @@ void EnzoConfig::read_solvers_(Parameters * p)
     solver_is_unigrid[index_solver] =
       p->value_logical (solver_name + ":is_unigrid",false);
 
+    solver_pipelined[index_solver] =
+      p->value_logical (solver_name + ":pipelined",false);
+
+    solver_batch_size[index_solver] =
+      p->value_integer (solver_name + ":batch_size",1);
+
+    solver_num_pre_smooth[index_solver] =
+      p->value_integer (solver_name + ":num_pre_smooth",2);
+
+    solver_num_post_smooth[index_solver] =
+      p->value_integer (solver_name + ":num_post_smooth",2);
+
   }
 }
 
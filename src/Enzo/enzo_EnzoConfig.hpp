@@ -229,6 +229,8 @@ public: // interface
       initial_hdf5_particle_datasets(),
       initial_hdf5_particle_files(),
       initial_hdf5_particle_types(),
+      initial_hdf5_read_mode(),
+      initial_hdf5_slab_depth(1),
       //   AE: Maybe these values (and those in cpp) don't matter
       //       are they overwritten by the read-in (even when not found in param file)?
       // EnzoInitialIsolatedGalaxy
@@ -275,12 +277,8 @@ public: // interface
       initial_music_particle_files(),
       initial_music_particle_types(),
       initial_music_throttle_close_count(),
-      initial_music_throttle_group_size(),
-      initial_music_throttle_internode(),
       initial_music_throttle_intranode(),
       initial_music_throttle_node_files(),
-      initial_music_throttle_seconds_delay(),
-      initial_music_throttle_seconds_stagger(),
       // EnzoInitialPm
       initial_pm_field(""),
       initial_pm_level(0),
@@ -334,6 +332,7 @@ public: // interface
       method_check_ordering("order_morton"),
       method_check_dir(),
       method_check_monitor_iter(0),
+      method_check_window(1),
       /// EnzoMethodFeedback
       method_feedback_ejecta_mass(0.0),
       method_feedback_ejecta_metal_fraction(0.0),
@@ -401,6 +400,7 @@ public: // interface
       method_grackle_chemistry(nullptr),
       method_grackle_use_cooling_timestep(false),
       method_grackle_radiation_redshift(-1.0),
+      method_grackle_num_slabs(1),
 #endif
       // EnzoMethodGravity
       method_gravity_grav_const(0.0),
@@ -408,6 +408,8 @@ public: // interface
       method_gravity_order(4),
       method_gravity_dt_max(1.0e10),
       method_gravity_accumulate(false),
+      method_gravity_batch_density(),
+      method_gravity_batch_potential(),
       // EnzoMethodBackgroundAcceleration
       method_background_acceleration_flavor(""),
       method_background_acceleration_mass(0.0),
@@ -422,6 +424,7 @@ public: // interface
       method_background_acceleration_apply_acceleration(true),
       // EnzoMethodPmDeposit
       method_pm_deposit_alpha(0.5),
+      method_pm_deposit_scheme("cic"),
       // EnzoMethodPmUpdate
       method_pm_update_max_dt(0.0),
       // EnzoMethodMHDVlct
@@ -430,6 +433,8 @@ public: // interface
       method_vlct_full_dt_reconstruct_method(""),
       method_vlct_theta_limiter(0.0),
       method_vlct_mhd_choice(""),
+      method_vlct_tile_size(0),
+      method_vlct_riemann_simd(""),
       // EnzoMethodMergeSinks
       method_merge_sinks_merging_radius_cells(0.0),
       // EnzoMethodAccretion
@@ -461,6 +466,12 @@ public: // interface
       solver_precondition(),
       solver_coarse_level(),
       solver_is_unigrid(),
+      // EnzoSolverCg
+      solver_pipelined(),
+      solver_batch_size(),
+      // EnzoSolverMgAmr
+      solver_num_pre_smooth(),
+      solver_num_post_smooth(),
       // EnzoStopping
       stopping_redshift()
 
@@ -652,6 +663,8 @@ public: // attributes
   std::string                 initial_hdf5_format;
   int                         initial_hdf5_blocking[3];
   int                         initial_hdf5_monitor_iter;
+  std::string                 initial_hdf5_read_mode;
+  int                         initial_hdf5_slab_depth;
   std::vector < std::string > initial_hdf5_field_files;
   std::vector < std::string > initial_hdf5_field_datasets;
   std::vector < std::string > initial_hdf5_field_names;
@@ -682,13 +695,9 @@ public: // attributes
   std::vector < std::string > initial_music_particle_coords;
   std::vector < std::string > initial_music_particle_types;
   std::vector < std::string > initial_music_particle_attributes;
-  bool                        initial_music_throttle_internode;
   bool                        initial_music_throttle_intranode;
   bool                        initial_music_throttle_node_files;
   int                         initial_music_throttle_close_count;
-  int                         initial_music_throttle_group_size;
-  double                      initial_music_throttle_seconds_stagger;
-  double                      initial_music_throttle_seconds_delay;
 
   /// EnzoInitialPm
   std::string                initial_pm_field;
@@ -818,6 +827,7 @@ public: // attributes
   std::string                method_check_ordering;
   std::vector<std::string>   method_check_dir;
   int                        method_check_monitor_iter;
+  int                        method_check_window;
 
   /// EnzoMethodCheckGravity
   std::string                method_check_gravity_particle_type;
@@ -893,6 +903,7 @@ public: // attributes
   chemistry_data *           method_grackle_chemistry;
   bool                       method_grackle_use_cooling_timestep;
   double                     method_grackle_radiation_redshift;
+  int                        method_grackle_num_slabs;
 #endif /* CONFIG_USE_GRACKLE */
 
   /// EnzoMethodGravity
@@ -901,6 +912,8 @@ public: // attributes
   int                        method_gravity_order;
   double                     method_gravity_dt_max;
   bool                       method_gravity_accumulate;
+  std::vector<std::string>   method_gravity_batch_density;
+  std::vector<std::string>   method_gravity_batch_potential;
 
   /// EnzoMethodBackgroundAcceleration
 
@@ -922,6 +935,7 @@ public: // attributes
   /// EnzoMethodPmDeposit
 
   double                     method_pm_deposit_alpha;
+  std::string                method_pm_deposit_scheme;
 
   /// EnzoMethodPmUpdate
 
@@ -933,6 +947,8 @@ public: // attributes
   std::string                method_vlct_full_dt_reconstruct_method;
   double                     method_vlct_theta_limiter;
   std::string                method_vlct_mhd_choice;
+  int                        method_vlct_tile_size;
+  std::string                method_vlct_riemann_simd;
 
   /// EnzoMethodMergeSinks
   double                     method_merge_sinks_merging_radius_cells;
@@ -998,6 +1014,22 @@ public: // attributes
   std::vector<int>           solver_coarse_level;
   std::vector<int>           solver_is_unigrid;
 
+  /// EnzoSolverCg
+
+  /// Whether to use the pipelined CG iteration with a single fused
+  /// reduction per iteration
+  std::vector<int>           solver_pipelined;
+
+  /// Maximum number of right-hand sides solved together, sharing
+  /// global reductions
+  std::vector<int>           solver_batch_size;
+
+  /// EnzoSolverMgAmr
+
+  /// Number of Jacobi sweeps before and after the coarse-grid correction
+  std::vector<int>           solver_num_pre_smooth;
+  std::vector<int>           solver_num_post_smooth;
+
   /// Stop at specified redshift for cosmology
   double                     stopping_redshift;
 
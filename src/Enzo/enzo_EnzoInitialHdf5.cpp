@@ -19,6 +19,8 @@ EnzoInitialHdf5::EnzoInitialHdf5
  std::string                 format,
  const int                   blocking[3],
  int                         monitor_iter_,
+ std::string                 read_mode,
+ int                         slab_depth,
  std::vector < std::string > field_files,
  std::vector < std::string > field_datasets,
  std::vector < std::string > field_coords,
@@ -32,6 +34,8 @@ EnzoInitialHdf5::EnzoInitialHdf5
      max_level_(max_level),
      format_ (format),
      monitor_iter_(monitor_iter_),
+     read_mode_(read_mode),
+     slab_depth_(slab_depth),
      field_files_ (field_files),
      field_datasets_ (field_datasets),
      field_coords_ (field_coords),
@@ -59,6 +63,10 @@ EnzoInitialHdf5::EnzoInitialHdf5
             "Unsupported format '%s'",
             format.c_str());
   }
+  ASSERT1 ("EnzoInitialHdf5::EnzoInitialHdf5()",
+           "Unsupported read_mode '%s': must be \"block\" or \"slab\"",
+           read_mode.c_str(),
+           (read_mode == "block" || read_mode == "slab"));
   i_sync_msg_ = cello::scalar_descr_sync()->new_value("initial_hdf5:msg");
 }
 
@@ -73,6 +81,8 @@ void EnzoInitialHdf5::pup (PUP::er &p)
   p | format_;
   PUParray (p,blocking_,3);
   p | monitor_iter_;
+  p | read_mode_;
+  p | slab_depth_;
 
   p | field_files_;
   p | field_datasets_;
@@ -107,6 +117,29 @@ void EnzoInitialHdf5::enforce_block
 
   // Assert: to reach this point, block must be a reading block
 
+  // Wait until the number of concurrent readers is below the
+  // Performance:io:tokens limit if any
+  if (cello::io_admission()->is_active()) {
+    cello::io_admission()->acquire
+      (CkCallback(CkIndex_EnzoBlock::p_initial_hdf5_read(),
+                  enzo::block_array()[block->index()]));
+  } else {
+    read_files(block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_initial_hdf5_read()
+{
+  EnzoInitialHdf5 * initial = static_cast<EnzoInitialHdf5*> (this->initial());
+  initial->read_files(this);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoInitialHdf5::read_files (Block * block)
+{
   int array_lower[3],array_upper[3];
   root_block_range_(block->index(),array_lower,array_upper);
 
@@ -130,6 +163,13 @@ void EnzoInitialHdf5::enforce_block
   // Maintain running count of messages sent
   int count_messages = 0;
 
+  // In "slab" mode, read slab_depth layers of root blocks along z at a
+  // time (all layers if slab_depth_ is 0); otherwise read one block at
+  // a time
+  const bool l_slab = (read_mode_ == "slab");
+  const int slab_depth = (! l_slab) ? 1 :
+    ((slab_depth_ > 0) ? slab_depth_ : array_upper[2] - array_lower[2]);
+
   // Read in Field files
   for (size_t index=0; index<field_files_.size(); index++) {
 
@@ -159,41 +199,56 @@ void EnzoInitialHdf5::enforce_block
     // Count number of messages to send per block
     ++count_messages;
 
-    // Loop over root-level blocks in range of this reader
-    for (int ax=array_lower[0]; ax<array_upper[0]; ax++) {
-      for (int ay=array_lower[1]; ay<array_upper[1]; ay++) {
-        for (int az=array_lower[2]; az<array_upper[2]; az++) {
-          int block_index[3] = {ax,ay,az};
-          Index index_block(ax,ay,az);
-
-          char * data;
-          read_dataset_
-            (file, &data,index_block, type_data,
-             lower_block,upper_block,block_index,
-             field_coords_[index],
-             nx,ny,nz,m4,n4,h4,&IX,&IY,&IZ);
-
-          if (index_block == block->index() ) {
-
-            // local block: copy directly to field
-            copy_dataset_to_field_
-              (block, field_names_[index],type_data,
-               data,mx,my,mz,nx,ny,nz,gx,gy,gz,n4,IX,IY);
-
-          } else {
-
-            // remote block: pack message and send
-            MsgInitial * msg_initial = new MsgInitial;
-            msg_initial->set_dataset (n4,h4,nx,ny,nz,IX,IY,IZ);
-            msg_initial->set_field_data
-              (field_names_[index],data,nx*ny*nz,type_data);
-            enzo::block_array()[index_block].p_initial_hdf5_recv(msg_initial);
-          }
+    // Loop over layers of root-level blocks in range of this reader
+    for (int az0=array_lower[2]; az0<array_upper[2]; az0+=slab_depth) {
+
+      int slab_lower[3] = {array_lower[0],array_lower[1],az0};
+      int slab_upper[3] = {array_upper[0],array_upper[1],
+                           std::min(az0 + slab_depth,array_upper[2])};
+      char * slab = nullptr;
+      int s4[4];
+      if (l_slab) {
+        read_slab_ (file, &slab, type_data, slab_lower, slab_upper,
+                    field_coords_[index], nx,ny,nz,m4,s4);
+      }
+
+      // Loop over root-level blocks in the layer
+      for (int az=slab_lower[2]; az<slab_upper[2]; az++) {
+        for (int ay=slab_lower[1]; ay<slab_upper[1]; ay++) {
+          for (int ax=slab_lower[0]; ax<slab_upper[0]; ax++) {
+            int block_index[3] = {ax,ay,az};
+            Index index_block(ax,ay,az);
+
+            char * data;
+            read_block_
+              (file, &data, slab, slab_lower, s4, index_block, type_data,
+               lower_block,upper_block,block_index,
+               field_coords_[index],
+               nx,ny,nz,m4,n4,h4,&IX,&IY,&IZ);
+
+            if (index_block == block->index() ) {
 
-          delete_array_ (&data,type_data);
+              // local block: copy directly to field
+              copy_dataset_to_field_
+                (block, field_names_[index],type_data,
+                 data,mx,my,mz,nx,ny,nz,gx,gy,gz,n4,IX,IY);
 
+            } else {
+
+              // remote block: pack message and send
+              MsgInitial * msg_initial = new MsgInitial;
+              msg_initial->set_dataset (n4,h4,nx,ny,nz,IX,IY,IZ);
+              msg_initial->set_field_data
+                (field_names_[index],data,nx*ny*nz,type_data);
+              enzo::block_array()[index_block].p_initial_hdf5_recv(msg_initial);
+            }
+
+            delete_array_ (&data,type_data);
+
+          }
         }
       }
+      if (slab) delete_array_ (&slab,type_data);
     }
     file->data_close();
     file->file_close();
@@ -228,55 +283,73 @@ void EnzoInitialHdf5::enforce_block
     // Count number of messages to send per block
     ++count_messages;
 
-    // Loop over root-level blocks in range of this reader
-    for (int ax=array_lower[0]; ax<array_upper[0]; ax++) {
-      for (int ay=array_lower[1]; ay<array_upper[1]; ay++) {
-        for (int az=array_lower[2]; az<array_upper[2]; az++) {
-
-          int block_index[3] = {ax,ay,az};
-          Index index_block(ax,ay,az);
-
-          char * data;
-          read_dataset_
-            (file, &data,index_block, type_data,
-             lower_block,upper_block,block_index,
-             particle_coords_[index],
-             nx,ny,nz,m4,n4,h4,&IX,&IY,&IZ);
-
-          if (index_block == block->index() ) {
-
-            // local block: copy directly to particle
-            copy_dataset_to_particle_
-              (block,
-               particle_types_[index],
-               particle_attributes_[index],
-               type_data,
-               data,
-               nx,ny,nz,
-               h4,IX,IY,IZ);
-
-          } else {
-
-            // remote block: pack message and send
-            MsgInitial * msg_initial = new MsgInitial;
-            msg_initial->set_dataset (n4,h4,nx,ny,nz,IX,IY,IZ);
-            msg_initial->set_particle_data
-              (particle_types_[index],
-               particle_attributes_[index],
-               data,nx*ny*nz,type_data);
-
-            enzo::block_array()[index_block].p_initial_hdf5_recv(msg_initial);
+    // Loop over layers of root-level blocks in range of this reader
+    for (int az0=array_lower[2]; az0<array_upper[2]; az0+=slab_depth) {
+
+      int slab_lower[3] = {array_lower[0],array_lower[1],az0};
+      int slab_upper[3] = {array_upper[0],array_upper[1],
+                           std::min(az0 + slab_depth,array_upper[2])};
+      char * slab = nullptr;
+      int s4[4];
+      if (l_slab) {
+        read_slab_ (file, &slab, type_data, slab_lower, slab_upper,
+                    particle_coords_[index], nx,ny,nz,m4,s4);
+      }
 
+      // Loop over root-level blocks in the layer
+      for (int az=slab_lower[2]; az<slab_upper[2]; az++) {
+        for (int ay=slab_lower[1]; ay<slab_upper[1]; ay++) {
+          for (int ax=slab_lower[0]; ax<slab_upper[0]; ax++) {
+
+            int block_index[3] = {ax,ay,az};
+            Index index_block(ax,ay,az);
+
+            char * data;
+            read_block_
+              (file, &data, slab, slab_lower, s4, index_block, type_data,
+               lower_block,upper_block,block_index,
+               particle_coords_[index],
+               nx,ny,nz,m4,n4,h4,&IX,&IY,&IZ);
+
+            if (index_block == block->index() ) {
+
+              // local block: copy directly to particle
+              copy_dataset_to_particle_
+                (block,
+                 particle_types_[index],
+                 particle_attributes_[index],
+                 type_data,
+                 data,
+                 nx,ny,nz,
+                 h4,IX,IY,IZ);
+
+            } else {
+
+              // remote block: pack message and send
+              MsgInitial * msg_initial = new MsgInitial;
+              msg_initial->set_dataset (n4,h4,nx,ny,nz,IX,IY,IZ);
+              msg_initial->set_particle_data
+                (particle_types_[index],
+                 particle_attributes_[index],
+                 data,nx*ny*nz,type_data);
+
+              enzo::block_array()[index_block].p_initial_hdf5_recv(msg_initial);
+
+            }
+            delete_array_ (&data,type_data);
           }
-          delete_array_ (&data,type_data);
         }
       }
+      if (slab) delete_array_ (&slab,type_data);
     }
     file->data_close();
     file->file_close();
     delete file;
   }
 
+  // Allow the next reader waiting for the IoAdmission service to start
+  cello::io_admission()->release();
+
   for (int ax=array_lower[0]; ax<array_upper[0]; ax++) {
     for (int ay=array_lower[1]; ay<array_upper[1]; ay++) {
       for (int az=array_lower[2]; az<array_upper[2]; az++) {
@@ -542,14 +615,42 @@ void EnzoInitialHdf5::read_dataset_
  int m4[4], int n4[4],double h4[4],
  int *IX, int *IY, int *IZ)
 {
+  dataset_layout_
+    (lower_block,upper_block,axis_map,nx,ny,nz,n4,h4,IX,IY,IZ);
 
-  // Get the grid size at level_
-  Hierarchy * hierarchy = cello::simulation()->hierarchy();
-  double lower_domain[3];
-  double upper_domain[3];
-  hierarchy->lower(lower_domain, lower_domain+1, lower_domain+2);
-  hierarchy->upper(upper_domain, upper_domain+1, upper_domain+2);
+  // determine offsets
+  int o4[4] = {0,0,0,0};
+  o4[(*IX)] = block_index[0]*nx;
+  o4[(*IY)] = block_index[1]*ny;
+  o4[(*IZ)] = block_index[2]*nz;
+
+  // open the dataspace
+  file-> data_slice
+    (m4[0],m4[1],m4[2],m4[3],
+     n4[0],n4[1],n4[2],n4[3],
+     o4[0],o4[1],o4[2],o4[3]);
+
+  // create memory space
+  // (fields was n4[(*IX)],n4[(*IY)],n4[(*IZ)])
+  file->mem_create (nx,ny,nz,nx,ny,nz,0,0,0);
+
+  // input domain size
+
+  const int n = nx*ny*nz;
+  (*data) = allocate_array_ (n,type_data);
+
+  file->data_read ((*data));
+}
 
+//----------------------------------------------------------------------
+
+void EnzoInitialHdf5::dataset_layout_
+(double lower_block[3], double upper_block[3],
+ std::string axis_map,
+ int nx, int ny, int nz,
+ int n4[4], double h4[4],
+ int *IX, int *IY, int *IZ)
+{
   // Read the domain dimensions
 
   *IX = axis_map.find ("x");
@@ -574,29 +675,101 @@ void EnzoInitialHdf5::read_dataset_
   h4[(*IX)] = (upper_block[0] - lower_block[0]) / nx;
   h4[(*IY)] = (upper_block[1] - lower_block[1]) / ny;
   h4[(*IZ)] = (upper_block[2] - lower_block[2]) / nz;
+}
 
-  // determine offsets
+//----------------------------------------------------------------------
+
+void EnzoInitialHdf5::read_slab_
+(File * file, char ** slab, int type_data,
+ int slab_lower[3], int slab_upper[3],
+ std::string axis_map,
+ int nx, int ny, int nz,
+ int m4[4], int s4[4])
+{
+  const int IX = axis_map.find ("x");
+  const int IY = axis_map.find ("y");
+  const int IZ = axis_map.find ("z");
+
+  // slab size and offset in dataset axis order
+  const int sx = (slab_upper[0] - slab_lower[0])*nx;
+  const int sy = (slab_upper[1] - slab_lower[1])*ny;
+  const int sz = (slab_upper[2] - slab_lower[2])*nz;
   int o4[4] = {0,0,0,0};
-  o4[(*IX)] = block_index[0]*nx;
-  o4[(*IY)] = block_index[1]*ny;
-  o4[(*IZ)] = block_index[2]*nz;
+  s4[0] = s4[1] = s4[2] = s4[3] = 1;
+  s4[IX] = sx;
+  s4[IY] = sy;
+  s4[IZ] = sz;
+  o4[IX] = slab_lower[0]*nx;
+  o4[IY] = slab_lower[1]*ny;
+  o4[IZ] = slab_lower[2]*nz;
 
-  // open the dataspace
   file-> data_slice
     (m4[0],m4[1],m4[2],m4[3],
-     n4[0],n4[1],n4[2],n4[3],
+     s4[0],s4[1],s4[2],s4[3],
      o4[0],o4[1],o4[2],o4[3]);
 
-  // create memory space
-  // (fields was n4[(*IX)],n4[(*IY)],n4[(*IZ)])
-  file->mem_create (nx,ny,nz,nx,ny,nz,0,0,0);
+  file->mem_create (sx,sy,sz,sx,sy,sz,0,0,0);
 
-  // input domain size
+  (*slab) = allocate_array_ (sx*sy*sz,type_data);
 
-  const int n = nx*ny*nz;
-  (*data) = allocate_array_ (n,type_data);
+  file->data_read ((*slab));
+}
 
-  file->data_read ((*data));
+//----------------------------------------------------------------------
+
+void EnzoInitialHdf5::read_block_
+(File * file, char ** data, const char * slab,
+ int slab_lower[3], int s4[4],
+ Index index, int type_data,
+ double lower_block[3], double upper_block[3],
+ int block_index[3],
+ std::string axis_map,
+ int nx, int ny, int nz,
+ int m4[4], int n4[4], double h4[4],
+ int *IX, int *IY, int *IZ)
+{
+  if (slab == nullptr) {
+    read_dataset_
+      (file, data, index, type_data, lower_block, upper_block, block_index,
+       axis_map, nx,ny,nz, m4,n4,h4, IX,IY,IZ);
+    return;
+  }
+
+  dataset_layout_
+    (lower_block,upper_block,axis_map,nx,ny,nz,n4,h4,IX,IY,IZ);
+
+  // offset of the block within the slab
+  int o4[4] = {0,0,0,0};
+  o4[(*IX)] = (block_index[0] - slab_lower[0])*nx;
+  o4[(*IY)] = (block_index[1] - slab_lower[1])*ny;
+  o4[(*IZ)] = (block_index[2] - slab_lower[2])*nz;
+
+  (*data) = allocate_array_ (nx*ny*nz,type_data);
+
+  copy_slab_to_block_ ((*data), slab, type_data, s4, o4, n4);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoInitialHdf5::copy_slab_to_block_
+(char * data, const char * slab, int type_data,
+ int s4[4], int o4[4], int n4[4]) const
+{
+  // Data are stored in dataset axis order, so rows along the last
+  // axis are contiguous in both the slab and the block
+  const size_t size = (type_data == type_single) ?
+    sizeof(float) : sizeof(double);
+  const size_t row = size*n4[3];
+  for (int i0=0; i0<n4[0]; i0++) {
+    for (int i1=0; i1<n4[1]; i1++) {
+      for (int i2=0; i2<n4[2]; i2++) {
+        const size_t i =
+          o4[3] + s4[3]*((i2+o4[2]) + s4[2]*((i1+o4[1]) + s4[1]*(i0+o4[0])));
+        const size_t j = n4[3]*(i2 + n4[2]*(i1 + n4[1]*i0));
+        memcpy (data + size*j, slab + size*i, row);
+      }
+    }
+  }
 }
 
 //----------------------------------------------------------------------
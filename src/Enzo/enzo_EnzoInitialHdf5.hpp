@@ -23,6 +23,8 @@ public: // interface
                   std::string                 format,
                   const int                   blocking[3],
                   int                         monitor_iter,
+                  std::string                 read_mode,
+                  int                         slab_depth,
                   std::vector < std::string > field_files,
                   std::vector < std::string > field_datasets,
                   std::vector < std::string > field_coords,
@@ -36,6 +38,8 @@ public: // interface
 
   /// Constructor
   EnzoInitialHdf5() throw()
+    : read_mode_("block"),
+      slab_depth_(1)
   { }
 
   /// CHARM++ PUP::able declaration
@@ -45,6 +49,8 @@ public: // interface
   EnzoInitialHdf5(CkMigrateMessage *m)
     : Initial (m),
       max_level_(0),
+      read_mode_("block"),
+      slab_depth_(1),
       i_sync_msg_(-1)
   {  }
 
@@ -59,6 +65,10 @@ public: // interface
   virtual void enforce_block
   ( Block * block, const Hierarchy * hierarchy ) throw();
 
+  /// Read the data for all root blocks in the reader Block's range
+  /// once admitted by the IoAdmission service, and send it to them
+  void read_files (Block * block);
+
   void recv_data (Block * block, MsgInitial * msg_initial);
 
   void copy_dataset_to_field_
@@ -129,6 +139,43 @@ protected: // functions
    int m4[4], int n4[4], double h4[4],
    int *IX, int *IY, int *IZ);
 
+  /// Compute the dataset axes, block size and cell widths in dataset
+  /// axis order
+  void dataset_layout_
+  (double lower_block[3], double upper_block[3],
+   std::string axis_map,
+   int nx, int ny, int nz,
+   int n4[4], double h4[4],
+   int *IX, int *IY, int *IZ);
+
+  /// Read the data for all root blocks in the range [slab_lower,
+  /// slab_upper) with a single hyperslab read.  s4 is set to the slab
+  /// size in dataset axis order.
+  void read_slab_
+  (File * file, char ** slab, int type_data,
+   int slab_lower[3], int slab_upper[3],
+   std::string axis_map,
+   int nx, int ny, int nz,
+   int m4[4], int s4[4]);
+
+  /// Get the data for the given root block, either from slab if it's
+  /// not nullptr, or else by reading it from the file
+  void read_block_
+  (File * file, char ** data, const char * slab,
+   int slab_lower[3], int s4[4],
+   Index index, int type_data,
+   double lower_block[3], double upper_block[3],
+   int block_index[3],
+   std::string axis_map,
+   int nx, int ny, int nz,
+   int m4[4], int n4[4], double h4[4],
+   int *IX, int *IY, int *IZ);
+
+  /// Copy the n4 sub-array at offset o4 of the s4 slab into data
+  void copy_slab_to_block_
+  (char * data, const char * slab, int type_data,
+   int s4[4], int o4[4], int n4[4]) const;
+
   template <class T>
   void copy_field_data_to_array_
   (enzo_float * array, T * data,
@@ -167,6 +214,15 @@ protected: // attributes
   /// Parameter for controling monitoring of progress
   int         monitor_iter_;
 
+  /// How readers read datasets: "block" reads each root block
+  /// separately; "slab" reads slab_depth_ layers of root blocks along z
+  /// at a time and copies the block data from the slab in memory
+  std::string read_mode_;
+
+  /// Number of layers of root blocks along z read at a time in "slab"
+  /// mode, or 0 to read the reader's entire range at once
+  int         slab_depth_;
+
   vecstr_type field_files_;
   vecstr_type field_datasets_;
   vecstr_type field_coords_;
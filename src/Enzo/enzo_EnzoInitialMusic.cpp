@@ -6,8 +6,6 @@
 /// @brief    Read initial conditions from HDF5
 ///           (multi-scale cosmological initial conditions)
 #include "enzo.hpp"
-#include <chrono>
-#include <thread>
 
 // #define DEBUG_THROTTLE
 
@@ -39,13 +37,9 @@ EnzoInitialMusic::EnzoInitialMusic
     particle_coords_    (enzo_config->initial_music_particle_coords),
     particle_types_     (enzo_config->initial_music_particle_types),
     particle_attributes_(enzo_config->initial_music_particle_attributes),
-    throttle_internode_ (enzo_config->initial_music_throttle_internode),
     throttle_intranode_ (enzo_config->initial_music_throttle_intranode),
     throttle_node_files_(enzo_config->initial_music_throttle_node_files),
-    throttle_close_count_(enzo_config->initial_music_throttle_close_count),
-    throttle_group_size_    (enzo_config->initial_music_throttle_group_size),
-    throttle_seconds_stagger_ (enzo_config->initial_music_throttle_seconds_stagger),
-    throttle_seconds_delay_ (enzo_config->initial_music_throttle_seconds_delay)
+    throttle_close_count_(enzo_config->initial_music_throttle_close_count)
 {
 }
 
@@ -69,13 +63,9 @@ void EnzoInitialMusic::pup (PUP::er &p)
   p | particle_types_;
   p | particle_attributes_;
 
-  p | throttle_internode_;
   p | throttle_intranode_;
   p | throttle_node_files_;
   p | throttle_close_count_;
-  p | throttle_group_size_;
-  p | throttle_seconds_stagger_;
-  p | throttle_seconds_delay_;
 }
 
 //----------------------------------------------------------------------
@@ -89,10 +79,32 @@ void EnzoInitialMusic::enforce_block
     return;
   }
 
-  // Optionally pause before reading if throttling enabled.  For
-  // reducing filesystem contention on large runs
-  throttle_stagger_();
- 
+  // Wait until the number of concurrent readers is below the
+  // Performance:io:tokens limit if any, for reducing filesystem
+  // contention on large runs
+  if (cello::io_admission()->is_active()) {
+    cello::io_admission()->acquire
+      (CkCallback(CkIndex_EnzoBlock::p_initial_music_read(),
+                  enzo::block_array()[block->index()]));
+  } else {
+    read_block(block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_initial_music_read()
+{
+  EnzoInitialMusic * initial = static_cast<EnzoInitialMusic*> (this->initial());
+  initial->read_block(this);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoInitialMusic::read_block (Block * block)
+{
+  const Hierarchy * hierarchy = cello::hierarchy();
+
   // Get the grid size at level_
   double lower_domain[3];
   double upper_domain[3];
@@ -139,7 +151,6 @@ void EnzoInitialMusic::enforce_block
         fflush(stdout);
 #endif
         FileHdf5::file_list[file_name]->file_open();
-        throttle_delay_();
       }
       file = FileHdf5::file_list[file_name];
     } else {
@@ -150,7 +161,6 @@ void EnzoInitialMusic::enforce_block
       fflush(stdout);
 #endif      
       file->file_open();
-      throttle_delay_();
     }
 
     // Read the domain dimensions
@@ -254,7 +264,6 @@ void EnzoInitialMusic::enforce_block
     if ( do_close ) {
       close_count[file_name] = 0;
       file->file_close();
-      throttle_delay_();
       FileHdf5::file_list.erase(file_name);
 #ifdef DEBUG_THROTTLE
       CkPrintf ("%d %g DEBUG_THROTTLE closed %s\n",
@@ -291,7 +300,6 @@ void EnzoInitialMusic::enforce_block
         fflush(stdout);
 #endif      
         FileHdf5::file_list[file_name]->file_open();
-        throttle_delay_();
       }
 
       file = FileHdf5::file_list[file_name];
@@ -305,7 +313,6 @@ void EnzoInitialMusic::enforce_block
                 CkMyPe(),cello::simulation()->timer(),file_name.c_str());
 #endif      
       file->file_open();
-      throttle_delay_();
     }
 
     // Open the dataset
@@ -391,7 +398,6 @@ void EnzoInitialMusic::enforce_block
       close_count[file_name] = 0;
       file->file_close();
       delete file;
-      throttle_delay_();
       FileHdf5::file_list.erase(file_name);
 #ifdef DEBUG_THROTTLE
       CkPrintf ("%d %g DEBUG_THROTTLE closed %s\n",
@@ -544,54 +550,9 @@ void EnzoInitialMusic::enforce_block
     }
   }  
 
-  block->initial_done();
-}
-
-//----------------------------------------------------------------------
+  cello::io_admission()->release();
 
-void EnzoInitialMusic::throttle_stagger_()
-{
-  if (throttle_internode_) {
-    //--------------------------------------------------
-    static int count_threads = 0;
-    const int node_size = CkNumPes() / CkNumNodes();
-    if ((throttle_seconds_stagger_ > 0.0) &&
-	count_threads < node_size ) {
-      ++count_threads;
-      int ms = 1000*((CkMyPe() / node_size) % throttle_group_size_) * throttle_seconds_stagger_;
-#ifdef DEBUG_THROTTLE  
-      CkPrintf ("%d %g DEBUG_THROTTLE %d ms stagger start\n",
-		CkMyPe(),cello::simulation()->timer(),ms);
-      fflush(stdout);
-#endif      
-      std::this_thread::sleep_for(std::chrono::milliseconds(ms));
-#ifdef DEBUG_THROTTLE  
-      CkPrintf ("%d %g DEBUG_THROTTLE %d ms stagger stop\n",
-		CkMyPe(),cello::simulation()->timer(),ms);
-      fflush(stdout);
-#endif      
-    }
-  }
-}
-
-//----------------------------------------------------------------------
-
-void EnzoInitialMusic::throttle_delay_()
-{
-  if (throttle_internode_) {
-    int ms = 1000*throttle_seconds_delay_;
-#ifdef DEBUG_THROTTLE  
-    CkPrintf ("%d %g DEBUG_THROTTLE %d ms delay start\n",
-	      CkMyPe(),cello::simulation()->timer(),ms);
-    fflush(stdout);
-#endif      
-    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
-#ifdef DEBUG_THROTTLE  
-    CkPrintf ("%d %g DEBUG_THROTTLE %d ms delay stop\n",
-	      CkMyPe(),cello::simulation()->timer(),ms);
-    fflush(stdout);
-#endif      
-  }
+  block->initial_done();
 }
 
 //======================================================================
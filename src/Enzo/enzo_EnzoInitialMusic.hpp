@@ -46,15 +46,12 @@ public: // interface
   virtual void enforce_block
   ( Block * block, const Hierarchy * hierarchy ) throw();
 
+  /// Read the Block's data once admitted by the IoAdmission service,
+  /// then release the token and call initial_done()
+  void read_block (Block * block);
+
 protected: // functions
 
-  /// If internode throttling enabled, sleep (i_noden * throttle_seconds_stagger_) seconds
-  /// before first file open for each pe in node i_node
-  void throttle_stagger_();
-  /// If internode throttling enabled, sleep throttle_seconds_delay_ seconds after
-  /// each open/close pair
-  void throttle_delay_();
-  
   template <class T>
   void copy_field_data_to_array_
   (enzo_float * array, T * data,
@@ -84,11 +81,6 @@ protected: // attributes
   std::vector < std::string > particle_types_;
   std::vector < std::string > particle_attributes_;
 
-  /// Throttle output between nodes by introducing a delay before
-  /// starting reading based on node id throttle_group_size, and
-  /// throttle_seconds_delay_
-  bool throttle_internode_;
-  
   /// Use Charm++ mutex to limit open files to one per node
   /// REQUIRES CONFIG_SMP_MODE
   bool throttle_intranode_;
@@ -102,14 +94,6 @@ protected: // attributes
   /// the last block reads
   int throttle_close_count_;
 
-  /// Number of groups with different group_sizes
-  int throttle_group_size_;
-  /// if internode throttling, start reading only after stagger * K
-  /// seconds for pe's in node K
-  double throttle_seconds_stagger_;
-  /// if internode throttling, delay after each open/close pair
-  double throttle_seconds_delay_;
-
 };
 
 #endif /* ENZO_ENZO_INITIAL_MUSIC_HPP */
@@ -37,6 +37,44 @@ void EnzoMatrixLaplace::matvec
 
 //----------------------------------------------------------------------
 
+void EnzoMatrixLaplace::matvec_dot
+(int i_y, int i_x, Block * block,
+ int n, const int * i_v, long double * dot, int g0) throw()
+{
+  const int rank = cello::rank();
+
+  if (rank != 3 || (order_ != 2 && order_ != 4)) {
+    Matrix::matvec_dot(i_y,i_x,block,n,i_v,dot,g0);
+    return;
+  }
+
+  Field field = block->data()->field();
+
+  field.dimensions(0,&mx_,&my_,&mz_);
+  block->cell_width (&hx_,&hy_,&hz_);
+
+  int g3[3];
+  field.ghost_depth(0,&g3[0],&g3[1],&g3[2]);
+
+  enzo_float * X = (enzo_float * ) field.values(i_x);
+  enzo_float * Y = (enzo_float * ) field.values(i_y);
+
+  std::vector<enzo_float *> V(n);
+  for (int k=0; k<n; k++) {
+    V[k] = (i_v[k] >= 0) ? (enzo_float *) field.values(i_v[k]) : nullptr;
+  }
+
+  if (order_ == 2) {
+    enzo_matrix_laplace::matvec_3d<2>
+      (Y,X,mx_,my_,mz_,hx_,hy_,hz_,g0,n,V.data(),dot,g3);
+  } else {
+    enzo_matrix_laplace::matvec_3d<4>
+      (Y,X,mx_,my_,mz_,hx_,hy_,hz_,g0,n,V.data(),dot,g3);
+  }
+}
+
+//----------------------------------------------------------------------
+
 void EnzoMatrixLaplace::diagonal (int i_x, Block * block, int g0) throw()
 {
   Field field = block->data()->field();
@@ -66,7 +104,6 @@ void EnzoMatrixLaplace::matvec_
 
     double dx = (rank >= 1) ? 1.0 / (hx_*hx_) : 0.0;
     double dy = (rank >= 2) ? 1.0 / (hy_*hy_) : 0.0;
-    double dz = (rank >= 3) ? 1.0 / (hz_*hz_) : 0.0;
 
     if (rank == 1) {
       for (int ix=g0; ix<mx_-g0; ix++) {
@@ -84,23 +121,14 @@ void EnzoMatrixLaplace::matvec_
       }
 
     } else if (rank == 3) {
-      for     (int iz=g0; iz<mz_-g0; iz++) {
-	for   (int iy=g0; iy<my_-g0; iy++) {
-	  for (int ix=g0; ix<mx_-g0; ix++) {
-	    const int i = ix + mx_*(iy + my_*iz);
-	    Y[i] = ( X[i+idx] - 2.0*X[i] + X[i-idx]) * dx
-	      +    ( X[i+idy] - 2.0*X[i] + X[i-idy]) * dy
-	      +    ( X[i+idz] - 2.0*X[i] + X[i-idz]) * dz;
-	  }
-	}
-      }
+      enzo_matrix_laplace::matvec_3d<2>
+	(Y,X,mx_,my_,mz_,hx_,hy_,hz_,g0,0,nullptr,nullptr,nullptr);
     }
 
   } else if (order_ == 4) {
 
     const int idx2 = 2*idx;
     const int idy2 = 2*idy;
-    const int idz2 = 2*idz;
 
     g0 = std::max(2,g0);
 
@@ -109,17 +137,6 @@ void EnzoMatrixLaplace::matvec_
     const enzo_float c2 = -1.0;
     const enzo_float dx = (rank >= 1) ? 1.0/(12.0*hx_*hx_) : 0.0;
     const enzo_float dy = (rank >= 2) ? 1.0/(12.0*hy_*hy_) : 0.0;
-    const enzo_float dz = (rank >= 3) ? 1.0/(12.0*hz_*hz_) : 0.0;
-
-    const enzo_float c0x = c0*dx;
-    const enzo_float c1x = c1*dx;
-    const enzo_float c2x = c2*dx;
-    const enzo_float c0y = c0*dy;
-    const enzo_float c1y = c1*dy;
-    const enzo_float c2y = c2*dy;
-    const enzo_float c0z = c0*dz;
-    const enzo_float c1z = c1*dz;
-    const enzo_float c2z = c2*dz;
 
     if (rank == 1) {
 
@@ -146,23 +163,9 @@ void EnzoMatrixLaplace::matvec_
 
     } else if (rank == 3) {
 
-      for     (int iz=g0; iz<mz_-g0; iz++) {
-	for   (int iy=g0; iy<my_-g0; iy++) {
-	  for (int ix=g0; ix<mx_-g0; ix++) {
-	    const int i = ix + mx_*(iy + my_*iz);
-	    enzo_float * xp = X + i;
-	    Y[i] = (c0x*(xp[0]) +
-		    c1x*(xp[-idx] +xp[idx]) +
-		    c2x*(xp[-idx2]+xp[idx2]))
-	      +    (c0y*(xp[0]) +
-		    c1y*(xp[-idy] +xp[idy]) +
-		    c2y*(xp[-idy2]+xp[idy2]))
-	      +    (c0z*(xp[0]) +
-		    c1z*(xp[-idz] +xp[idz]) +
-		    c2z*(xp[-idz2]+xp[idz2]));
-	  }
-	}
-      }
+      enzo_matrix_laplace::matvec_3d<4>
+	(Y,X,mx_,my_,mz_,hx_,hy_,hz_,g0,0,nullptr,nullptr,nullptr);
+
     }
   } else if (order_ == 6) {
 
@@ -88,6 +88,13 @@ public: // virtual functions
   virtual void matvec (precision_type precision,
 		       void * y, void * x, int g0=1) throw();
 
+  /// Apply the matrix Y <-- A*X and accumulate DOT(Y,V[k]) in the
+  /// same sweep, while each row of Y is still in cache (see
+  /// enzo_matrix_laplace::matvec_3d())
+  virtual void matvec_dot (int id_y, int id_x, Block * block,
+			   int n, const int * id_v, long double * dot,
+			   int g0=1) throw();
+
   /// Extract the diagonal into the given field
   virtual void diagonal (int id_x, Block * block, int g0=1) throw();
 
@@ -0,0 +1,139 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoMatrixLaplaceKernels.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Enzo] Templated rank-3 kernels for the discrete Laplacian
+///
+/// The stencil is applied in tiles of tile_y rows in y, so that all the z
+/// stencil planes of a tile stay in cache while sweeping through z.  Dot
+/// products with other arrays can be accumulated in the same sweep, while
+/// each row of the result is still in cache.
+///
+/// This file doesn't depend on any other part of Enzo-E or Cello.
+
+#ifndef ENZO_ENZO_MATRIX_LAPLACE_KERNELS_HPP
+#define ENZO_ENZO_MATRIX_LAPLACE_KERNELS_HPP
+
+#include <algorithm>
+
+namespace enzo_matrix_laplace {
+
+  /// Number of y rows in a tile of the blocked rank-3 stencils
+  const int tile_y = 16;
+
+  //----------------------------------------------------------------------
+
+  /// Apply the order-ORDER (2 or 4) Laplacian Y <-- A*X to the mx*my*mz
+  /// array X with cell widths hx,hy,hz, outside ghost depth g0.  If n > 0,
+  /// also add DOT(Y,V[k]) over the active region given by ghost depths g3
+  /// to dot[k], or SUM(Y) if V[k] is NULL.
+  ///
+  /// X must not overlap Y.  V[k] may be Y itself, but must not otherwise
+  /// overlap it.  Each row of a dot product is summed in double and added
+  /// to dot[k] in long double, so the row sums vectorize.
+  template <int ORDER, class T>
+  void matvec_3d (T * Y, const T * X, int mx, int my, int mz,
+                  double hx, double hy, double hz, int g0,
+                  int n, T * const * V, long double * dot, const int g3[3])
+  {
+    const int idy = mx;
+    const int idz = mx*my;
+    const int idy2 = 2*idy;
+    const int idz2 = 2*idz;
+
+    g0 = std::max(ORDER/2,g0);
+
+    // order 2 coefficients
+    const double dx = 1.0 / (hx*hx);
+    const double dy = 1.0 / (hy*hy);
+    const double dz = 1.0 / (hz*hz);
+
+    // order 4 coefficients
+    const T c0 = -30.0;
+    const T c1 = 16.0;
+    const T c2 = -1.0;
+    const T d4x = 1.0/(12.0*hx*hx);
+    const T d4y = 1.0/(12.0*hy*hy);
+    const T d4z = 1.0/(12.0*hz*hz);
+    const T c0x = c0*d4x;
+    const T c1x = c1*d4x;
+    const T c2x = c2*d4x;
+    const T c0y = c0*d4y;
+    const T c1y = c1*d4y;
+    const T c2y = c2*d4y;
+    const T c0z = c0*d4z;
+    const T c1z = c1*d4z;
+    const T c2z = c2*d4z;
+
+    // rows over which to accumulate dot products
+    const int ix0 = g3 ? g3[0] : 0;
+    const int iy0 = g3 ? g3[1] : 0;
+    const int iz0 = g3 ? g3[2] : 0;
+
+    for (int jy=g0; jy<my-g0; jy+=tile_y) {
+
+      const int ky = std::min(jy + tile_y, my-g0);
+
+      for (int iz=g0; iz<mz-g0; iz++) {
+
+        for (int iy=jy; iy<ky; iy++) {
+
+          const int i0 = mx*(iy + my*iz);
+
+          T * __restrict__ y = Y + i0;
+          const T * __restrict__ x = X + i0;
+
+          if (ORDER == 2) {
+#pragma omp simd
+            for (int ix=g0; ix<mx-g0; ix++) {
+              y[ix] = ( x[ix+1]   - 2.0*x[ix] + x[ix-1])   * dx
+                +     ( x[ix+idy] - 2.0*x[ix] + x[ix-idy]) * dy
+                +     ( x[ix+idz] - 2.0*x[ix] + x[ix-idz]) * dz;
+            }
+          } else {
+#pragma omp simd
+            for (int ix=g0; ix<mx-g0; ix++) {
+              y[ix] = (c0x*(x[ix]) +
+                       c1x*(x[ix-1]   +x[ix+1]) +
+                       c2x*(x[ix-2]   +x[ix+2]))
+                +     (c0y*(x[ix]) +
+                       c1y*(x[ix-idy] +x[ix+idy]) +
+                       c2y*(x[ix-idy2]+x[ix+idy2]))
+                +     (c0z*(x[ix]) +
+                       c1z*(x[ix-idz] +x[ix+idz]) +
+                       c2z*(x[ix-idz2]+x[ix+idz2]));
+            }
+          }
+
+          // accumulate dot products while the row of Y is in cache
+
+          if (n > 0 &&
+              iy0 <= iy && iy < my-iy0 &&
+              iz0 <= iz && iz < mz-iz0) {
+            for (int k=0; k<n; k++) {
+              double sum = 0.0;
+              if (V[k] == Y) {
+                // V[k] aliases Y: don't access it through a second
+                // restrict pointer
+#pragma omp simd reduction(+:sum)
+                for (int ix=ix0; ix<mx-ix0; ix++) sum += y[ix]*y[ix];
+              } else if (V[k]) {
+                const T * __restrict__ v = V[k] + i0;
+#pragma omp simd reduction(+:sum)
+                for (int ix=ix0; ix<mx-ix0; ix++) sum += y[ix]*v[ix];
+              } else {
+#pragma omp simd reduction(+:sum)
+                for (int ix=ix0; ix<mx-ix0; ix++) sum += y[ix];
+              }
+              dot[k] += sum;
+            }
+          }
+        }
+      }
+    }
+  }
+
+}
+
+#endif /* ENZO_ENZO_MATRIX_LAPLACE_KERNELS_HPP */
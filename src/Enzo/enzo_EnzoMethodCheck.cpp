@@ -34,7 +34,8 @@ int Simulation::file_counter_ = 0;
 //----------------------------------------------------------------------
 
 EnzoMethodCheck::EnzoMethodCheck
-(int num_files, std::string ordering, std::vector<std::string> directory, int monitor_iter)
+(int num_files, std::string ordering, std::vector<std::string> directory,
+ int monitor_iter, int window)
   : Method(),
     num_files_(num_files),
     ordering_(ordering),
@@ -55,7 +56,7 @@ EnzoMethodCheck::EnzoMethodCheck
     opts.setMap(io_map);
   
     proxy_io_enzo_writer = CProxy_IoEnzoWriter::ckNew
-      (num_files, ordering,monitor_iter, opts);
+      (num_files, ordering,monitor_iter, window, opts);
 
     proxy_io_enzo_writer.doneInserting();
 
@@ -152,11 +153,23 @@ void EnzoSimulation::r_method_check_enter(CkReductionMsg *msg)
 //----------------------------------------------------------------------
 
 IoEnzoWriter::IoEnzoWriter
-(int num_files, std::string ordering, int monitor_iter) throw ()
+(int num_files, std::string ordering, int monitor_iter, int window) throw ()
   : CBase_IoEnzoWriter(),
     num_files_(num_files),
     ordering_(ordering),
-    monitor_iter_(monitor_iter)
+    stream_block_list_(),
+    file_(nullptr),
+    monitor_iter_(monitor_iter),
+    window_(window),
+    msg_map_(),
+    index_next_map_(),
+    index_block_write_(-1),
+    index_block_tail_(-1),
+    index_block_last_(-1),
+    num_credit_(0),
+    is_admitted_(false),
+    is_requested_(false),
+    zeros_()
 {
   TRACE_CHECK("[4] IoEnzoWriter::IoEnzoWriter()");
 }
@@ -174,13 +187,25 @@ void EnzoBlock::p_check_write_first
     (&msg_check,num_files,ordering,name_dir,&is_first);
 
   if (is_first) {
+    Index index_next;
+    bool is_last;
+    get_check_next_(msg_check,&index_next,&is_last);
+
     proxy_io_enzo_writer[index_file].p_write (msg_check);
+
+    // request the rest of the writer's initial window
+    const int count = enzo::config()->method_check_window - 1;
+    if (count > 0 && !is_last) {
+      enzo::block_array()[index_next].p_check_write_next
+        (num_files, ordering, count - 1);
+    }
   }
 }
 
 //----------------------------------------------------------------------
 
-void EnzoBlock::p_check_write_next(int num_files, std::string ordering)
+void EnzoBlock::p_check_write_next
+(int num_files, std::string ordering, int count)
 {
   TRACE_CHECK_BLOCK("[9] EnzoBlock::p_check_write_next",this);
 
@@ -189,7 +214,31 @@ void EnzoBlock::p_check_write_next(int num_files, std::string ordering)
   const int index_file = create_msg_check_
     (&msg_check,num_files,ordering);
 
+  Index index_next;
+  bool is_last;
+  get_check_next_(msg_check,&index_next,&is_last);
+
   proxy_io_enzo_writer[index_file].p_write (msg_check);
+
+  // forward request along the ordering to fill the writer's window
+  if (count > 0 && !is_last) {
+    enzo::block_array()[index_next].p_check_write_next
+      (num_files, ordering, count - 1);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::get_check_next_
+(EnzoMsgCheck * msg_check, Index * index_next, bool * is_last)
+{
+  std::string name_this, name_next, name_dir;
+  Index index_this;
+  long long index_block;
+  bool is_first;
+  msg_check->get_parameters
+    (index_this,*index_next,name_this,name_next,
+     index_block,is_first,*is_last,name_dir);
 }
 
 //----------------------------------------------------------------------
@@ -202,6 +251,128 @@ void IoEnzoWriter::p_write (EnzoMsgCheck * msg_check)
   bool is_first, is_last;
   std::string name_dir;
 
+  msg_check->get_parameters
+    (index_this,index_next,name_this,name_next,
+     index_block,is_first,is_last,name_dir);
+
+  // Blocks in the window may arrive in any order, so save each one
+  // until all preceding Blocks in the file have been written
+
+  msg_map_[index_block] = msg_check;
+  index_next_map_[index_block] = index_next;
+
+  if (is_first) {
+    index_block_write_ = index_block;
+    index_block_tail_  = index_block + window_ - 1;
+  }
+  if (is_last) {
+    index_block_last_ = index_block;
+  }
+
+  // Wait until the number of concurrent writers is below the
+  // Performance:io:tokens limit if any before opening the file
+
+  if (! is_admitted_) {
+    if (! cello::io_admission()->is_active()) {
+      is_admitted_ = true;
+    } else {
+      if (! is_requested_) {
+        is_requested_ = true;
+        cello::io_admission()->acquire
+          (CkCallback(CkIndex_IoEnzoWriter::p_write_admitted(),
+                      thisProxy[thisIndex]));
+      }
+      return;
+    }
+  }
+
+  write_ready_();
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::p_write_admitted()
+{
+  is_admitted_ = true;
+  write_ready_();
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::write_ready_()
+{
+  // Write all Blocks that are ready, in order
+
+  while (index_block_write_ >= 0) {
+
+    auto it = msg_map_.find(index_block_write_);
+    if (it == msg_map_.end()) break;
+
+    EnzoMsgCheck * msg_write = it->second;
+    msg_map_.erase(it);
+
+    write_msg_check_(msg_write);
+
+    if (index_block_write_ == index_block_last_) {
+
+      // reset for the next checkpoint
+      index_next_map_.clear();
+      index_block_write_ = -1;
+      index_block_tail_  = -1;
+      index_block_last_  = -1;
+      num_credit_ = 0;
+
+      // Allow the next reader or writer waiting for the IoAdmission
+      // service to start
+      is_admitted_  = false;
+      is_requested_ = false;
+      cello::io_admission()->release();
+
+      TRACE_CHECK("[A] IoEnzoWriter::p_write_first");
+      proxy_enzo_simulation[0].p_check_done();
+      return;
+    }
+
+    ++index_block_write_;
+    ++num_credit_;
+  }
+
+  // Refill the window
+
+  request_next_();
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::request_next_()
+{
+  // return if nothing has been written, or all Blocks requested
+  if (num_credit_ == 0) return;
+  if (index_block_last_ >= 0 && index_block_tail_ >= index_block_last_) return;
+
+  // return if the Block following the tail of the window is not yet known
+  auto it = index_next_map_.find(index_block_tail_);
+  if (it == index_next_map_.end()) return;
+
+  enzo::block_array()[it->second].p_check_write_next
+    (num_files_, ordering_, num_credit_ - 1);
+
+  index_next_map_.erase(index_next_map_.begin(),++it);
+
+  index_block_tail_ += num_credit_;
+  num_credit_ = 0;
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::write_msg_check_ (EnzoMsgCheck * msg_check)
+{
+  std::string name_this, name_next;
+  Index index_this, index_next;
+  long long index_block;
+  bool is_first, is_last;
+  std::string name_dir;
+
   msg_check->get_parameters
     (index_this,index_next,name_this,name_next,
      index_block,is_first,is_last,name_dir);
@@ -239,19 +410,20 @@ void IoEnzoWriter::p_write (EnzoMsgCheck * msg_check)
   // Write Block to HDF5
   file_write_block_(msg_check);
 
+  // Release the Block data; unpacked messages own their FieldFace
+  if (msg_check->data_msg_ != nullptr) {
+    DataMsg * data_msg = msg_check->data_msg_;
+    data_msg->set_field_face(data_msg->field_face(),true);
+  }
+  msg_check->del_block();
+  delete msg_check;
+
   if (is_last) {
     // close block list
     close_block_list_();
     // close HDF5 file
     file_->file_close();
   }
-
-  TRACE_CHECK("[A] IoEnzoWriter::p_write_first");
-  if (!is_last) {
-    enzo::block_array()[index_next].p_check_write_next(num_files_, ordering_);
-  } else {
-    proxy_enzo_simulation[0].p_check_done();
-  }
 }
 
 //----------------------------------------------------------------------
@@ -461,11 +633,7 @@ void IoEnzoWriter::file_write_block_ (EnzoMsgCheck * msg_check)
       is_last,
       name_dir);
 
-  //  const bool is_local = (msg_check == nullptr);
-
   IoBlock * io_block = msg_check->io_block();
-  double * lower = msg_check->block_lower();
-  double * upper = msg_check->block_upper();
   int * size     = msg_check->block_size();
 
   // Create file group for block
@@ -484,68 +652,116 @@ void IoEnzoWriter::file_write_block_ (EnzoMsgCheck * msg_check)
   file_->group_write_meta
     (msg_check->adapt_buffer_,"adapt_buffer",type_int,ADAPT_BUFFER_SIZE);
 
-  // // Create new data object to hold EnzoMsgCheck/DataMsg fields and particles
-
-  Data * data;
-  bool data_allocated (true);
-
-  int num_field_data=1;
-  data = new Data
-    (size[0],size[1],size[2],
-     num_field_data,
-     lower[0],lower[1],lower[2],
-     upper[0],upper[1],upper[2],
-     cello::field_descr(),
-     cello::particle_descr());
-
-  data->allocate();
-
-  msg_check->update(data);
-
-  // Write Block Field data
-
-  // number of "history" field data objects
-  const int nh = data->num_field_data();
-  const int nf = cello::field_descr()->field_count();
-  // // May have multiple field_data objects for field history
-  if (nh > 0) {
-    for (int i_h=0; i_h<nh; i_h++) {
-      FieldData * field_data = data->field_data(i_h);
-      for (int i_f=0; i_f<nf; i_f++) {
-        const int index_field = i_f;
-;
-        IoFieldData * io_field_data = enzo::factory()->create_io_field_data();
-
-        void * buffer;
-        std::string name;
-        int type;
-        int mx,my,mz;  // Array dimension
-        int nx,ny,nz;  // Array size
-
-        io_field_data->set_field_data((FieldData*)field_data);
-        io_field_data->set_field_index(index_field);
-
-        io_field_data->field_array
-          (&buffer, &name, &type, &mx,&my,&mz, &nx,&ny,&nz);
-
-        file_->mem_create(nx,ny,nz,nx,ny,nz,0,0,0);
-        if (mz > 1) {
-          file_->data_create(name.c_str(),type,mz,my,mx,1,nz,ny,nx,1);
-        } else if (my > 1) {
-          file_->data_create(name.c_str(),type,my,mx,  1,1,ny,nx, 1,1);
-        } else {
-          file_->data_create(name.c_str(),type,mx,  1,  1,1,nx,  1,1,1);
+  // Write Block Field data directly from the message, without
+  // copying it into an intermediate Data object
+
+  DataMsg * data_msg = msg_check->data_msg_;
+  FieldFace * field_face =
+    (data_msg != nullptr) ? data_msg->field_face() : nullptr;
+
+  if (field_face != nullptr) {
+
+    FieldDescr * field_descr = cello::field_descr();
+
+    // Field layout for the Block: no field values are allocated
+    FieldData field_data_layout (field_descr,size[0],size[1],size[2]);
+    Field field_layout (field_descr,&field_data_layout);
+
+    // Remote messages hold the active region of each field packed
+    // contiguously; local messages refer to the Block's own fields
+    const bool is_local = msg_check->is_local_;
+    const char * array = data_msg->field_array();
+    int index_array = 0;
+
+    IoFieldData * io_field_data = enzo::factory()->create_io_field_data();
+    io_field_data->set_field_data(&field_data_layout);
+
+    auto field_list = field_face->refresh()->field_list_src();
+
+    for (size_t i_f=0; i_f<field_list.size(); i_f++) {
+
+      const int index_field = field_list[i_f];
+
+      std::string name;
+      int type;
+      int mx,my,mz;  // Array dimension
+
+      io_field_data->set_field_index(index_field);
+      io_field_data->field_array
+        (nullptr, &name, &type, &mx,&my,&mz, nullptr,nullptr,nullptr);
+
+      // Region of the field held in the message
+      int i3[3],n3[3];
+      field_face->array_region(field_layout,i_f,i3,n3);
+
+      const int bytes_per_element =
+        cello::sizeof_precision(field_layout.precision(index_field));
+
+      // Disk array dimensions, size, and offset: NOTE REVERSED AXES
+      int m4[4] = {mx,1,1,1};
+      int n4[4] = {n3[0],1,1,1};
+      int o4[4] = {i3[0],0,0,0};
+      if (mz > 1) {
+        m4[0] = mz;    m4[1] = my;    m4[2] = mx;
+        n4[0] = n3[2]; n4[1] = n3[1]; n4[2] = n3[0];
+        o4[0] = i3[2]; o4[1] = i3[1]; o4[2] = i3[0];
+      } else if (my > 1) {
+        m4[0] = my;    m4[1] = mx;
+        n4[0] = n3[1]; n4[1] = n3[0];
+        o4[0] = i3[1]; o4[1] = i3[0];
+      }
+      const int md = m4[0]*m4[1]*m4[2];
+      const int nd = n4[0]*n4[1]*n4[2];
+
+      file_->data_create(name.c_str(),type,
+                         m4[0],m4[1],m4[2],1,
+                         m4[0],m4[1],m4[2],1);
+
+      // Ghost zones are not included in the message: write zeros
+      if (nd < md) {
+        const int ng = file_->data_slice_complement
+          (n4[0],n4[1],n4[2],1, o4[0],o4[1],o4[2],0);
+        if (zeros_.size() < size_t(ng*bytes_per_element)) {
+          zeros_.resize(ng*bytes_per_element,0);
         }
-        file_->data_write(buffer);
-        file_->data_close();
+        file_->mem_create(ng,1,1,ng,1,1,0,0,0);
+        file_->data_write(zeros_.data());
+        file_->mem_close();
+      }
 
-        delete io_field_data;
+      // Write the active region
+      file_->data_slice (m4[0],m4[1],m4[2],1,
+                         n4[0],n4[1],n4[2],1,
+                         o4[0],o4[1],o4[2],0);
+      if (is_local) {
+        Field field (field_descr,data_msg->field_data());
+        file_->mem_create(m4[0],m4[1],m4[2],
+                          n4[0],n4[1],n4[2],
+                          o4[0],o4[1],o4[2]);
+        file_->data_write(field.values(index_field));
+      } else {
+        file_->mem_create(nd,1,1,nd,1,1,0,0,0);
+        file_->data_write(array + index_array);
+        index_array += nd*bytes_per_element;
       }
+      file_->mem_close();
+      file_->data_close();
     }
+
+    delete io_field_data;
+  }
+
+  // Write Block Particle data
+
+  ParticleData * particle_data =
+    (data_msg != nullptr) ? data_msg->particle_data() : nullptr;
+
+  if (particle_data == nullptr) {
+    file_->group_close();
+    return;
   }
-  // // Write Block Particle data
 
-  Particle particle = data->particle();
+  Particle particle (cello::particle_descr(),particle_data);
 
   for (int it=0; it<particle.num_types(); it++) {
 
@@ -612,8 +828,6 @@ void IoEnzoWriter::file_write_block_ (EnzoMsgCheck * msg_check)
     }
   }
 
-  if (data_allocated) delete data;
-
   file_->group_close();
 }
 
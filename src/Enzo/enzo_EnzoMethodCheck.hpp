@@ -20,7 +20,8 @@ public: // interface
   EnzoMethodCheck
   (int num_files, std::string ordering,
    std::vector<std::string> directory,
-   int monitor_iter);
+   int monitor_iter,
+   int window);
 
   /// Charm++ PUP::able declarations
   PUPable_decl(EnzoMethodCheck);
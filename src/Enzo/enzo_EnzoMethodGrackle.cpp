@@ -9,6 +9,10 @@
 #include "cello.hpp"
 #include "enzo.hpp"
 
+#ifdef CONFIG_SMP_MODE
+#  include "CkLoopAPI.h"
+#endif
+
 
 //----------------------------------------------------------------------------
 
@@ -490,17 +494,9 @@ void EnzoMethodGrackle::compute_ ( Block * block) throw()
   setup_grackle_units(fadaptor, &this->grackle_units_);
   setup_grackle_fields(fadaptor, &grackle_fields);
 
-  chemistry_data * grackle_chemistry =
-    enzo::config()->method_grackle_chemistry;
-
   // Solve chemistry
   double dt = block->dt();
-  if (local_solve_chemistry(grackle_chemistry, &grackle_rates_,
-			    &grackle_units_, &grackle_fields, dt)
-      == ENZO_FAIL) {
-    ERROR("EnzoMethodGrackle::compute()",
-    "Error in local_solve_chemistry.\n");
-  }
+  solve_chemistry_(&grackle_fields, dt);
 
   // enforce metallicity floor (if one was provided)
   enforce_metallicity_floor(block);
@@ -540,6 +536,107 @@ void EnzoMethodGrackle::compute_ ( Block * block) throw()
 
   return;
 }
+
+//----------------------------------------------------------------------
+
+#ifdef CONFIG_SMP_MODE
+
+/// Arguments shared by the threads solving Grackle slabs
+struct GrackleSlabArgs {
+  chemistry_data * chemistry;
+  chemistry_data_storage * rates;
+  const code_units * units;
+  grackle_field_data * slabs;
+  int * status;
+  double dt;
+};
+
+/// CkLoop helper function: solve chemistry on slabs first to last
+static void grackle_solve_slabs_
+(int first, int last, void * result, int num_param, void * param)
+{
+  GrackleSlabArgs * args = (GrackleSlabArgs *) param;
+  for (int i=first; i<=last; i++) {
+    // each thread gets its own copy of the units
+    code_units units = *args->units;
+    args->status[i] = local_solve_chemistry
+      (args->chemistry, args->rates, &units, &args->slabs[i], args->dt);
+  }
+}
+
+#endif
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGrackle::solve_chemistry_
+(grackle_field_data * grackle_fields, double dt) throw()
+{
+  chemistry_data * grackle_chemistry =
+    enzo::config()->method_grackle_chemistry;
+
+  int num_slabs = 1;
+
+#ifdef CONFIG_SMP_MODE
+  // Split along the outermost axis, so that slabs are contiguous in
+  // memory and grid_start / grid_end differ only in that axis
+
+  const int axis  = grackle_fields->grid_rank - 1;
+  const int start = grackle_fields->grid_start[axis];
+  const int n     = grackle_fields->grid_end[axis] - start + 1;
+
+  num_slabs = enzo::config()->method_grackle_num_slabs;
+  if (num_slabs <= 0) num_slabs = CkMyNodeSize();
+  num_slabs = std::min(num_slabs, n);
+#endif
+
+  if (num_slabs <= 1) {
+
+    if (local_solve_chemistry(grackle_chemistry, &grackle_rates_,
+                              &grackle_units_, grackle_fields, dt)
+        == ENZO_FAIL) {
+      ERROR("EnzoMethodGrackle::compute()",
+            "Error in local_solve_chemistry.\n");
+    }
+    return;
+  }
+
+#ifdef CONFIG_SMP_MODE
+
+  std::vector<grackle_field_data> slabs (num_slabs, *grackle_fields);
+  std::vector<int> grid_start (3*num_slabs);
+  std::vector<int> grid_end   (3*num_slabs);
+  std::vector<int> status     (num_slabs, ENZO_SUCCESS);
+
+  for (int k=0; k<num_slabs; k++) {
+    int * slab_start = &grid_start[3*k];
+    int * slab_end   = &grid_end  [3*k];
+    for (int i=0; i<3; i++) {
+      slab_start[i] = grackle_fields->grid_start[i];
+      slab_end[i]   = grackle_fields->grid_end[i];
+    }
+    // grid_end is inclusive
+    slab_start[axis] = start + (k*n)/num_slabs;
+    slab_end[axis]   = start + ((k+1)*n)/num_slabs - 1;
+    slabs[k].grid_start = slab_start;
+    slabs[k].grid_end   = slab_end;
+  }
+
+  GrackleSlabArgs args =
+    { grackle_chemistry, &grackle_rates_, &grackle_units_,
+      slabs.data(), status.data(), dt };
+
+  CkLoop_Parallelize (grackle_solve_slabs_, 1, &args,
+                      num_slabs, 0, num_slabs - 1);
+
+  for (int k=0; k<num_slabs; k++) {
+    if (status[k] == ENZO_FAIL) {
+      ERROR1("EnzoMethodGrackle::compute()",
+             "Error in local_solve_chemistry on slab %d.\n", k);
+    }
+  }
+
+#endif
+}
 #endif // config use grackle
 
 //----------------------------------------------------------------------
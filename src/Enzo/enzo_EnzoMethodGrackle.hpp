@@ -241,6 +241,12 @@ protected: // methods
 #ifdef CONFIG_USE_GRACKLE
   void compute_( Block * block) throw();
 
+  /// Call local_solve_chemistry() on the Block.  In SMP builds the
+  /// active zones are split into slabs along the outermost axis,
+  /// which are solved concurrently by idle threads on the node
+  void solve_chemistry_ (grackle_field_data * grackle_fields,
+                         double dt) throw();
+
   void ResetEnergies ( Block * block) throw();
 
 // protected: // attributes
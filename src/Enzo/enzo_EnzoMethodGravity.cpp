@@ -26,14 +26,19 @@ EnzoMethodGravity::EnzoMethodGravity
  int order,
  bool accumulate,
  int index_prolong,
- double dt_max)
+ double dt_max,
+ std::vector<std::string> batch_density,
+ std::vector<std::string> batch_potential)
   : Method(),
     index_solver_(index_solver),
     grav_const_(grav_const),
     order_(order),
     ir_exit_(-1),
     index_prolong_(index_prolong),
-    dt_max_(dt_max)
+    dt_max_(dt_max),
+    batch_density_(batch_density),
+    batch_potential_(batch_potential),
+    ib_batch_()
 {
   // Change this if fields used in this routine change
   // declare required fields
@@ -46,6 +51,12 @@ EnzoMethodGravity::EnzoMethodGravity
   if (rank >= 2) cello::define_field ("acceleration_y");
   if (rank >= 3) cello::define_field ("acceleration_z");
 
+  for (size_t k=0; k<batch_density_.size(); k++) {
+    cello::define_field (batch_density_[k]);
+    cello::define_field (batch_potential_[k]);
+    ib_batch_.push_back(cello::field_descr()->insert_temporary());
+  }
+
 #ifdef DEBUG_FIELD_FACE
   cello::define_field ("debug_1");
   cello::define_field ("debug_2");
@@ -104,6 +115,9 @@ EnzoMethodGravity::EnzoMethodGravity
   Refresh * refresh_exit = cello::refresh(ir_exit_);
   refresh_exit->set_prolong(index_prolong_);
   refresh_exit->add_field("potential");
+  for (size_t k=0; k<batch_potential_.size(); k++) {
+    refresh_exit->add_field(batch_potential_[k]);
+  }
 
   refresh_exit->set_callback(CkIndex_EnzoBlock::p_method_gravity_end());
 }
@@ -186,8 +200,41 @@ void EnzoMethodGravity::compute(Block * block) throw()
 
   }
   
+  // Right-hand sides for additional density fields solved together
+  // with the total density
+
+  std::vector<int> ix_batch;
+  for (size_t k=0; k<ib_batch_.size(); k++) {
+
+    field.allocate_temporary(ib_batch_[k]);
+
+    enzo_float * B_k = (enzo_float*) field.values (ib_batch_[k]);
+    enzo_float * D_k = (enzo_float*) field.values (batch_density_[k]);
+
+    if (block->is_leaf()) {
+      // cosmological units as above; the mean is removed by the
+      // singular shift in the solver
+      const enzo_float scale = cosmology ?
+        -1.0 : -4.0 * (cello::pi) * grav_const_;
+      for (int i=0; i<m; i++) B_k[i] = scale * D_k[i];
+    } else {
+      for (int i=0; i<m; i++) B_k[i] = 0.0;
+    }
+
+    ix_batch.push_back(field.field_id (batch_potential_[k]));
+  }
+
   Solver * solver = enzo::problem()->solver(index_solver_);
 
+  ASSERT3 ("EnzoMethodGravity::compute()",
+           "Solver %s solves at most %d systems together, but %d "
+           "are requested by Method:gravity:batch_density",
+           solver->name().c_str(),solver->num_batch(),
+           int(ib_batch_.size()+1),
+           int(ib_batch_.size()) < solver->num_batch());
+
+  solver->set_field_batch (ix_batch,ib_batch_);
+
   // May exit before solve is done...
   solver->set_callback (CkIndex_EnzoBlock::p_method_gravity_continue());
 
@@ -280,6 +327,10 @@ void EnzoMethodGravity::compute_accelerations (EnzoBlock * enzo_block) throw()
   enzo_float * de_t = (enzo_float*) field.values("density_total");
   if (de_t) for (int i=0; i<m; i++) de_t[i] = 0.0;
 
+  for (size_t k=0; k<ib_batch_.size(); k++) {
+    field.deallocate_temporary(ib_batch_[k]);
+  }
+
 #ifdef DEBUG_COPY_POTENTIAL
   enzo_float * potential_copy = (enzo_float*) field.values ("potential_copy");
   if (potential_copy) {
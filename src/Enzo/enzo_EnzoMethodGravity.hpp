@@ -29,7 +29,11 @@ public: // interface
 		    int order,
 		    bool accumulate,
 		    int index_prolong,
-		    double dt_max);
+		    double dt_max,
+		    std::vector<std::string> batch_density =
+		    std::vector<std::string>(),
+		    std::vector<std::string> batch_potential =
+		    std::vector<std::string>());
 
   EnzoMethodGravity()
     : index_solver_(-1),
@@ -37,7 +41,10 @@ public: // interface
       order_(4),
       ir_exit_(-1),
       index_prolong_(0),
-      dt_max_(0.0)
+      dt_max_(0.0),
+      batch_density_(),
+      batch_potential_(),
+      ib_batch_()
   {};
 
   /// Destructor
@@ -54,7 +61,10 @@ public: // interface
       order_(4),
       ir_exit_(-1),
       index_prolong_(0),
-      dt_max_(0.0)
+      dt_max_(0.0),
+      batch_density_(),
+      batch_potential_(),
+      ib_batch_()
 
   { }
 
@@ -75,6 +85,9 @@ public: // interface
     p | order_;
     p | dt_max_;
     p | ir_exit_;
+    p | batch_density_;
+    p | batch_potential_;
+    p | ib_batch_;
 
   }
 
@@ -119,6 +132,14 @@ protected: // attributes
 
   /// Maximum timestep
   double dt_max_;
+
+  /// Additional density fields whose potentials are solved in the
+  /// same batched solve as "potential", and their potential fields
+  std::vector<std::string> batch_density_;
+  std::vector<std::string> batch_potential_;
+
+  /// Temporary right-hand side fields for the batched systems
+  std::vector<int> ib_batch_;
 };
 
 
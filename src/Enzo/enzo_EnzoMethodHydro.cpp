@@ -672,6 +672,16 @@ void EnzoMethodHydro::ppm_method_ ( Block * block )
   int mx,my,mz;
   field.dimensions (0,&mx,&my,&mz);
 
+  // reserve scratch space for the largest slice: slice, fluxes, and
+  // flattening arrays in ppm_euler_x_() etc., plus padding for
+  // alignment
+
+  const int nc = field.groups()->size("color");
+  const size_t ns = std::max(std::max(mx*my, my*mz), mz*mx);
+  const size_t na = (8 + nc)*ns + (23 + 3*nc)*ns + ns;
+  ScratchArena::instance()->reserve
+    (na*sizeof(enzo_float) + 3*ScratchArena::alignment);
+
   // compute pressure
 
   EnzoComputePressure compute_pressure (gamma_,	comoving_coordinates_);
@@ -764,8 +774,13 @@ void EnzoMethodHydro::ppm_euler_x_(Block * block, int iz)
   int nc = field_groups->size("color");
   na += nc*ns;
 
-  // allocate array
-  enzo_float * slice_array = new enzo_float [na];
+  // allocate array from the per-PE scratch arena (reserved in
+  // ppm_method_()), released at the end of the slice
+
+  ScratchArena * scratch = ScratchArena::instance();
+  const ScratchArena::Mark scratch_mark = scratch->mark();
+
+  enzo_float * slice_array = scratch->allocate<enzo_float>(na);
 
   // initialize array of slices
 
@@ -866,7 +881,7 @@ void EnzoMethodHydro::ppm_euler_x_(Block * block, int iz)
 
   int nf = (23 + 3*nc)*ns;
 
-  enzo_float * fluxes_array = new enzo_float [nf];
+  enzo_float * fluxes_array = scratch->allocate<enzo_float>(nf);
 
   enzo_float * pf = fluxes_array;
 
@@ -966,7 +981,7 @@ void EnzoMethodHydro::ppm_euler_x_(Block * block, int iz)
 
   enzo_float dt = block->dt();
 
-  enzo_float * flatten_array = new enzo_float[ns];
+  enzo_float * flatten_array = scratch->allocate<enzo_float>(ns);
 
   int riemann_solver_fallback = 1;
 
@@ -1206,9 +1221,7 @@ void EnzoMethodHydro::ppm_euler_x_(Block * block, int iz)
   // } // ENDFOR j
 
   // deallocate array
-  delete [] flatten_array;
-  delete [] fluxes_array;
-  delete [] slice_array;
+  scratch->release(scratch_mark);
 }
 
 //----------------------------------------------------------------------
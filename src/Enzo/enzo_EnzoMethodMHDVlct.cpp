@@ -38,7 +38,9 @@ EnzoMethodMHDVlct::EnzoMethodMHDVlct (std::string rsolver,
 				      std::string full_recon_name,
 				      double theta_limiter,
 				      std::string mhd_choice,
-				      bool store_fluxes_for_corrections)
+				      bool store_fluxes_for_corrections,
+				      int tile_size,
+				      std::string riemann_simd)
   : Method()
 {
   // check compatability with EnzoPhysicsFluidProps
@@ -78,7 +80,7 @@ EnzoMethodMHDVlct::EnzoMethodMHDVlct (std::string rsolver,
 
   riemann_solver_ = EnzoRiemann::construct_riemann
     ({rsolver, mhd_choice_ != bfield_choice::no_bfield,
-      eos_->uses_dual_energy_formalism()});
+      eos_->uses_dual_energy_formalism(), riemann_simd});
 
   // determine integration and primitive field list
   integration_field_list_ = riemann_solver_->integration_quantity_keys();
@@ -127,6 +129,18 @@ EnzoMethodMHDVlct::EnzoMethodMHDVlct (std::string rsolver,
            mhd_choice_ == bfield_choice::no_bfield);
   }
 
+  // tiled execution reuses the stale depth bookkeeping of each component
+  // on sub-blocks, which the CT bfield method doesn't support (it tracks
+  // state for the whole block)
+  ASSERT("EnzoMethodMHDVlct::EnzoMethodMHDVlct",
+         "tile_size must be non-negative", tile_size >= 0);
+  tile_size_ = tile_size;
+  if (tile_size_ > 0){
+    ASSERT("EnzoMethodMHDVlct::EnzoMethodMHDVlct",
+           "Tiled execution is currently only supported in hydro-mode",
+           mhd_choice_ == bfield_choice::no_bfield);
+  }
+
   scratch_space_ = nullptr;
 
   // Finally, initialize the default Refresh object
@@ -203,6 +217,7 @@ void EnzoMethodMHDVlct::pup (PUP::er &p)
   p|primitive_field_list_;
   p|lazy_passive_list_;
   p|store_fluxes_for_corrections_;
+  p|tile_size_;
 }
 
 //----------------------------------------------------------------------
@@ -356,7 +371,7 @@ static void allocate_FC_flux_buffer_(Block * block) throw()
   field.size(&nx,&ny,&nz);
   int single_flux_array = enzo::config()->method_flux_correct_single_array;
 
-  // this needs to be allocated every cycle
+  // reuses and clears the previous cycle's storage if unchanged
   block->data()->flux_data()->allocate (nx,ny,nz,field_list,single_flux_array);
 }
 
@@ -451,55 +466,24 @@ void EnzoMethodMHDVlct::compute ( Block * block) throw()
         reconstructor = full_dt_recon_;
       }
 
-      // set all elements of the arrays in dUcons_map to 0 (throughout the rest
-      // of the current loop, flux divergence and source terms will be
-      // accumulated in these arrays)
-      integration_quan_updater_->clear_dUcons_map(dUcons_map, 0., passive_list);
-
-      // Compute the primitive quantities from the integration quantites
-      // This basically copies all quantities that are both and an integration
-      // quantity and a primitive and converts the passsive scalars from
-      // conserved-form to specific-form (i.e. from density to mass fraction).
-      // For a non-barotropic gas, this also computes pressure
-      // - for consistency with the Ppm solver, we explicitly avoid the Grackle
-      //   routine. This is only meaningful when grackle models molecular
-      //   hydrogen (which modifes the adiabtic index)
-      const bool ignore_grackle = true;
-      eos_->primitive_from_integration(cur_integration_map, primitive_map,
-                                       stale_depth, passive_list,
-                                       ignore_grackle);
-
-      // Compute flux along each dimension
-      EnzoEFltArrayMap *flux_maps[3] = {&xflux_map, &yflux_map, &zflux_map};
-
-      for (int dim = 0; dim < 3; dim++){
-        // trim the shape of priml_map and primr_map (they're bigger than
-        // necessary so that they can be reused for each dim).
-        CSlice x_slc = (dim == 0) ? CSlice(0,-1) : CSlice(0, nullptr);
-        CSlice y_slc = (dim == 1) ? CSlice(0,-1) : CSlice(0, nullptr);
-        CSlice z_slc = (dim == 2) ? CSlice(0,-1) : CSlice(0, nullptr);
-
-        EnzoEFltArrayMap pl_map = priml_map.subarray_map(z_slc, y_slc, x_slc);
-        EnzoEFltArrayMap pr_map = primr_map.subarray_map(z_slc, y_slc, x_slc);
-
-        EFlt3DArray *interface_vel_arr_ptr, sliced_interface_vel_arr;
-        if (eos_->uses_dual_energy_formalism()){
-          // trim scratch-array for storing interface velocity values (computed
-          // by the Riemann Solver). This is used in the calculation of the
-          // internal energy source term). As with priml_map and primr_map, the
-          // array is bigger than necessary so it can be reused for each dim
-          sliced_interface_vel_arr =
-            scratch->interface_vel_arr.subarray(z_slc, y_slc, x_slc);
-          interface_vel_arr_ptr = &sliced_interface_vel_arr;
-        } else {
-          // no scratch-space was allocated, so we just pass a nullptr
-          interface_vel_arr_ptr = nullptr;
-        }
-
-        compute_flux_(dim, cur_dt, cell_widths[dim], primitive_map,
-                      pl_map, pr_map, *(flux_maps[dim]), dUcons_map,
-                      interface_vel_arr_ptr, *reconstructor, bfield_method_,
-                      stale_depth, passive_list);
+      if (tile_size_ > 0) {
+        // fuse reconstruction, Riemann solves, and updates over cache-sized
+        // tiles of the block
+        compute_update_tiled_(cur_dt, i == 1, cell_widths,
+                              external_integration_map, cur_integration_map,
+                              out_integration_map, primitive_map,
+                              priml_map, primr_map, xflux_map, yflux_map,
+                              zflux_map, dUcons_map, accel_map,
+                              scratch->interface_vel_arr, *reconstructor,
+                              stale_depth, passive_list);
+      } else {
+        compute_update_(cur_dt, i == 1, cell_widths,
+                        external_integration_map, cur_integration_map,
+                        out_integration_map, primitive_map,
+                        priml_map, primr_map, xflux_map, yflux_map,
+                        zflux_map, dUcons_map, accel_map,
+                        scratch->interface_vel_arr, *reconstructor,
+                        bfield_method_, stale_depth, passive_list);
       }
 
       if (i == 1 && store_fluxes_for_corrections_) {
@@ -516,36 +500,9 @@ void EnzoMethodMHDVlct::compute ( Block * block) throw()
 				     cur_dt);
       }
 
-      // increment the stale_depth
-      stale_depth+=reconstructor->immediate_staling_rate();
-
-      // Compute the source terms (use them to update dUcons_group)
-      compute_source_terms_(cur_dt, i == 1, external_integration_map,
-                            primitive_map, accel_map, dUcons_map, stale_depth);
-
-      // Update Bfields
-      if (bfield_method_ != nullptr) {
-        bfield_method_->update_all_bfield_components(cur_integration_map,
-                                                     xflux_map, yflux_map,
-                                                     zflux_map,
-                                                     out_integration_map,
-                                                     cur_dt,
-                                                     stale_depth);
-        bfield_method_->increment_partial_timestep();
-      }
-
-      // Update the integration quantities (includes flux divergence and source
-      // terms). This currently needs to happen after updating the
-      // cell-centered B-field so that the pressure floor can be applied to the
-      // total energy (and if necessary the total energy can be synchronized
-      // with the internal energy)
-      integration_quan_updater_->update_quantities
-        (external_integration_map, dUcons_map, out_integration_map, eos_,
-         stale_depth, passive_list);
-
-      // increment stale_depth since the inner values have been updated
-      // but the outer values have not
-      stale_depth+=reconstructor->delayed_staling_rate();
+      // increment the stale_depth. The inner values have been updated but
+      // the outer values have not
+      stale_depth+=reconstructor->total_staling_rate();
     }
   }
 
@@ -554,6 +511,188 @@ void EnzoMethodMHDVlct::compute ( Block * block) throw()
 
 //----------------------------------------------------------------------
 
+void EnzoMethodMHDVlct::compute_update_
+(const double cur_dt, const bool full_timestep,
+ const enzo_float* const cell_widths,
+ EnzoEFltArrayMap &orig_integration_map,
+ EnzoEFltArrayMap &cur_integration_map,
+ EnzoEFltArrayMap &out_integration_map,
+ EnzoEFltArrayMap &primitive_map,
+ EnzoEFltArrayMap &priml_map, EnzoEFltArrayMap &primr_map,
+ EnzoEFltArrayMap &xflux_map, EnzoEFltArrayMap &yflux_map,
+ EnzoEFltArrayMap &zflux_map, EnzoEFltArrayMap &dUcons_map,
+ const EnzoEFltArrayMap &accel_map,
+ const EFlt3DArray &interface_vel_arr,
+ EnzoReconstructor &reconstructor, EnzoBfieldMethod *bfield_method,
+ const int stale_depth, const str_vec_t& passive_list) const noexcept
+{
+  // set all elements of the arrays in dUcons_map to 0 (throughout the rest
+  // of the current loop, flux divergence and source terms will be
+  // accumulated in these arrays)
+  integration_quan_updater_->clear_dUcons_map(dUcons_map, 0., passive_list);
+
+  // Compute the primitive quantities from the integration quantites
+  // This basically copies all quantities that are both and an integration
+  // quantity and a primitive and converts the passsive scalars from
+  // conserved-form to specific-form (i.e. from density to mass fraction).
+  // For a non-barotropic gas, this also computes pressure
+  // - for consistency with the Ppm solver, we explicitly avoid the Grackle
+  //   routine. This is only meaningful when grackle models molecular
+  //   hydrogen (which modifes the adiabtic index)
+  const bool ignore_grackle = true;
+  eos_->primitive_from_integration(cur_integration_map, primitive_map,
+                                   stale_depth, passive_list,
+                                   ignore_grackle);
+
+  // Compute flux along each dimension
+  EnzoEFltArrayMap *flux_maps[3] = {&xflux_map, &yflux_map, &zflux_map};
+
+  for (int dim = 0; dim < 3; dim++){
+    // trim the shape of priml_map and primr_map (they're bigger than
+    // necessary so that they can be reused for each dim).
+    CSlice x_slc = (dim == 0) ? CSlice(0,-1) : CSlice(0, nullptr);
+    CSlice y_slc = (dim == 1) ? CSlice(0,-1) : CSlice(0, nullptr);
+    CSlice z_slc = (dim == 2) ? CSlice(0,-1) : CSlice(0, nullptr);
+
+    EnzoEFltArrayMap pl_map = priml_map.subarray_map(z_slc, y_slc, x_slc);
+    EnzoEFltArrayMap pr_map = primr_map.subarray_map(z_slc, y_slc, x_slc);
+
+    EFlt3DArray *interface_vel_arr_ptr, sliced_interface_vel_arr;
+    if (eos_->uses_dual_energy_formalism()){
+      // trim scratch-array for storing interface velocity values (computed
+      // by the Riemann Solver). This is used in the calculation of the
+      // internal energy source term). As with priml_map and primr_map, the
+      // array is bigger than necessary so it can be reused for each dim
+      sliced_interface_vel_arr =
+        interface_vel_arr.subarray(z_slc, y_slc, x_slc);
+      interface_vel_arr_ptr = &sliced_interface_vel_arr;
+    } else {
+      // no scratch-space was allocated, so we just pass a nullptr
+      interface_vel_arr_ptr = nullptr;
+    }
+
+    compute_flux_(dim, cur_dt, cell_widths[dim], primitive_map,
+                  pl_map, pr_map, *(flux_maps[dim]), dUcons_map,
+                  interface_vel_arr_ptr, reconstructor, bfield_method,
+                  stale_depth, passive_list);
+  }
+
+  // the stale_depth after reconstruction
+  const int cur_stale_depth = stale_depth +
+    reconstructor.immediate_staling_rate();
+
+  // Compute the source terms (use them to update dUcons_group)
+  compute_source_terms_(cur_dt, full_timestep, orig_integration_map,
+                        primitive_map, accel_map, dUcons_map,
+                        cur_stale_depth);
+
+  // Update Bfields
+  if (bfield_method != nullptr) {
+    bfield_method->update_all_bfield_components(cur_integration_map,
+                                                xflux_map, yflux_map,
+                                                zflux_map,
+                                                out_integration_map,
+                                                cur_dt,
+                                                cur_stale_depth);
+    bfield_method->increment_partial_timestep();
+  }
+
+  // Update the integration quantities (includes flux divergence and source
+  // terms). This currently needs to happen after updating the
+  // cell-centered B-field so that the pressure floor can be applied to the
+  // total energy (and if necessary the total energy can be synchronized
+  // with the internal energy)
+  integration_quan_updater_->update_quantities
+    (orig_integration_map, dUcons_map, out_integration_map, eos_,
+     cur_stale_depth, passive_list);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodMHDVlct::compute_update_tiled_
+(const double cur_dt, const bool full_timestep,
+ const enzo_float* const cell_widths,
+ EnzoEFltArrayMap &orig_integration_map,
+ EnzoEFltArrayMap &cur_integration_map,
+ EnzoEFltArrayMap &out_integration_map,
+ EnzoEFltArrayMap &primitive_map,
+ EnzoEFltArrayMap &priml_map, EnzoEFltArrayMap &primr_map,
+ EnzoEFltArrayMap &xflux_map, EnzoEFltArrayMap &yflux_map,
+ EnzoEFltArrayMap &zflux_map, EnzoEFltArrayMap &dUcons_map,
+ const EnzoEFltArrayMap &accel_map,
+ const EFlt3DArray &interface_vel_arr,
+ EnzoReconstructor &reconstructor,
+ const int stale_depth, const str_vec_t& passive_list) const noexcept
+{
+  // compute_update_() only updates the cells lying more than halo cells
+  // from the edge of the arrays it is given: the stale_depth after
+  // reconstruction, plus 1 since the fluxes on the outermost faces are
+  // unknown.  Every component trims stale cells relative to the arrays
+  // it is passed, so calling compute_update_() on a window that extends
+  // halo cells beyond a tile updates exactly the cells of that tile, with
+  // the same operations (and results) as for the whole block.
+  //
+  // Each window recomputes the primitives, reconstructed values, and
+  // fluxes in its halo, and clears the halo of dUcons_map.  This is safe
+  // because tiles are completed one at a time and the values in
+  // orig_integration_map that a tile reads (but may have been updated by
+  // a previous tile when it aliases out_integration_map) lie only in that
+  // halo, where dUcons_map is never used.
+  const int halo = stale_depth + reconstructor.immediate_staling_rate() + 1;
+
+  const int mz = dUcons_map.array_shape(0);
+  const int my = dUcons_map.array_shape(1);
+
+  const CSlice full_x(0, nullptr);
+
+  for (int kz = halo; kz < mz - halo; kz += tile_size_) {
+    const int kz_end = std::min(kz + tile_size_, mz - halo);
+
+    // window slices for cell-centered and z-face-centered arrays
+    const CSlice cz(kz - halo, kz_end + halo);
+    const CSlice fz(kz - halo, kz_end + halo - 1);
+
+    for (int ky = halo; ky < my - halo; ky += tile_size_) {
+      const int ky_end = std::min(ky + tile_size_, my - halo);
+
+      const CSlice cy(ky - halo, ky_end + halo);
+      const CSlice fy(ky - halo, ky_end + halo - 1);
+
+      EnzoEFltArrayMap tile_orig_map =
+        orig_integration_map.subarray_map(cz, cy, full_x);
+      EnzoEFltArrayMap tile_cur_map =
+        cur_integration_map.subarray_map(cz, cy, full_x);
+      EnzoEFltArrayMap tile_out_map =
+        out_integration_map.subarray_map(cz, cy, full_x);
+      EnzoEFltArrayMap tile_primitive_map =
+        primitive_map.subarray_map(cz, cy, full_x);
+      EnzoEFltArrayMap tile_priml_map = priml_map.subarray_map(cz, cy, full_x);
+      EnzoEFltArrayMap tile_primr_map = primr_map.subarray_map(cz, cy, full_x);
+      EnzoEFltArrayMap tile_xflux_map = xflux_map.subarray_map(cz, cy, full_x);
+      EnzoEFltArrayMap tile_yflux_map = yflux_map.subarray_map(cz, fy, full_x);
+      EnzoEFltArrayMap tile_zflux_map = zflux_map.subarray_map(fz, cy, full_x);
+      EnzoEFltArrayMap tile_dUcons_map =
+        dUcons_map.subarray_map(cz, cy, full_x);
+
+      EnzoEFltArrayMap tile_accel_map;
+      if (accel_map.size() != 0) {
+        tile_accel_map = accel_map.subarray_map(cz, cy, full_x);
+      }
+      const EFlt3DArray tile_interface_vel_arr = interface_vel_arr.is_null() ?
+        EFlt3DArray() : interface_vel_arr.subarray(cz, cy, full_x);
+
+      compute_update_(cur_dt, full_timestep, cell_widths,
+                      tile_orig_map, tile_cur_map, tile_out_map,
+                      tile_primitive_map, tile_priml_map, tile_primr_map,
+                      tile_xflux_map, tile_yflux_map, tile_zflux_map,
+                      tile_dUcons_map, tile_accel_map, tile_interface_vel_arr,
+                      reconstructor, nullptr, stale_depth, passive_list);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
 void EnzoMethodMHDVlct::post_init_checks_() const noexcept
 {
   ASSERT("EnzoMethodMHDVlct::post_init_checks_",
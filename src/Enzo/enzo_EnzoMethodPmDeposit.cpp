@@ -16,26 +16,23 @@
 
 // #define DEBUG_COLLAPSE
 
-#define FORTRAN_NAME(NAME) NAME##_
-
-extern "C" void  FORTRAN_NAME(dep_grid_cic)
-  (enzo_float * de,enzo_float * de_t,enzo_float * temp,
-   enzo_float * vx, enzo_float * vy, enzo_float * vz,
-   enzo_float * dt, enzo_float * rfield, int *rank,
-   enzo_float * hx, enzo_float * hy, enzo_float * hz,
-   int * mx,int * my,int * mz,
-   int * gxi,int * gyi,int * gzi,
-   int * nxi,int * nyi,int * nzi,
-   int * ,int * ,int * ,
-   int * nx,int * ny,int * nz,
-   int * ,int * ,int * );
-
 //----------------------------------------------------------------------
 
-EnzoMethodPmDeposit::EnzoMethodPmDeposit ( double alpha)
+EnzoMethodPmDeposit::EnzoMethodPmDeposit ( double alpha,
+                                           std::string scheme)
   : Method(),
-    alpha_(alpha)
+    alpha_(alpha),
+    scheme_(enzo_pm_deposit::scheme::cic)
 {
+  if (scheme == "tsc") {
+    scheme_ = enzo_pm_deposit::scheme::tsc;
+  } else {
+    ASSERT1("EnzoMethodPmDeposit::EnzoMethodPmDeposit",
+            "Unknown mass assignment scheme \"%s\": expecting "
+            "\"cic\" or \"tsc\"",
+            scheme.c_str(), scheme == "cic");
+  }
+
   // Check if particle types in "is_gravitating" group have either a constant
   // or an attribute called "mass" (but not both).
   ParticleDescr * particle_descr = cello::particle_descr();
@@ -91,6 +88,9 @@ void EnzoMethodPmDeposit::pup (PUP::er &p)
   Method::pup(p);
 
   p | alpha_;
+  int scheme = (int)scheme_;
+  p | scheme;
+  scheme_ = (enzo_pm_deposit::scheme)scheme;
 }
 
 //----------------------------------------------------------------------
@@ -102,6 +102,7 @@ namespace { // define local helper functions in anonymous namespace
   /// @param[out] density_particle_arr The array where the deposited mass
   ///     density is stored
   /// @param[in]  Block Contains the particle data to use for accumulation
+  /// @param[in]  scheme The mass assignment scheme (CIC or TSC)
   /// @param[in]  dt_div_cosmoa Length of time to "drift" the particles before
   ///     before deposition divided by the scale factor (computed for the time
   ///     after particles have been drifted)
@@ -114,19 +115,14 @@ namespace { // define local helper functions in anonymous namespace
   /// @param[in]      gx,gy,gz Specifies the number of cells in the ghost zone
   ///     for each dimensions
   void deposit_particles_(const CelloArray<enzo_float,3>& density_particle_arr,
-                          Block* block, double dt_div_cosmoa, double inv_vol,
+                          Block* block, enzo_pm_deposit::scheme scheme,
+                          double dt_div_cosmoa, double inv_vol,
                           int mx, int my, int mz,
                           int gx, int gy, int gz)
   {
     Particle particle (block->data()->particle());
-    Field    field    (block->data()->field());
-
-    int rank = cello::rank();
 
-    // compute extent of the active zone
-    const int nx = mx - 2 * gx;
-    const int ny = (rank >=2) ? my - 2 * gy : 1;
-    const int nz = (rank >=3) ? mz - 2 * gz : 1;
+    const int rank = cello::rank();
 
     enzo_float * de_p = density_particle_arr.data();
 
@@ -136,29 +132,28 @@ namespace { // define local helper functions in anonymous namespace
     block->lower(&xm,&ym,&zm);
     block->upper(&xp,&yp,&zp);
 
+    enzo_pm_deposit::Grid grid;
+    grid.rank = rank;
+    grid.m[0] = mx;  grid.m[1] = my;  grid.m[2] = mz;
+    grid.g[0] = gx;  grid.g[1] = gy;  grid.g[2] = gz;
+    grid.n[0] = mx - 2 * gx;
+    grid.n[1] = (rank >= 2) ? my - 2 * gy : 1;
+    grid.n[2] = (rank >= 3) ? mz - 2 * gz : 1;
+    grid.lower[0] = xm;       grid.lower[1] = ym;       grid.lower[2] = zm;
+    grid.width[0] = xp - xm;  grid.width[1] = yp - ym;  grid.width[2] = zp - zm;
+
     // Get the number of particle types in the "is_gravitating" group
     ParticleDescr * particle_descr = cello::particle_descr();
     Grouping * particle_groups = particle_descr->groups();
     const int num_is_grav = particle_groups->size("is_gravitating");
 
-    // For particle types where "mass" is an attribute,
-    // pmass will be set to point to array of particle masses
-    // For particle types where "mass" is a constant,
-    // pmass will point to the constant value.
-    enzo_float * pmass = NULL;
-
-    // The for the mass "array" (if "mass" is a constant, then
-    // there won't be a mass array, and the stride will be set
-    // to zero.
-    int dm;
+    const char * position_name[3] = {"x", "y", "z"};
+    const char * velocity_name[3] = {"vx", "vy", "vz"};
 
     // Loop over particle types in "is_gravitating" group
     for (int ipt = 0; ipt < num_is_grav; ipt++) {
       const int it = particle.type_index(particle_groups->item("is_gravitating",ipt));
 
-      // Index for mass attribute / constant
-      int imass = 0;
-
       // check correct precision for position
       int ia = particle.attribute_index(it,"x");
       int ba = particle.attribute_bytes(it,ia); // "bytes (actual)"
@@ -172,259 +167,72 @@ namespace { // define local helper functions in anonymous namespace
 	       ((be == 4) ? "single" : ((be == 8) ? "double" : "quadruple")),
 	       (ba == be));
 
+      int ia_x[3], ia_v[3];
+      for (int axis = 0; axis < rank; axis++) {
+        ia_x[axis] = particle.attribute_index(it,position_name[axis]);
+        ia_v[axis] = particle.attribute_index(it,velocity_name[axis]);
+      }
+
+      // For particle types where "mass" is an attribute, batch.mass
+      // points to the array of particle masses.  For particle types where
+      // "mass" is a constant, it points to the constant value and the
+      // stride dm is zero.
+      const bool mass_is_attribute = particle.has_attribute(it,"mass");
+      const int imass = mass_is_attribute ?
+        particle.attribute_index(it,"mass") :
+        particle.constant_index(it,"mass");
+
+      // strides are 1 unless the particle type is interleaved
+      const int dx = particle.stride(it,ia_x[0]);
+      const int dm = mass_is_attribute ? particle.stride(it,imass) : 0;
 
       // Loop over batches
       for (int ib=0; ib<particle.num_batches(it); ib++) {
 
-	const int np = particle.num_particles(it,ib);
-
-	if (particle.has_attribute(it,"mass")) {
-
-	  // Particle type has an attribute called "mass".
-	  // In this case we set pmass to point to the mass attribute array
-	  // Also set dm to be the stride for the "mass" attribute
-	  imass = particle.attribute_index(it,"mass");
-	  pmass = (enzo_float *) particle.attribute_array( it, imass, ib);
-	  dm = particle.stride(it,imass);
-
-	} else {
-
-	  // Particle type has a constant called "mass".
-	  // In this case we set pmass to point to the value
-	  // of the mass constant.
-	  // dm is set to 0, which will mean that we can loop through an
-	  // "array" of length 1.
-	  imass = particle.constant_index(it,"mass");
-	  pmass = (enzo_float*)particle.constant_value(it,imass);
-	  dm = 0;
-	}
-
-	// Deposit densities to the grid with CIC scheme
-	if (rank == 1) {
-
-	  const int ia_x  = particle.attribute_index(it,"x");
-	  const int ia_vx = particle.attribute_index(it,"vx");
-
-	  enzo_float * xa =  (enzo_float *)particle.attribute_array (it,ia_x,ib);
-	  enzo_float * vxa = (enzo_float *)particle.attribute_array (it,ia_vx,ib);
-	  const int dp =  particle.stride(it,ia_x);
-	  const int dv =  particle.stride(it,ia_vx);
-#ifdef DEBUG_COLLAPS
-	  CkPrintf ("DEBUG_COLLAPSE vxa[0] = %lg\n",vxa[0]);
-#endif
-
-	  for (int ip=0; ip<np; ip++) {
-	    double x = xa[ip*dp] + vxa[ip*dv]*dt_div_cosmoa;
-
-	    double tx = nx*(x - xm) / (xp - xm) - 0.5;
-
-	    int ix0 = gx + floor(tx);
-	    int ix1 = ix0 + 1;
-	    double x0 = 1.0 - (tx - floor(tx));
-	    double x1 = 1.0 - x0;
-
-	    // Density is mass times inverse volume
-	    // If mass is a constant, then dm is 0, pmass[ip * dm] is pmass[0], which
-	    // just dereferences pmass.
-	    enzo_float pdens = pmass[ip*dm] * inv_vol;
-	    de_p[ix0] += pdens * x0;
-	    de_p[ix1] += pdens * x1;
-
-	    if (de_p[ix0] < 0.0)
-	      WARNING3("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d] = %g",
-		       block->name().c_str(),ix0,de_p[ix0]);
-
-	    if (de_p[ix1] < 0.0)
-	      WARNING3("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d] = %g",
-		       block->name().c_str(),ix1,de_p[ix1]);
-
-	  } // Loop over particles in batch
-
-	} else if (rank == 2) {
-
-	  const int ia_x  = particle.attribute_index(it,"x");
-	  const int ia_y  = particle.attribute_index(it,"y");
-	  const int ia_vx = particle.attribute_index(it,"vx");
-	  const int ia_vy = particle.attribute_index(it,"vy");
-	  // Batch arrays
-	  enzo_float * xa  = (enzo_float *)particle.attribute_array (it,ia_x,ib);
-	  enzo_float * ya  = (enzo_float *)particle.attribute_array (it,ia_y,ib);
-	  enzo_float * vxa = (enzo_float *)particle.attribute_array (it,ia_vx,ib);
-	  enzo_float * vya = (enzo_float *)particle.attribute_array (it,ia_vy,ib);
-
-	  const int dp =  particle.stride(it,ia_x);
-	  const int dv =  particle.stride(it,ia_vx);
-
-	  for (int ip=0; ip<np; ip++) {
-
-	    double x = xa[ip*dp] + vxa[ip*dv]*dt_div_cosmoa;
-	    double y = ya[ip*dp] + vya[ip*dv]*dt_div_cosmoa;
-
-	    double tx = nx*(x - xm) / (xp - xm) - 0.5;
-	    double ty = ny*(y - ym) / (yp - ym) - 0.5;
-	    int ix0 = gx + floor(tx);
-	    int iy0 = gy + floor(ty);
-	    int ix1 = ix0 + 1;
-	    int iy1 = iy0 + 1;
-	    double x0 = 1.0 - (tx - floor(tx));
-	    double y0 = 1.0 - (ty - floor(ty));
-	    double x1 = 1.0 - x0;
-	    double y1 = 1.0 - y0;
-
-	    // Density is mass times inverse volume
-	    // If mass is a constant, then dm is 0, pmass[ip * dm] is pmass[0], which
-	    // just dereferences pmass.
-	    enzo_float pdens = pmass[ip*dm] * inv_vol;
-	    de_p[ix0+mx*iy0] += pdens * x0 * y0;
-	    de_p[ix1+mx*iy0] += pdens * x1 * y0;
-	    de_p[ix0+mx*iy1] += pdens * x0 * y1;
-	    de_p[ix1+mx*iy1] += pdens * x1 * y1;
-
-	    if (de_p[ix0+mx*iy0] < 0.0)
-	      WARNING4("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d] = %g",
-		       block->name().c_str(),ix0,iy0,de_p[ix0+mx*iy0]);
-
-	    if (de_p[ix1+mx*iy0] < 0.0)
-	      WARNING4("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d] = %g",
-		       block->name().c_str(),ix1,iy0,de_p[ix1+mx*iy0]);
-
-	    if (de_p[ix0+mx*iy1] < 0.0)
-	      WARNING4("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d] = %g",
-		       block->name().c_str(),ix0,iy1,de_p[ix0+mx*iy1]);
-
-	    if (de_p[ix1+mx*iy1] < 0.0)
-	      WARNING4("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d] = %g",
-		       block->name().c_str(),ix1,iy1,de_p[ix1+mx*iy1]);
-
-
-	  } // Loop over particles in batch
-
-	} else if (rank == 3) {
-
-	  const int ia_x  = particle.attribute_index(it,"x");
-	  const int ia_y  = particle.attribute_index(it,"y");
-	  const int ia_z  = particle.attribute_index(it,"z");
-	  const int ia_vx = particle.attribute_index(it,"vx");
-	  const int ia_vy = particle.attribute_index(it,"vy");
-	  const int ia_vz = particle.attribute_index(it,"vz");
-	  enzo_float * xa  = (enzo_float *) particle.attribute_array (it,ia_x,ib);
-	  enzo_float * ya  = (enzo_float *) particle.attribute_array (it,ia_y,ib);
-	  enzo_float * za  = (enzo_float *) particle.attribute_array (it,ia_z,ib);
-
-	  // Particle batch velocities
-	  enzo_float * vxa = (enzo_float *) particle.attribute_array (it,ia_vx,ib);
-	  enzo_float * vya = (enzo_float *) particle.attribute_array (it,ia_vy,ib);
-	  enzo_float * vza = (enzo_float *) particle.attribute_array (it,ia_vz,ib);
-
-#ifdef DEBUG_COLLAPSE
-	  CkPrintf ("DEBUG_COLLAPSE vxa[0] = %lg\n",vxa[0]);
-#endif
-
-	  const int dp =  particle.stride(it,ia_x);
-	  const int dv =  particle.stride(it,ia_vx);
-
-	  for (int ip=0; ip<np; ip++) {
-
-	    // Copy batch particle velocities to temporary block field velocities
-
-	    double x = xa[ip*dp] + vxa[ip*dv]*dt_div_cosmoa;
-	    double y = ya[ip*dp] + vya[ip*dv]*dt_div_cosmoa;
-	    double z = za[ip*dp] + vza[ip*dv]*dt_div_cosmoa;
-
-	    double tx = nx*(x - xm) / (xp - xm) - 0.5;
-	    double ty = ny*(y - ym) / (yp - ym) - 0.5;
-	    double tz = nz*(z - zm) / (zp - zm) - 0.5;
-
-	    int ix0 = gx + floor(tx);
-	    int iy0 = gy + floor(ty);
-	    int iz0 = gz + floor(tz);
-
-	    int ix1 = ix0 + 1;
-	    int iy1 = iy0 + 1;
-	    int iz1 = iz0 + 1;
-
-	    double x0 = 1.0 - (tx - floor(tx));
-	    double y0 = 1.0 - (ty - floor(ty));
-	    double z0 = 1.0 - (tz - floor(tz));
-
-	    double x1 = 1.0 - x0;
-	    double y1 = 1.0 - y0;
-	    double z1 = 1.0 - z0;
-
-	    // Density is mass times inverse volume
-	    // If mass is a constant, then dm is 0, pmass[ip * dm] is pmass[0], which
-	    // just dereferences pmass.
-	    enzo_float pdens = pmass[ip*dm] * inv_vol;
-	    de_p[ix0+mx*(iy0+my*iz0)] += pdens * x0 * y0 * z0;
-	    de_p[ix1+mx*(iy0+my*iz0)] += pdens * x1 * y0 * z0;
-	    de_p[ix0+mx*(iy1+my*iz0)] += pdens * x0 * y1 * z0;
-	    de_p[ix1+mx*(iy1+my*iz0)] += pdens * x1 * y1 * z0;
-	    de_p[ix0+mx*(iy0+my*iz1)] += pdens * x0 * y0 * z1;
-	    de_p[ix1+mx*(iy0+my*iz1)] += pdens * x1 * y0 * z1;
-	    de_p[ix0+mx*(iy1+my*iz1)] += pdens * x0 * y1 * z1;
-	    de_p[ix1+mx*(iy1+my*iz1)] += pdens * x1 * y1 * z1;
-
-	    if (de_p[ix0+mx*(iy0+my*iz0)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix0,iy0,iz0,
-		       de_p[ix0+mx*(iy0+my*iz0)]);
-
-	    if (de_p[ix1+mx*(iy0+my*iz0)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix1,iy0,iz0,
-		       de_p[ix1+mx*(iy0+my*iz0)]);
-
-	    if (de_p[ix0+mx*(iy1+my*iz0)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix0,iy1,iz0,
-		       de_p[ix0+mx*(iy1+my*iz0)]);
-
-	    if (de_p[ix1+mx*(iy1+my*iz0)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix1,iy1,iz0,
-		       de_p[ix1+mx*(iy1+my*iz0)]);
-
-	    if (de_p[ix0+mx*(iy0+my*iz1)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix0,iy0,iz1,
-		       de_p[ix0+mx*(iy0+my*iz1)]);
-
-	    if (de_p[ix1+mx*(iy0+my*iz1)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix1,iy0,iz1,
-		       de_p[ix1+mx*(iy0+my*iz1)]);
-
-	    if (de_p[ix0+mx*(iy1+my*iz1)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix0,iy1,iz1,
-		       de_p[ix0+mx*(iy1+my*iz1)]);
-
-	    if (de_p[ix1+mx*(iy1+my*iz1)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix1,iy1,iz1,
-		       de_p[ix1+mx*(iy1+my*iz1)]);
-
-	  } // Loop over particles in batch
-	} // if rank == 3
+        enzo_pm_deposit::Batch<enzo_float> batch;
+        batch.np = particle.num_particles(it,ib);
+
+        for (int axis = 0; axis < rank; axis++) {
+          batch.x[axis] = (const enzo_float *)
+            particle.attribute_array(it,ia_x[axis],ib);
+          batch.v[axis] = (const enzo_float *)
+            particle.attribute_array(it,ia_v[axis],ib);
+        }
+        batch.dx = dx;
+
+        if (mass_is_attribute) {
+          batch.mass = (const enzo_float *)
+            particle.attribute_array(it,imass,ib);
+          batch.dm = dm;
+        } else {
+          batch.mass = (enzo_float*)particle.constant_value(it,imass);
+          batch.dm = 0;
+        }
+
+        if (scheme == enzo_pm_deposit::scheme::tsc) {
+          enzo_pm_deposit::deposit_particles<enzo_pm_deposit::scheme::tsc>
+            (de_p, grid, batch, dt_div_cosmoa, inv_vol);
+        } else {
+          enzo_pm_deposit::deposit_particles<enzo_pm_deposit::scheme::cic>
+            (de_p, grid, batch, dt_div_cosmoa, inv_vol);
+        }
 
       } // Loop over batches
 
     } // Loop over particle types in "is_gravitating" group
 
+    // Check for negative densities once, rather than after each deposit
+    for (int iz=0; iz<mz; iz++) {
+      for (int iy=0; iy<my; iy++) {
+        for (int ix=0; ix<mx; ix++) {
+          if (density_particle_arr(iz,iy,ix) < 0.0)
+            WARNING5("EnzoMethodPmDeposit",
+                     "Block %s: de_p[%d,%d,%d] = %g",
+                     block->name().c_str(),ix,iy,iz,
+                     density_particle_arr(iz,iy,ix));
+        }
+      }
+    }
   }
 
   //----------------------------------------------------------------------
@@ -448,67 +256,33 @@ namespace { // define local helper functions in anonymous namespace
                     int mx, int my, int mz,
                     int gx, int gy, int gz){
 
-    int rank = cello::rank();
-    const int m = mx*my*mz;
+    const int rank = cello::rank();
 
-    // compute extent of the active zone
-    int nx = mx - 2 * gx;
-    int ny = (rank >=2) ? my - 2 * gy : 1;
-    int nz = (rank >=3) ? mz - 2 * gz : 1;
+    enzo_pm_deposit::Grid grid;
+    grid.rank = rank;
+    grid.m[0] = mx;  grid.m[1] = my;  grid.m[2] = mz;
+    grid.g[0] = gx;  grid.g[1] = gy;  grid.g[2] = gz;
+    grid.n[0] = mx - 2 * gx;
+    grid.n[1] = (rank >= 2) ? my - 2 * gy : 1;
+    grid.n[2] = (rank >= 3) ? mz - 2 * gz : 1;
 
     // retrieve primary fields needed for depositing gas density
-    enzo_float * de = (enzo_float *) field.values("density");
-    enzo_float * vxf = (enzo_float *) field.values("velocity_x");
-    enzo_float * vyf = (enzo_float *) field.values("velocity_y");
-    enzo_float * vzf = (enzo_float *) field.values("velocity_z");
-
-    // allocate and zero-initialize scratch arrays for missing velocity
-    // components.
-    std::vector<enzo_float> vel_scratch(m*(3 - rank), 0.0);
-    if (rank < 2) vyf = vel_scratch.data();
-    if (rank < 3) vzf = vel_scratch.data() + m;
-
-    // deposited_gas_density is a temporary array that just includes cells in
-    // the active zone
-    const CelloArray<enzo_float, 3> deposited_gas_density(nz,ny,nx);
-    // CelloArray sets elements to zero by default (making next line redundant)
-    std::fill_n(deposited_gas_density.data(), nx*ny*nz, 0.0);
-
-    // allocate temporary arrays
-    std::vector<enzo_float> temp(4*m, 0.0);
-    std::vector<enzo_float> rfield(m, 0.0);
-
-    int gxi=gx;
-    int gyi=gy;
-    int gzi=gz;
-    int nxi=mx-gx-1;
-    int nyi=my-gy-1;
-    int nzi=mz-gz-1;
-    int i0 = 0;
-    int i1 = 1;
-
-    FORTRAN_NAME(dep_grid_cic)(de, deposited_gas_density.data(), temp.data(),
-                               vxf, vyf, vzf,
-                               &dt_div_cosmoa, rfield.data(), &rank,
-                               &hx_prop,&hy_prop,&hz_prop,
-                               &mx,&my,&mz,
-                               &gxi,&gyi,&gzi,
-                               &nxi,&nyi,&nzi,
-                               &i0,&i0,&i0,
-                               &nx,&ny,&nz,
-                               &i1,&i1,&i1);
-
-    // build a slice of density_tot that just includes the active zone
-    CelloArray<enzo_float,3> density_tot_az = density_tot_arr.subarray
-      (CSlice(gz, mz - gz), CSlice(gy, my - gy), CSlice(gx, mx - gx));
-
-    for (int iz=0; iz<nz; iz++) {
-      for (int iy=0; iy<ny; iy++) {
-        for (int ix=0; ix<nx; ix++) {
-          density_tot_az(iz,iy,ix) += deposited_gas_density(iz,iy,ix);
-        }
-      }
+    const enzo_float * de = (enzo_float *) field.values("density");
+    const enzo_float * velocity[3] = {
+      (enzo_float *) field.values("velocity_x"),
+      (enzo_float *) field.values("velocity_y"),
+      (enzo_float *) field.values("velocity_z") };
+    const enzo_float h[3] = {hx_prop, hy_prop, hz_prop};
+
+    // the scratch array is only used if the gas is drifted
+    std::vector<enzo_float> scratch;
+    if (dt_div_cosmoa != 0.0) {
+      scratch.resize((grid.n[0]+1)*(grid.n[1]+1)*(grid.n[2]+1));
     }
+
+    enzo_pm_deposit::deposit_gas<enzo_float>
+      (density_tot_arr.data(), de, velocity, grid,
+       dt_div_cosmoa, h, scratch.data());
   }
 
 }
@@ -542,6 +316,16 @@ void EnzoMethodPmDeposit::compute ( Block * block) throw()
     int gx,gy,gz;
     field.ghost_depth(0,&gx,&gy,&gz);
 
+    // TSC deposits into the nearest cell and its two neighbors, and
+    // particles may drift a fraction of a cell out of the Block
+    ASSERT3("EnzoMethodPmDeposit::compute()",
+            "TSC deposit requires a ghost depth of at least 2 "
+            "(ghost depth is %d %d %d)", gx,gy,gz,
+            (scheme_ != enzo_pm_deposit::scheme::tsc) ||
+            ((gx >= 2) &&
+             (cello::rank() < 2 || gy >= 2) &&
+             (cello::rank() < 3 || gz >= 2)));
+
     const int m = mx*my*mz;
     std::fill_n(density_tot_arr.data(), mx*my*mz, 0.0);
 
@@ -577,7 +361,8 @@ void EnzoMethodPmDeposit::compute ( Block * block) throw()
       if (rank >= 2) inv_vol /= hy;
       if (rank >= 3) inv_vol /= hz;
 
-      deposit_particles_(density_particle_arr, block, dt_div_cosmoa, inv_vol,
+      deposit_particles_(density_particle_arr, block, scheme_,
+                         dt_div_cosmoa, inv_vol,
                          mx, my, mz,
                          gx, gy, gz);
 
@@ -17,7 +17,7 @@ class EnzoMethodPmDeposit : public Method {
 public: // interface
 
   /// Create a new EnzoMethodPmDeposit object
-  EnzoMethodPmDeposit(double alpha = 0.5);
+  EnzoMethodPmDeposit(double alpha = 0.5, std::string scheme = "cic");
 
   /// Charm++ PUP::able declarations
   PUPable_decl(EnzoMethodPmDeposit);
@@ -25,7 +25,8 @@ public: // interface
   /// Charm++ PUP::able migration constructor
   EnzoMethodPmDeposit (CkMigrateMessage *m)
     : Method (m),
-      alpha_(0.0)
+      alpha_(0.0),
+      scheme_(enzo_pm_deposit::scheme::cic)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -45,6 +46,9 @@ protected: // attributes
   /// Deposit at time + alpha*dt
   double alpha_;
 
+  /// Mass assignment scheme used for particles
+  enzo_pm_deposit::scheme scheme_;
+
 };
 
 #endif /* ENZO_ENZO_METHOD_PM_DEPOSIT_HPP */
@@ -147,9 +147,9 @@ void EnzoMethodPmUpdate::compute ( Block * block) throw()
       const int ia_ay = (rank >= 2) ? particle.attribute_index (it, "ay") : -1;
       const int ia_az = (rank >= 3) ? particle.attribute_index (it, "az") : -1;
 
-      const int dp = particle.stride(it, ia_x);
-      const int dv = particle.stride(it, ia_vx);
-      const int da = particle.stride(it, ia_ax);
+      const int ia_p[3] = {ia_x,  ia_y,  ia_z};
+      const int ia_v[3] = {ia_vx, ia_vy, ia_vz};
+      const int ia_a[3] = {ia_ax, ia_ay, ia_az};
 
       const int nb = particle.num_batches (it);
 
@@ -168,94 +168,69 @@ void EnzoMethodPmUpdate::compute ( Block * block) throw()
 	        ((be == 8) ? "double" : "quadruple")),
 	       (ba == be));
 
-      for (int ib=0; ib<nb; ib++) {
-
-        enzo_float *x=0, *y=0, *z=0;
-        enzo_float *vx=0, *vy=0, *vz=0;
-        enzo_float *ax=0, *ay=0, *az=0;
+      // interleaved attributes aren't contiguous, so they keep the
+      // strided loop
 
-        if (rank >= 1) {
-      	  x  = (enzo_float *) particle.attribute_array (it, ia_x,  ib);
-      	  vx = (enzo_float *) particle.attribute_array (it, ia_vx, ib);
-      	  ax = (enzo_float *) particle.attribute_array (it, ia_ax, ib);
-        }
-        if (rank >= 2) {
-      	  y  = (enzo_float *) particle.attribute_array (it, ia_y,  ib);
-      	  vy = (enzo_float *) particle.attribute_array (it, ia_vy, ib);
-      	  ay = (enzo_float *) particle.attribute_array (it, ia_ay, ib);
-        }
-        if (rank >= 3) {
-       	  z  = (enzo_float *) particle.attribute_array (it, ia_z,  ib);
-      	  vz = (enzo_float *) particle.attribute_array (it, ia_vz, ib);
-      	  az = (enzo_float *) particle.attribute_array (it, ia_az, ib);
-        }
-
-        const int np = particle.num_particles(it,ib);
+      const bool interleaved = particle.interleaved(it);
 
-        if (rank >= 1) {
-
-	        for (int ip=0; ip<np; ip++) {
-
-	          const int ipdv = ip*dv;
-	          const int ipdp = ip*dp;
-	          const int ipda = ip*da;
-
-#ifdef DEBUG_UPDATE
-      	    v3sum[0]+=std::abs(vx[ipdv]);
-      	    a3sum[0]+=std::abs(ax[ipda]);
-      	    v3sum2[0]+=vx[ipdv]*vx[ipdv];
-      	    a3sum2[0]+=ax[ipda]*ax[ipda];
-      	    CkPrintf ("DEBUG_UPDATE x %g v %g a %g\n",x[ipdp],vx[ipdv],ax[ipda]);
-#endif
-      	    vx[ipdv] = cvv*vx[ipdv] + cva*ax[ipda];
-      	    x [ipdp] += cp*vx[ipdv];
-      	    vx[ipdv] = cvv*vx[ipdv] + cva*ax[ipda];
-
-	        } // ip
-        }
-
-        if (rank >= 2) {
-
-	         for (int ip=0; ip<np; ip++) {
-
-        	   const int ipdv = ip*dv;
-        	   const int ipdp = ip*dp;
-        	   const int ipda = ip*da;
-
-#ifdef DEBUG_UPDATE
-      	     v3sum[1]+=std::abs(vy[ipdv]);
-      	     a3sum[1]+=std::abs(ay[ipda]);
-      	     v3sum2[1]+=vy[ipdv]*vy[ipdv];
-      	     a3sum2[1]+=ay[ipda]*ay[ipda];
-#endif
-             vy[ipdv] = cvv*vy[ipdv] + cva*ay[ipda];
-             y [ipdp] += cp*vy[ipdv];
-             vy[ipdv] = cvv*vy[ipdv] + cva*ay[ipda];
-
-	         } // ip
-        }
+      const int dp = particle.stride(it, ia_x);
+      const int dv = particle.stride(it, ia_vx);
+      const int da = particle.stride(it, ia_ax);
 
-        if (rank >= 3) {
+      for (int ib=0; ib<nb; ib++) {
 
-	        for (int ip=0; ip<np; ip++) {
+        const int np = particle.num_particles(it,ib);
 
-	          const int ipdv = ip*dv;
-	          const int ipdp = ip*dp;
-	          const int ipda = ip*da;
+        for (int axis=0; axis<rank; axis++) {
+
+          if (interleaved) {
+
+            enzo_float * x = (enzo_float *)
+              particle.attribute_array (it, ia_p[axis], ib);
+            enzo_float * v = (enzo_float *)
+              particle.attribute_array (it, ia_v[axis], ib);
+            const enzo_float * a = (const enzo_float *)
+              particle.attribute_array (it, ia_a[axis], ib);
+
+            for (int ip=0; ip<np; ip++) {
+              const int ipdv = ip*dv;
+              const int ipdp = ip*dp;
+              const int ipda = ip*da;
+              v[ipdv] = cvv*v[ipdv] + cva*a[ipda];
+              x[ipdp] += cp*v[ipdv];
+              v[ipdv] = cvv*v[ipdv] + cva*a[ipda];
+            } // ip
+            continue;
+          }
+
+          // attribute arrays are contiguous and aligned, so the
+          // kick-drift-kick update below vectorizes
+
+          enzo_float * x = particle.attribute_span<enzo_float>
+            (it, ia_p[axis], ib).data();
+          enzo_float * v = particle.attribute_span<enzo_float>
+            (it, ia_v[axis], ib).data();
+          const enzo_float * a = particle.attribute_span<enzo_float>
+            (it, ia_a[axis], ib).data();
 
 #ifdef DEBUG_UPDATE
-      	    v3sum[2]+=std::abs(vz[ipdv]);
-      	    a3sum[2]+=std::abs(az[ipda]);
-      	    v3sum2[2]+=vz[ipdv]*vz[ipdv];
-      	    a3sum2[2]+=az[ipda]*az[ipda];
+          for (int ip=0; ip<np; ip++) {
+            v3sum[axis]+=std::abs(v[ip]);
+            a3sum[axis]+=std::abs(a[ip]);
+            v3sum2[axis]+=v[ip]*v[ip];
+            a3sum2[axis]+=a[ip]*a[ip];
+            if (axis == 0)
+              CkPrintf ("DEBUG_UPDATE x %g v %g a %g\n",x[ip],v[ip],a[ip]);
+          }
 #endif
 
-      	    vz[ipdv] = cvv*vz[ipdv] + cva*az[ipda];
-      	    z [ipdp] += cp*vz[ipdv];
-      	    vz[ipdv] = cvv*vz[ipdv] + cva*az[ipda];
-
-	        } // ip
-        } // rank 3
+          #pragma omp simd
+          for (int ip=0; ip<np; ip++) {
+            v[ip] = cvv*v[ip] + cva*a[ip];
+            x[ip] += cp*v[ip];
+            v[ip] = cvv*v[ip] + cva*a[ip];
+          } // ip
+        } // axis
       } // ib loop
     } // end loop over particle types
 
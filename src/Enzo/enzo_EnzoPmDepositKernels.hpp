@@ -0,0 +1,307 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoPmDepositKernels.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Enzo] Templated kernels for depositing mass onto a grid
+///
+/// The particle kernels work directly on the attribute arrays of a particle
+/// batch.  Particles are processed in chunks: the cell indices and weights
+/// of a chunk are first computed along each axis in a loop without
+/// dependencies between particles (so it vectorizes), and the weighted
+/// masses are then added to the grid one particle at a time, in the same
+/// order as the particles.  Since each Block is deposited by a single
+/// process, the scatter has no write conflicts, and the sums are
+/// deterministic.
+///
+/// This file doesn't depend on any other part of Enzo-E or Cello.
+
+#ifndef ENZO_ENZO_PM_DEPOSIT_KERNELS_HPP
+#define ENZO_ENZO_PM_DEPOSIT_KERNELS_HPP
+
+#include <algorithm>
+#include <cmath>
+
+namespace enzo_pm_deposit {
+
+  /// Mass assignment schemes
+  enum class scheme { cic = 0, tsc };
+
+  /// Number of particles whose weights are computed at a time
+  const int chunk_size = 256;
+
+  //----------------------------------------------------------------------
+
+  /// Number of cells along each axis that a particle deposits mass into,
+  /// and the weights of those cells.  `t` is the particle position along
+  /// the axis in units of the cell width, measured from the lower edge of
+  /// the active zone.  `i` is set to the index of the first cell of the
+  /// stencil (relative to the first active cell), and `w[k*stride]` to the
+  /// weight of cell `i + k`.
+  template <scheme S> struct Stencil;
+
+  template <> struct Stencil<scheme::cic> {
+    static const int width = 2;
+    static inline void weights (double t, int * i, double * w, int stride)
+    {
+      const double tx = t - 0.5;
+      const double fx = std::floor(tx);
+      const double w0 = 1.0 - (tx - fx);
+      *i = int(fx);
+      w[0]      = w0;
+      w[stride] = 1.0 - w0;
+    }
+  };
+
+  template <> struct Stencil<scheme::tsc> {
+    static const int width = 3;
+    static inline void weights (double t, int * i, double * w, int stride)
+    {
+      const double fx = std::floor(t);
+      // distance from the center of the nearest cell
+      const double d = t - fx - 0.5;
+      *i = int(fx) - 1;
+      w[0]        = 0.5*(0.5 - d)*(0.5 - d);
+      w[stride]   = 0.75 - d*d;
+      w[2*stride] = 0.5*(0.5 + d)*(0.5 + d);
+    }
+  };
+
+  //----------------------------------------------------------------------
+
+  /// Geometry of the grid that mass is deposited onto
+  struct Grid {
+    /// number of dimensions
+    int rank;
+    /// array dimensions, including ghost zones
+    int m[3];
+    /// ghost zone depth
+    int g[3];
+    /// number of active cells
+    int n[3];
+    /// lower extent of the active zone
+    double lower[3];
+    /// width of the active zone
+    double width[3];
+  };
+
+  /// Attribute arrays of a batch of particles
+  template <typename T>
+  struct Batch {
+    /// number of particles
+    int np;
+    /// positions and velocities (only the first `rank` are used)
+    const T * x[3];
+    const T * v[3];
+    /// stride of the position and velocity arrays: 1 unless the particle
+    /// type is interleaved
+    int dx;
+    /// particle masses, or a pointer to the mass of all particles if
+    /// `dm` is 0
+    const T * mass;
+    int dm;
+  };
+
+  //----------------------------------------------------------------------
+
+  /// Set the index of the first stencil cell of a particle at position
+  /// `xp` along an axis (including the ghost zone depth `g`), and the
+  /// weights `w[k*chunk_size]` of the stencil cells
+  template <scheme S>
+  inline void cell_weights_ (double xp, double na, double lower,
+                             double width, int g, int * c, double * w)
+  {
+    const double t = na*(xp - lower) / width;
+    int i;
+    Stencil<S>::weights (t, &i, w, chunk_size);
+    *c = g + i;
+  }
+
+  //----------------------------------------------------------------------
+
+  /// Add the mass density of a batch of particles, after drifting them by
+  /// `dt` (`x += v*dt`), to the `density` array.  The mass is multiplied
+  /// by `inv_vol` to get the density.  The stencil of each particle must
+  /// lie inside the array, including ghost zones.
+  template <scheme S, typename T>
+  void deposit_particles (T * density, const Grid & grid,
+                          const Batch<T> & batch, double dt, double inv_vol)
+  {
+    const int W = Stencil<S>::width;
+    const int rank = grid.rank;
+    const int mx = grid.m[0];
+    const int my = grid.m[1];
+
+    // stencil width along each axis: axes beyond rank have a single cell
+    // with weight 1, which leaves the products below unchanged
+    const int wx = W;
+    const int wy = (rank >= 2) ? W : 1;
+    const int wz = (rank >= 3) ? W : 1;
+
+    int    cell[3][chunk_size];
+    double weight[3][W][chunk_size];
+    T      pdens[chunk_size];
+
+    for (int i0 = 0; i0 < batch.np; i0 += chunk_size) {
+
+      const int n = std::min(chunk_size, batch.np - i0);
+
+      // compute cell indices and weights along each axis
+
+      for (int axis = 0; axis < 3; axis++) {
+        int    * ci = cell[axis];
+        double * wi = weight[axis][0];
+        if (axis < rank) {
+          const int dx = batch.dx;
+          const T * x = batch.x[axis] + i0*dx;
+          const T * v = batch.v[axis] + i0*dx;
+          const double na    = grid.n[axis];
+          const double lower = grid.lower[axis];
+          const double width = grid.width[axis];
+          const int    g     = grid.g[axis];
+          if (dx == 1) {
+#pragma omp simd
+            for (int ip = 0; ip < n; ip++) {
+              cell_weights_<S> (x[ip] + v[ip]*dt, na, lower, width, g,
+                                ci + ip, wi + ip);
+            }
+          } else {
+            // interleaved attributes
+            for (int ip = 0; ip < n; ip++) {
+              cell_weights_<S> (x[ip*dx] + v[ip*dx]*dt, na, lower, width, g,
+                                ci + ip, wi + ip);
+            }
+          }
+        } else {
+          for (int ip = 0; ip < n; ip++) {
+            ci[ip] = 0;
+            wi[ip] = 1.0;
+          }
+        }
+      }
+
+      const T * mass = batch.mass + i0*batch.dm;
+      const int dm = batch.dm;
+#pragma omp simd
+      for (int ip = 0; ip < n; ip++) {
+        pdens[ip] = mass[ip*dm] * inv_vol;
+      }
+
+      // add weighted densities to the grid in particle order
+
+      for (int ip = 0; ip < n; ip++) {
+        T * d = density + cell[0][ip] + mx*(cell[1][ip] + my*cell[2][ip]);
+        const T p = pdens[ip];
+        for (int kz = 0; kz < wz; kz++) {
+          const double fz = weight[2][kz][ip];
+          for (int ky = 0; ky < wy; ky++) {
+            const double fy = weight[1][ky][ip];
+            T * dk = d + mx*(ky + my*kz);
+            for (int kx = 0; kx < wx; kx++) {
+              dk[kx] += p * weight[0][kx][ip] * fy * fz;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  //----------------------------------------------------------------------
+
+  /// Add the gas density, moved by the velocity field over a time `dt`, to
+  /// the active zone of `density_total` (which has the same dimensions as
+  /// `density`).  The mass in each active cell is moved by `v*dt/h` cells
+  /// and distributed with CIC weights over the two nearest cell centers
+  /// along each axis.  Destinations are clamped to the active zone, so no
+  /// mass is lost.  When `dt` is 0 the density is simply added.
+  ///
+  /// `scratch` must hold at least (nx+1)*(ny+1)*(nz+1) values.
+  template <typename T>
+  void deposit_gas (T * density_total, const T * density,
+                    const T * const velocity[3], const Grid & grid,
+                    T dt, const T h[3], T * scratch)
+  {
+    const int rank = grid.rank;
+    const int mx = grid.m[0], my = grid.m[1];
+    const int gx = grid.g[0], gy = grid.g[1], gz = grid.g[2];
+    const int nx = grid.n[0], ny = grid.n[1], nz = grid.n[2];
+
+    if (dt == 0.0) {
+      for (int iz = 0; iz < nz; iz++) {
+        for (int iy = 0; iy < ny; iy++) {
+          const int i = gx + mx*((iy + gy) + my*(iz + gz));
+          T * dt_i = density_total + i;
+          const T * d_i = density + i;
+#pragma omp simd
+          for (int ix = 0; ix < nx; ix++) {
+            dt_i[ix] += d_i[ix];
+          }
+        }
+      }
+      return;
+    }
+
+    // the scratch array has one extra cell along each axis to receive the
+    // (zero) weights past the upper edge of the active zone
+    const int sx = nx + 1;
+    const int sy = (rank >= 2) ? ny + 1 : 1;
+    const int sz = (rank >= 3) ? nz + 1 : 1;
+    std::fill_n (scratch, sx*sy*sz, T(0));
+
+    const T tiny = 1e-20;
+    const int n[3] = {nx, ny, nz};
+    T coef[3];
+    for (int axis = 0; axis < 3; axis++) {
+      coef[axis] = (axis < rank) ? dt / h[axis] : T(0);
+    }
+
+    for (int iz = 0; iz < nz; iz++) {
+      for (int iy = 0; iy < ny; iy++) {
+        for (int ix = 0; ix < nx; ix++) {
+          const int i = (ix + gx) + mx*((iy + gy) + my*(iz + gz));
+          const T mass = density[i];
+          const int c[3] = {ix, iy, iz};
+          int i1[3] = {0, 0, 0};
+          T w0[3] = {1, 1, 1};
+          T w1[3] = {0, 0, 0};
+          for (int axis = 0; axis < rank; axis++) {
+            const T shift =
+              velocity[axis][i]*mass / std::max(mass, tiny) * coef[axis];
+            // position in cell units relative to the first cell center
+            const T p = std::min(std::max(c[axis] + shift, T(0)),
+                                 T(n[axis] - 1));
+            i1[axis] = int(p);
+            w0[axis] = T(i1[axis] + 1) - p;
+            w1[axis] = T(1) - w0[axis];
+          }
+          T * s = scratch + i1[0] + sx*(i1[1] + sy*i1[2]);
+          s[0]             += mass*w0[0]*w0[1]*w0[2];
+          s[1]             += mass*w1[0]*w0[1]*w0[2];
+          if (rank >= 2) {
+            s[sx]          += mass*w0[0]*w1[1]*w0[2];
+            s[1+sx]        += mass*w1[0]*w1[1]*w0[2];
+          }
+          if (rank >= 3) {
+            s[sx*sy]       += mass*w0[0]*w0[1]*w1[2];
+            s[1+sx*sy]     += mass*w1[0]*w0[1]*w1[2];
+            s[sx+sx*sy]    += mass*w0[0]*w1[1]*w1[2];
+            s[1+sx+sx*sy]  += mass*w1[0]*w1[1]*w1[2];
+          }
+        }
+      }
+    }
+
+    for (int iz = 0; iz < nz; iz++) {
+      for (int iy = 0; iy < ny; iy++) {
+        T * dt_i = density_total + gx + mx*((iy + gy) + my*(iz + gz));
+        const T * s_i = scratch + sx*(iy + sy*iz);
+        for (int ix = 0; ix < nx; ix++) {
+          dt_i[ix] += s_i[ix];
+        }
+      }
+    }
+  }
+
+}
+
+#endif /* ENZO_ENZO_PM_DEPOSIT_KERNELS_HPP */
@@ -100,6 +100,8 @@ Initial * EnzoProblem::create_initial_
        enzo_config->initial_hdf5_format,
        enzo_config->initial_hdf5_blocking,
        enzo_config->initial_hdf5_monitor_iter,
+       enzo_config->initial_hdf5_read_mode,
+       enzo_config->initial_hdf5_slab_depth,
        enzo_config->initial_hdf5_field_files,
        enzo_config->initial_hdf5_field_datasets,
        enzo_config->initial_hdf5_field_coords,
@@ -418,7 +420,9 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_max_level[index_solver],
        enzo_config->solver_iter_max[index_solver],
        enzo_config->solver_res_tol[index_solver],
-       enzo_config->solver_precondition[index_solver]);
+       enzo_config->solver_precondition[index_solver],
+       enzo_config->solver_pipelined[index_solver],
+       enzo_config->solver_batch_size[index_solver]);
 
   } else if (solver_type == "dd") {
 
@@ -503,6 +507,27 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_last_smooth[index_solver],
        enzo_config->solver_coarse_level[index_solver]);
 
+  } else if (solver_type == "mg_amr") {
+
+    solver = new EnzoSolverMgAmr
+      (enzo_config->solver_list[index_solver],
+       enzo_config->solver_field_x[index_solver],
+       enzo_config->solver_field_b[index_solver],
+       enzo_config->solver_monitor_iter[index_solver],
+       enzo_config->solver_restart_cycle[index_solver],
+       solve_type,
+       index_prolong,
+       index_restrict,
+       enzo_config->solver_min_level[index_solver],
+       enzo_config->solver_max_level[index_solver],
+       enzo_config->solver_iter_max[index_solver],
+       enzo_config->solver_res_tol[index_solver],
+       enzo_config->solver_coarse_solve[index_solver],
+       enzo_config->solver_coarse_level[index_solver],
+       enzo_config->solver_weight[index_solver],
+       enzo_config->solver_num_pre_smooth[index_solver],
+       enzo_config->solver_num_post_smooth[index_solver]);
+
   } else {
     // Not an Enzo Solver--try base class Cello Solver
     solver = Problem::create_solver_ (solver_type, index_solver,config);
@@ -617,7 +642,8 @@ Method * EnzoProblem::create_method_
 
   } else if (name == "pm_deposit") {
 
-    method = new EnzoMethodPmDeposit (enzo_config->method_pm_deposit_alpha);
+    method = new EnzoMethodPmDeposit (enzo_config->method_pm_deposit_alpha,
+                                      enzo_config->method_pm_deposit_scheme);
 
   } else if (name == "pm_update") {
 
@@ -683,7 +709,9 @@ Method * EnzoProblem::create_method_
        enzo_config->method_gravity_order,
        enzo_config->method_gravity_accumulate,
        index_prolong,
-       enzo_config->method_gravity_dt_max);
+       enzo_config->method_gravity_dt_max,
+       enzo_config->method_gravity_batch_density,
+       enzo_config->method_gravity_batch_potential);
 
   } else if (name == "mhd_vlct") {
 
@@ -693,7 +721,9 @@ Method * EnzoProblem::create_method_
        enzo_config->method_vlct_full_dt_reconstruct_method,
        enzo_config->method_vlct_theta_limiter,
        enzo_config->method_vlct_mhd_choice,
-       store_fluxes_for_corrections);
+       store_fluxes_for_corrections,
+       enzo_config->method_vlct_tile_size,
+       enzo_config->method_vlct_riemann_simd);
 
   } else if (name == "background_acceleration") {
 
@@ -742,7 +772,8 @@ Method * EnzoProblem::create_method_
       (enzo_config->method_check_num_files,
        enzo_config->method_check_ordering,
        enzo_config->method_check_dir,
-       enzo_config->method_check_monitor_iter);
+       enzo_config->method_check_monitor_iter,
+       enzo_config->method_check_window);
 
   } else if (name == "merge_sinks") {
 
@@ -37,7 +37,8 @@ EnzoSimulation::EnzoSimulation
     check_num_files_(0),
     check_ordering_(""),
     check_directory_(),
-    restart_level_(0)
+    restart_level_(0),
+    restart_timer_()
 {
 #ifdef CHECK_MEMORY
   mtrace();
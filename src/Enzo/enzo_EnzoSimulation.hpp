@@ -95,6 +95,9 @@ private: // attributes
 
   /// Current restart level
   int restart_level_; 
+
+  /// Time spent restarting the current level
+  Timer restart_timer_;
 #ifdef BYPASS_CHARM_MEM_LEAK
   std::map<Index,EnzoMsgCheck *> msg_check_map_;
 #endif
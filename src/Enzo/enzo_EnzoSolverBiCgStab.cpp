@@ -971,61 +971,49 @@ void EnzoSolverBiCgStab::loop_4(EnzoBlock* block) throw() {
   COPY_FIELD(block,"loop_4",iy_,"Y1_bcg");
   COPY_FIELD(block,"loop_4",iv_,"V1_bcg");
   
-  if (is_finest_(block)) {
-
-    /// LINE 05: V = A * Y
-    
-    A_->matvec(iv_, iy_, block);
-
-  }
-
-  COPY_FIELD(block,"loop_4",iv_,"V1_bcg");
-  /// compute local contributions to vr0_ = DOT(V, R0)
-  
   std::vector<long double> reduce;
   reduce.resize(3+1);
   reduce.clear();
   reduce[0] = 3;
   
   if (is_finest_(block)) {
-    
-    enzo_float* R0 = (enzo_float*) field.values(ir0_);
-    enzo_float* V  = (enzo_float*) field.values(iv_);
 
+    /// LINE 05: V = A * Y
     /// LINE 07 [part]  vr0_ = V*R0
-    
-    for (int iz=gz_; iz<mz_-gz_; iz++) {
-      for (int iy=gy_; iy<my_-gy_; iy++) {
-	for (int ix=gx_; ix<mx_-gx_; ix++) {
-	  int i = ix + mx_*(iy + my_*iz);
-	  reduce[1] += V[i]*R0[i];
-	}
-      }
-    }
-    
+    /// vs_ = sum (V[i]) if singular
+    ///
+    /// compute local contributions in the same sweep as the matvec
+
+    const int iv_dot[2] = { ir0_, -1 };
+    long double dot[2] = { 0.0, 0.0 };
+
+    A_->matvec_dot(iv_, iy_, block, is_singular_() ? 2 : 1, iv_dot, dot);
+
+    reduce[1] += dot[0];
+    reduce[3] += dot[1];
+
     /// for singular Poisson problems need all vectors in R(A), so
     /// project both Y and V into R(A)
 
     if (is_singular_()) {
 
       enzo_float* Y = (enzo_float*) field.values(iy_);
-      enzo_float* V = (enzo_float*) field.values(iv_);
 
       /// ys_ = sum (Y[i])
-      /// vs_ = sum (V[i])
       
       for (int iz=gz_; iz<mz_-gz_; iz++) {
 	for (int iy=gy_; iy<my_-gy_; iy++) {
 	  for (int ix=gx_; ix<mx_-gx_; ix++) {
 	    int i = ix + mx_*(iy + my_*iz);
 	    reduce[2] += Y[i];
-	    reduce[3] += V[i];
 	  }
 	}
       }
     }
   }
 
+  COPY_FIELD(block,"loop_4",iv_,"V1_bcg");
+
   /// contribute to global sums over blocks, and return
   /// r_solver_bicgstab_loop_5()
 
@@ -1270,61 +1258,52 @@ void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
   COPY_FIELD(block,"loop_10",iq_,"Q2_bcg");
   COPY_FIELD(block,"loop_10",iy_,"Y2_bcg");
 
-  if (is_finest_(block)) {
-
-    /// LINE 11:     U = A * Y
-    
-    A_->matvec(iu_, iy_, block);     /// apply matrix to local block
-
-  }
-
-  COPY_FIELD(block,"loop_10",iu_,"U");
-
   std::vector<long double> reduce;
   reduce.resize(5+1);
   reduce.clear();
   reduce[0] = 5;
   
   if (is_finest_(block)) {
-    
-    enzo_float* U  = (enzo_float*) field.values(iu_);
-    enzo_float* Q  = (enzo_float*) field.values(iq_);
-    
+
+    /// LINE 11:     U = A * Y
+    ///
     /// omega_n = DOT(U, Q)
     /// omega_d = DOT(U, U)
-  
-    for (int iz=gz_; iz<mz_-gz_; iz++) {
-      for (int iy=gy_; iy<my_-gy_; iy++) {
-	for (int ix=gx_; ix<mx_-gx_; ix++) {
-	  int i = ix + mx_*(iy + my_*iz);
-	  reduce[1] += U[i]*Q[i];
-	  reduce[2] += U[i]*U[i];
-	}
-      }
-    }
-  
+    /// us_ = SUM(U) if singular
+    ///
+    /// compute local contributions in the same sweep as the matvec
+
+    const int iu_dot[3] = { iq_, iu_, -1 };
+    long double dot[3] = { 0.0, 0.0, 0.0 };
+
+    A_->matvec_dot(iu_, iy_, block, is_singular_() ? 3 : 2, iu_dot, dot);
+
+    reduce[1] += dot[0];
+    reduce[2] += dot[1];
+    reduce[4] += dot[2];
+
     /// for singular Poisson problems, project both Y and U into R(A)
 
     if (is_singular_()) {
 
       enzo_float* Y = (enzo_float*) field.values(iy_);
-      enzo_float* U = (enzo_float*) field.values(iu_);
+      enzo_float* Q = (enzo_float*) field.values(iq_);
 
       /// ys_ = SUM(Y)
-      /// us_ = SUM(U)
 
       for (int iz=gz_; iz<mz_-gz_; iz++) {
 	for (int iy=gy_; iy<my_-gy_; iy++) {
 	  for (int ix=gx_; ix<mx_-gx_; ix++) {
 	    int i = ix + mx_*(iy + my_*iz);
 	    reduce[3] += Y[i];
-	    reduce[4] += U[i];
 	    reduce[5] += Q[i];
 	  }
 	}
       }
     }
   }
+
+  COPY_FIELD(block,"loop_10",iu_,"U");
   
   /// compute sums over Blocks and continue with r_solver_bicgstab_loop_11()
 
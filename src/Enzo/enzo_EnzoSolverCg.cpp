@@ -53,7 +53,9 @@ EnzoSolverCg::EnzoSolverCg
  int index_restrict,
  int min_level, int max_level,
  int iter_max, double res_tol,
- int index_precon
+ int index_precon,
+ bool pipelined,
+ int batch_size
  )
   : Solver(name,
 	   field_x,
@@ -80,7 +82,18 @@ EnzoSolverCg::EnzoSolverCg
     bc_(0.0),
     local_(solve_type==solve_block),
     ir_matvec_(-1),
-    ir_loop_2_(-1)
+    ir_loop_2_(-1),
+    pipelined_(pipelined && solve_type!=solve_block),
+    iw_(-1), iv_(-1),
+    ir_pipe_start_(-1),
+    ir_pipe_even_(-1), ir_pipe_odd_(-1),
+    is_pipe_sync_(-1), is_pipe_iter_(-1),
+    is_pipe_alpha_(-1), is_pipe_gamma_(-1),
+    batch_size_((pipelined_ || local_) ? 1 : std::max(batch_size,1)),
+    num_rhs_(1),
+    ir_list_(), id_list_(), iy_list_(),
+    ir_batch_loop_(-1),
+    is_batch_iter_(-1), is_batch_rr_(-1), is_batch_rr0_(-1)
 
 {
   FieldDescr * field_descr = cello::field_descr();
@@ -124,6 +137,70 @@ EnzoSolverCg::EnzoSolverCg
     refresh_loop_2->set_callback(CkIndex_EnzoBlock::p_solver_cg_loop_2());
 
   }
+
+  if (pipelined_) {
+
+    iw_ = field_descr->insert_temporary();
+    iv_ = field_descr->insert_temporary();
+
+    ir_pipe_start_ = add_refresh_();
+    cello::simulation()->refresh_set_name(ir_pipe_start_,name+":pipe_start");
+    cello::refresh(ir_pipe_start_)->add_field (ir_);
+    cello::refresh(ir_pipe_start_)->set_callback
+      (CkIndex_EnzoBlock::p_solver_cg_pipe_start());
+
+    ir_pipe_even_ = add_refresh_();
+    cello::simulation()->refresh_set_name(ir_pipe_even_,name+":pipe_even");
+    cello::refresh(ir_pipe_even_)->add_field (iw_);
+    cello::refresh(ir_pipe_even_)->set_callback
+      (CkIndex_EnzoBlock::p_solver_cg_pipe_matvec());
+
+    ir_pipe_odd_ = add_refresh_();
+    cello::simulation()->refresh_set_name(ir_pipe_odd_,name+":pipe_odd");
+    cello::refresh(ir_pipe_odd_)->add_field (iw_);
+    cello::refresh(ir_pipe_odd_)->set_callback
+      (CkIndex_EnzoBlock::p_solver_cg_pipe_matvec());
+
+    ScalarDescr * scalar_descr_sync = cello::scalar_descr_sync();
+    ScalarDescr * scalar_descr_int  = cello::scalar_descr_int();
+    ScalarDescr * scalar_descr_quad = cello::scalar_descr_long_double();
+
+    is_pipe_sync_  = scalar_descr_sync->new_value(name + ":pipe_sync");
+    is_pipe_iter_  = scalar_descr_int-> new_value(name + ":pipe_iter");
+    is_pipe_alpha_ = scalar_descr_quad->new_value(name + ":pipe_alpha");
+    is_pipe_gamma_ = scalar_descr_quad->new_value(name + ":pipe_gamma");
+  }
+
+  if (batch_size_ > 1) {
+
+    // Batched CG: one refresh updates D[k] for all systems
+
+    ir_list_.push_back(ir_);
+    id_list_.push_back(id_);
+    iy_list_.push_back(iy_);
+    for (int k=1; k<batch_size_; k++) {
+      ir_list_.push_back(field_descr->insert_temporary());
+      id_list_.push_back(field_descr->insert_temporary());
+      iy_list_.push_back(field_descr->insert_temporary());
+    }
+
+    ir_batch_loop_ = add_refresh_();
+    cello::simulation()->refresh_set_name(ir_batch_loop_,name+":batch_loop");
+    Refresh * refresh_batch = cello::refresh(ir_batch_loop_);
+    for (int k=0; k<batch_size_; k++) {
+      refresh_batch->add_field (id_list_[k]);
+    }
+    refresh_batch->set_callback(CkIndex_EnzoBlock::p_solver_cg_batch_matvec());
+
+    ScalarDescr * scalar_descr_int  = cello::scalar_descr_int();
+    ScalarDescr * scalar_descr_quad = cello::scalar_descr_long_double();
+
+    is_batch_iter_ = scalar_descr_int-> new_value(name + ":batch_iter");
+    is_batch_rr_   = scalar_descr_quad->new_value(name + ":batch_rr",
+                                                  batch_size_);
+    is_batch_rr0_  = scalar_descr_quad->new_value(name + ":batch_rr0",
+                                                  batch_size_);
+  }
 }
 
 //----------------------------------------------------------------------
@@ -173,6 +250,27 @@ void EnzoSolverCg::pup (PUP::er &p)
   p | ir_matvec_;
   p | ir_loop_2_;
 
+  p | pipelined_;
+  p | iw_;
+  p | iv_;
+  p | ir_pipe_start_;
+  p | ir_pipe_even_;
+  p | ir_pipe_odd_;
+  p | is_pipe_sync_;
+  p | is_pipe_iter_;
+  p | is_pipe_alpha_;
+  p | is_pipe_gamma_;
+
+  p | batch_size_;
+  p | num_rhs_;
+  p | ir_list_;
+  p | id_list_;
+  p | iy_list_;
+  p | ir_batch_loop_;
+  p | is_batch_iter_;
+  p | is_batch_rr_;
+  p | is_batch_rr0_;
+
 }
 
 //======================================================================
@@ -183,6 +281,13 @@ void EnzoSolverCg::apply ( std::shared_ptr<Matrix> A, Block * block) throw()
 
   A_ = A;
 
+  num_rhs_ = 1 + ib_batch_.size();
+
+  ASSERT3 ("EnzoSolverCg::apply()",
+           "Solver %s given %d right-hand sides but batch_size is %d",
+           name_.c_str(),num_rhs_,batch_size_,
+           num_rhs_ <= batch_size_);
+
   Field field = block->data()->field();
 
   allocate_temporary_(field,block);
@@ -217,6 +322,54 @@ void EnzoSolverCg::compute_ (EnzoBlock * enzo_block) throw()
 
   iter_ = 0;
 
+  if (num_rhs_ > 1) {
+    batch_start_(enzo_block);
+    return;
+  }
+
+  if (pipelined_) {
+
+    // Pipelined CG: X = 0, R = B, and reduce SUM(B) for the singular
+    // shift, as in the standard iteration below
+
+    s_pipe_iter_(enzo_block) = 0;
+    s_pipe_sync_(enzo_block).set_stop(2); // fused reduction and matvec
+
+    Field field = enzo_block->data()->field();
+
+    long double reduce[3] = {0.0, 0.0, 0.0};
+
+    if (is_finest_(enzo_block)) {
+
+      enzo_float * X = (enzo_float*) field.values(ix_);
+      enzo_float * B = (enzo_float*) field.values(ib_);
+      enzo_float * R = (enzo_float*) field.values(ir_);
+
+      for (int i=0; i<mx_*my_*mz_; i++) {
+        X[i] = 0.0;
+        R[i] = B[i];
+      }
+
+      for (int iz=gz_; iz<mz_-gz_; iz++) {
+        for (int iy=gy_; iy<my_-gy_; iy++) {
+          for (int ix=gx_; ix<mx_-gx_; ix++) {
+            int i = ix + mx_*(iy + my_*iz);
+            reduce[1] += B[i];
+          }
+        }
+      }
+      reduce[2] = nx_*ny_*nz_;
+    }
+
+    CkCallback callback(CkIndex_EnzoBlock::r_solver_cg_pipe_0(NULL),
+                        enzo_block->proxy_array());
+
+    enzo_block->contribute (3*sizeof(long double), &reduce,
+                            sum_long_double_3_type,
+                            callback);
+    return;
+  }
+
   Field field = enzo_block->data()->field();
 
   enzo_float * X = (enzo_float*) field.values(ix_);
@@ -497,18 +650,14 @@ void EnzoSolverCg::loop_2b (EnzoBlock * enzo_block) throw()
     Data * data = enzo_block->data();
     Field field = data->field();
 
-    if (is_finest_(enzo_block)) {
-
-      A_->matvec(iy_,id_,enzo_block);
-
-    }
-
     long double reduce[3] = {0.0, 0.0, 0.0};
 
     if (is_finest_(enzo_block)) {
 
-      enzo_float * D = (enzo_float*) field.values(id_);
-      enzo_float * Y = (enzo_float*) field.values(iy_);
+      // Y = A*D and DOT(D,Y) in one sweep
+
+      A_->matvec_dot(iy_,id_,enzo_block,1,&id_,&reduce[2]);
+
       enzo_float * R = (enzo_float*) field.values(ir_);
       enzo_float * Z = (enzo_float*) field.values(iz_);
 
@@ -518,7 +667,6 @@ void EnzoSolverCg::loop_2b (EnzoBlock * enzo_block) throw()
 	    int i = ix + mx_*(iy + my_*iz);
 	    reduce[0] += R[i]*R[i];
 	    reduce[1] += R[i]*Z[i];
-	    reduce[2] += D[i]*Y[i];
 	  }
 	}
       }
@@ -721,6 +869,719 @@ void EnzoSolverCg::loop_6 (EnzoBlock * enzo_block) throw ()
 			  CkReduction::max_int, callback);
 }
 
+//======================================================================
+// Pipelined CG
+//
+// Ghysels and Vanroose (2014) pipelined CG.  The two dot products
+// DOT(R,R) and DOT(W,R) (and the singular shift sums) are combined
+// into a single reduction per iteration, and the reduction is in
+// flight while W is refreshed and the matvec Y = A*W is applied.
+// The vector update waits for both the reduction and the matvec:
+//
+//     R = B - A*X,  W = A*R
+//     loop
+//        gamma = DOT(R,R), delta = DOT(W,R)  (non-blocking)
+//        Y = A*W                             (overlapped)
+//        beta  = gamma / gamma_old
+//        alpha = gamma / (delta - beta*gamma/alpha_old)
+//        Z = Y + beta*Z    (Z == A*V)
+//        V = W + beta*V    (V == A*D)
+//        D = R + beta*D
+//        X = X + alpha*D
+//        R = R - alpha*V
+//        W = W - alpha*Z
+//
+// Scalars carried between iterations are stored per Block, since
+// Blocks on the same process may be in different iterations.
+//----------------------------------------------------------------------
+
+void EnzoBlock::r_solver_cg_pipe_0 (CkReductionMsg * msg)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  EnzoSolverCg * solver =
+    static_cast<EnzoSolverCg*> (this->solver());
+
+  solver->pipe_0(this,msg);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::pipe_0
+(EnzoBlock * enzo_block, CkReductionMsg * msg) throw ()
+{
+  long double * data = (long double *) msg->getData();
+
+  bs_ = data[1];
+  bc_ = data[2];
+
+  delete msg;
+
+  if (is_finest_(enzo_block)) {
+
+    Field field = enzo_block->data()->field();
+
+    enzo_float * B = (enzo_float*) field.values(ib_);
+    enzo_float * R = (enzo_float*) field.values(ir_);
+    enzo_float * D = (enzo_float*) field.values(id_);
+    enzo_float * V = (enzo_float*) field.values(iv_);
+    enzo_float * W = (enzo_float*) field.values(iw_);
+    enzo_float * Y = (enzo_float*) field.values(iy_);
+    enzo_float * Z = (enzo_float*) field.values(iz_);
+
+    if (A_->is_singular())  {
+
+      // shift rhs B by projection of B onto e: B~ <== B - (e*eT)/(eT*e) b
+
+      cello::check(bs_,"CG::bs_",__FILE__,__LINE__);
+      cello::check(bc_,"CG::bc_",__FILE__,__LINE__);
+
+      long double shift = -bs_ / bc_;
+      for (int i=0; i<mx_*my_*mz_; i++) {
+        R[i] += shift;
+        B[i] += shift;
+      }
+    }
+
+    // clear recurrence vectors, including ghost zones not written
+    // by matvec
+
+    for (int i=0; i<mx_*my_*mz_; i++) {
+      D[i] = 0.0;
+      V[i] = 0.0;
+      W[i] = 0.0;
+      Y[i] = 0.0;
+      Z[i] = 0.0;
+    }
+  }
+
+  // Refresh R then compute W = A*R
+
+  Refresh * refresh = cello::refresh(ir_pipe_start_);
+
+  refresh->set_active(is_finest_(enzo_block));
+
+  enzo_block->refresh_start
+    (ir_pipe_start_, CkIndex_EnzoBlock::p_solver_cg_pipe_start());
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_cg_pipe_start ()
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  EnzoSolverCg * solver =
+    static_cast<EnzoSolverCg*> (this->solver());
+
+  solver->pipe_start(this);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::pipe_start (EnzoBlock * enzo_block) throw ()
+{
+  if (is_finest_(enzo_block)) {
+
+    A_->matvec(iw_,ir_,enzo_block);
+
+  }
+
+  pipe_loop_(enzo_block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::pipe_loop_ (EnzoBlock * enzo_block) throw ()
+{
+  // Fused reduction: [n, DOT(R,R), DOT(W,R), SUM(R), SUM(X)]
+
+  long double reduce[5] = {4.0, 0.0, 0.0, 0.0, 0.0};
+
+  if (is_finest_(enzo_block)) {
+
+    Field field = enzo_block->data()->field();
+
+    enzo_float * X = (enzo_float*) field.values(ix_);
+    enzo_float * R = (enzo_float*) field.values(ir_);
+    enzo_float * W = (enzo_float*) field.values(iw_);
+
+    for (int iz=gz_; iz<mz_-gz_; iz++) {
+      for (int iy=gy_; iy<my_-gy_; iy++) {
+        for (int ix=gx_; ix<mx_-gx_; ix++) {
+          int i = ix + mx_*(iy + my_*iz);
+          reduce[1] += R[i]*R[i];
+          reduce[2] += W[i]*R[i];
+          reduce[3] += R[i];
+          reduce[4] += X[i];
+        }
+      }
+    }
+  }
+
+  CkCallback callback(CkIndex_EnzoBlock::r_solver_cg_pipe_reduce(NULL),
+                      enzo_block->proxy_array());
+
+  enzo_block->contribute (5*sizeof(long double), reduce,
+                          sum_long_double_n_type,
+                          callback);
+
+  // Overlap the reduction with refreshing W and Y = A*W
+
+  const int ir = (s_pipe_iter_(enzo_block) % 2 == 0) ?
+    ir_pipe_even_ : ir_pipe_odd_;
+
+  Refresh * refresh = cello::refresh(ir);
+
+  refresh->set_active(is_finest_(enzo_block));
+
+  enzo_block->refresh_start
+    (ir, CkIndex_EnzoBlock::p_solver_cg_pipe_matvec());
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_cg_pipe_matvec ()
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  EnzoSolverCg * solver =
+    static_cast<EnzoSolverCg*> (this->solver());
+
+  solver->pipe_matvec(this);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::pipe_matvec (EnzoBlock * enzo_block) throw ()
+{
+  if (is_finest_(enzo_block)) {
+
+    A_->matvec(iy_,iw_,enzo_block);
+
+  }
+
+  if (s_pipe_sync_(enzo_block).next()) pipe_update_(enzo_block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::r_solver_cg_pipe_reduce (CkReductionMsg * msg)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  EnzoSolverCg * solver =
+    static_cast<EnzoSolverCg*> (this->solver());
+
+  solver->pipe_reduce(this,msg);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::pipe_reduce
+(EnzoBlock * enzo_block, CkReductionMsg * msg) throw ()
+{
+  long double * data = (long double *) msg->getData();
+
+  // Safe to store in the solver: the next reduction cannot complete
+  // until every Block has finished its update for this iteration
+
+  rr_ = data[1];
+  dy_ = data[2];
+  rs_ = data[3];
+  xs_ = data[4];
+
+  delete msg;
+
+  if (s_pipe_sync_(enzo_block).next()) pipe_update_(enzo_block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::pipe_update_ (EnzoBlock * enzo_block) throw ()
+{
+  int & iter = s_pipe_iter_(enzo_block);
+
+  iter_ = iter;
+
+  if (iter_ == 0) {
+    rr0_ = rr_;
+    rr_min_ = rr_;
+    rr_max_ = rr_;
+  } else {
+    rr_min_ = std::min(rr_min_,rr_);
+    rr_max_ = std::max(rr_max_,rr_);
+  }
+
+  if (enzo_block->index().is_root()) monitor_output_(enzo_block);
+
+  const bool is_converged = (rr_ / rr0_ < res_tol_);
+  const bool is_diverged = (iter_ >= iter_max_);
+
+  if (is_converged) {
+
+    end (enzo_block,return_converged);
+
+  } else if (is_diverged)  {
+
+    end (enzo_block,return_error);
+
+  } else {
+
+    long double & alpha_old = s_pipe_alpha_(enzo_block);
+    long double & gamma_old = s_pipe_gamma_(enzo_block);
+
+    const long double gamma = rr_;
+    const long double delta = dy_;
+
+    const long double beta = (iter == 0) ? 0.0 : gamma / gamma_old;
+    const long double alpha = (iter == 0) ?
+      gamma / delta : gamma / (delta - beta*gamma/alpha_old);
+
+    if (is_finest_(enzo_block)) {
+
+      cello::check(rr_,"CG::rr_",__FILE__,__LINE__);
+      cello::check(dy_,"CG::dy_",__FILE__,__LINE__);
+      cello::check(alpha,"CG::a",__FILE__,__LINE__);
+      cello::check(beta,"CG::b",__FILE__,__LINE__);
+
+      Field field = enzo_block->data()->field();
+
+      enzo_float * X = (enzo_float*) field.values(ix_);
+      enzo_float * R = (enzo_float*) field.values(ir_);
+      enzo_float * D = (enzo_float*) field.values(id_);
+      enzo_float * V = (enzo_float*) field.values(iv_);
+      enzo_float * W = (enzo_float*) field.values(iw_);
+      enzo_float * Y = (enzo_float*) field.values(iy_);
+      enzo_float * Z = (enzo_float*) field.values(iz_);
+
+      if (A_->is_singular())  {
+        const enzo_float xs = xs_/bc_;
+        const enzo_float rs = rs_/bc_;
+        for (int i=0; i<mx_*my_*mz_; i++) {
+          X[i] -= xs;
+          R[i] -= rs;
+        }
+      }
+
+      const enzo_float a = alpha;
+      const enzo_float b = beta;
+
+      for (int i=0; i<mx_*my_*mz_; i++) {
+        Z[i] = Y[i] + b * Z[i];
+        V[i] = W[i] + b * V[i];
+        D[i] = R[i] + b * D[i];
+        X[i] += a * D[i];
+        R[i] -= a * V[i];
+        W[i] -= a * Z[i];
+      }
+    }
+
+    alpha_old = alpha;
+    gamma_old = gamma;
+
+    ++iter;
+
+    pipe_loop_(enzo_block);
+  }
+}
+
+//======================================================================
+// Batched CG
+//
+// Solves A*X[k] = B[k] for up to batch_size right-hand sides at once
+// with the same matrix.  Each iteration refreshes all D[k] in a single
+// Refresh and combines the dot products of every system into one
+// reduction per step, so that the number of global reductions and
+// halo exchanges per iteration does not grow with the number of
+// systems.  Systems that have converged are skipped by the updates
+// but still ride along in the (now fixed-size) reductions.  The
+// batched iteration is unpreconditioned (Z == R).
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::batch_start_ (EnzoBlock * enzo_block) throw ()
+{
+  s_batch_iter_(enzo_block) = 0;
+
+  const int n = num_rhs_;
+
+  // [2n+1, DOT(R[k],R[k]), SUM(B[k]), zone count]
+
+  std::vector<long double> reduce (2*n+2, 0.0);
+  reduce[0] = 2*n+1;
+
+  if (is_finest_(enzo_block)) {
+
+    Field field = enzo_block->data()->field();
+
+    for (int k=0; k<n; k++) {
+
+      enzo_float * X = (enzo_float*) field.values(ix_k_(k));
+      enzo_float * B = (enzo_float*) field.values(ib_k_(k));
+      enzo_float * R = (enzo_float*) field.values(ir_list_[k]);
+      enzo_float * D = (enzo_float*) field.values(id_list_[k]);
+      enzo_float * Y = (enzo_float*) field.values(iy_list_[k]);
+
+      for (int i=0; i<mx_*my_*mz_; i++) {
+        X[i] = 0.0;
+        R[i] = B[i];
+        D[i] = B[i];
+        Y[i] = 0.0;
+      }
+
+      for (int iz=gz_; iz<mz_-gz_; iz++) {
+        for (int iy=gy_; iy<my_-gy_; iy++) {
+          for (int ix=gx_; ix<mx_-gx_; ix++) {
+            int i = ix + mx_*(iy + my_*iz);
+            reduce[1+k]   += R[i]*R[i];
+            reduce[1+n+k] += B[i];
+          }
+        }
+      }
+    }
+    reduce[2*n+1] = nx_*ny_*nz_;
+  }
+
+  CkCallback callback(CkIndex_EnzoBlock::r_solver_cg_batch_0(NULL),
+                      enzo_block->proxy_array());
+
+  enzo_block->contribute ((2*n+2)*sizeof(long double), reduce.data(),
+                          sum_long_double_n_type,
+                          callback);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::r_solver_cg_batch_0 (CkReductionMsg * msg)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  EnzoSolverCg * solver =
+    static_cast<EnzoSolverCg*> (this->solver());
+
+  solver->batch_0(this,msg);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::batch_0
+(EnzoBlock * enzo_block, CkReductionMsg * msg) throw ()
+{
+  long double * data = (long double *) msg->getData();
+
+  const int n = num_rhs_;
+
+  bc_ = data[2*n+1];
+
+  long double * rr  = s_batch_rr_(enzo_block);
+  long double * rr0 = s_batch_rr0_(enzo_block);
+
+  Field field = enzo_block->data()->field();
+
+  for (int k=0; k<n; k++) {
+
+    rr[k] = data[1+k];
+
+    if (A_->is_singular())  {
+
+      // shift B[k] by its projection onto e.  Since R[k] == B[k],
+      // DOT(R,R) of the shifted vector is rr - bs^2/bc, which saves
+      // a second reduction
+
+      const long double bs = data[1+n+k];
+
+      cello::check(bs,"CG::bs_",__FILE__,__LINE__);
+      cello::check(bc_,"CG::bc_",__FILE__,__LINE__);
+
+      rr[k] = std::max(rr[k] - bs*bs/bc_, (long double)0.0);
+
+      if (is_finest_(enzo_block)) {
+
+        enzo_float * B = (enzo_float*) field.values(ib_k_(k));
+        enzo_float * R = (enzo_float*) field.values(ir_list_[k]);
+        enzo_float * D = (enzo_float*) field.values(id_list_[k]);
+
+        const enzo_float shift = -bs / bc_;
+        for (int i=0; i<mx_*my_*mz_; i++) {
+          B[i] += shift;
+          R[i] += shift;
+          D[i] += shift;
+        }
+      }
+    }
+
+    rr0[k] = rr[k];
+  }
+
+  delete msg;
+
+  batch_loop_(enzo_block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::batch_loop_ (EnzoBlock * enzo_block) throw ()
+{
+  const int iter = s_batch_iter_(enzo_block);
+
+  iter_ = iter;
+
+  // Convergence is judged on each system separately; the monitor
+  // shows the worst relative residual and the range over systems
+
+  long double * rr  = s_batch_rr_(enzo_block);
+  long double * rr0 = s_batch_rr0_(enzo_block);
+
+  bool is_active = false;
+  double err_min = 0.0;
+  double err_max = 0.0;
+  for (int k=0; k<num_rhs_; k++) {
+    const double err = (rr0[k] > 0.0) ? double(rr[k] / rr0[k]) : 0.0;
+    err_min = (k == 0) ? err : std::min(err_min,err);
+    err_max = (k == 0) ? err : std::max(err_max,err);
+    is_active = is_active || batch_active_(enzo_block,k);
+  }
+
+  const bool is_converged = ! is_active;
+  const bool is_diverged = (iter >= iter_max_);
+
+  if (enzo_block->index().is_root()) {
+    const bool l_monitor = (monitor_iter_ && (iter % monitor_iter_) == 0 );
+    if (iter == 0 || is_converged || is_diverged || l_monitor) {
+      Solver::monitor_output_
+        (enzo_block,iter,1.0,err_min,err_max,err_max,
+         is_converged || is_diverged);
+    }
+  }
+
+  if (is_converged) {
+
+    end (enzo_block,return_converged);
+
+  } else if (is_diverged) {
+
+    end (enzo_block,return_error);
+
+  } else {
+
+    // Refresh all D[k] then compute Y[k] = A*D[k]
+
+    Refresh * refresh = cello::refresh(ir_batch_loop_);
+
+    refresh->set_active(is_finest_(enzo_block));
+
+    enzo_block->refresh_start
+      (ir_batch_loop_, CkIndex_EnzoBlock::p_solver_cg_batch_matvec());
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_cg_batch_matvec ()
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  EnzoSolverCg * solver =
+    static_cast<EnzoSolverCg*> (this->solver());
+
+  solver->batch_matvec(this);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::batch_matvec (EnzoBlock * enzo_block) throw ()
+{
+  const int n = num_rhs_;
+
+  // [n, DOT(D[k],Y[k])]
+
+  std::vector<long double> reduce (n+1, 0.0);
+  reduce[0] = n;
+
+  if (is_finest_(enzo_block)) {
+    for (int k=0; k<n; k++) {
+      if (batch_active_(enzo_block,k)) {
+        A_->matvec_dot(iy_list_[k],id_list_[k],enzo_block,
+                       1,&id_list_[k],&reduce[1+k]);
+      }
+    }
+  }
+
+  CkCallback callback(CkIndex_EnzoBlock::r_solver_cg_batch_1(NULL),
+                      enzo_block->proxy_array());
+
+  enzo_block->contribute ((n+1)*sizeof(long double), reduce.data(),
+                          sum_long_double_n_type,
+                          callback);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::r_solver_cg_batch_1 (CkReductionMsg * msg)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  EnzoSolverCg * solver =
+    static_cast<EnzoSolverCg*> (this->solver());
+
+  solver->batch_1(this,msg);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::batch_1
+(EnzoBlock * enzo_block, CkReductionMsg * msg) throw ()
+//  a[k] = rr[k] / dy[k]
+//  X[k] = X[k] + a[k]*D[k]
+//  R[k] = R[k] - a[k]*Y[k]
+{
+  long double * data = (long double *) msg->getData();
+
+  const int n = num_rhs_;
+
+  // [3n, DOT(R[k],R[k]), SUM(R[k]), SUM(X[k])]
+
+  std::vector<long double> reduce (3*n+1, 0.0);
+  reduce[0] = 3*n;
+
+  if (is_finest_(enzo_block)) {
+
+    Field field = enzo_block->data()->field();
+
+    long double * rr = s_batch_rr_(enzo_block);
+
+    for (int k=0; k<n; k++) {
+
+      if (! batch_active_(enzo_block,k)) continue;
+
+      const long double dy = data[1+k];
+
+      cello::check(dy,"CG::dy_",__FILE__,__LINE__);
+
+      const enzo_float a = rr[k] / dy;
+
+      enzo_float * X = (enzo_float*) field.values(ix_k_(k));
+      enzo_float * R = (enzo_float*) field.values(ir_list_[k]);
+      enzo_float * D = (enzo_float*) field.values(id_list_[k]);
+      enzo_float * Y = (enzo_float*) field.values(iy_list_[k]);
+
+      for (int i=0; i<mx_*my_*mz_; i++) {
+        X[i] += a * D[i];
+        R[i] -= a * Y[i];
+      }
+
+      for (int iz=gz_; iz<mz_-gz_; iz++) {
+        for (int iy=gy_; iy<my_-gy_; iy++) {
+          for (int ix=gx_; ix<mx_-gx_; ix++) {
+            int i = ix + mx_*(iy + my_*iz);
+            reduce[1+k]     += R[i]*R[i];
+            reduce[1+n+k]   += R[i];
+            reduce[1+2*n+k] += X[i];
+          }
+        }
+      }
+    }
+  }
+
+  delete msg;
+
+  CkCallback callback(CkIndex_EnzoBlock::r_solver_cg_batch_2(NULL),
+                      enzo_block->proxy_array());
+
+  enzo_block->contribute ((3*n+1)*sizeof(long double), reduce.data(),
+                          sum_long_double_n_type,
+                          callback);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::r_solver_cg_batch_2 (CkReductionMsg * msg)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  EnzoSolverCg * solver =
+    static_cast<EnzoSolverCg*> (this->solver());
+
+  solver->batch_2(this,msg);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::batch_2
+(EnzoBlock * enzo_block, CkReductionMsg * msg) throw ()
+//  b[k] = DOT(R[k],R[k]) / rr[k]
+//  D[k] = R[k] + b[k]*D[k]
+{
+  long double * data = (long double *) msg->getData();
+
+  const int n = num_rhs_;
+
+  long double * rr = s_batch_rr_(enzo_block);
+
+  Field field = enzo_block->data()->field();
+
+  for (int k=0; k<n; k++) {
+
+    if (! batch_active_(enzo_block,k)) continue;
+
+    long double rr_new = data[1+k];
+    const long double rs = data[1+n+k];
+    const long double xs = data[1+2*n+k];
+
+    enzo_float * X = (enzo_float*) field.values(ix_k_(k));
+    enzo_float * R = (enzo_float*) field.values(ir_list_[k]);
+    enzo_float * D = (enzo_float*) field.values(id_list_[k]);
+
+    if (A_->is_singular())  {
+
+      // remove the drift of R[k] and X[k] along e, adjusting
+      // DOT(R,R) as in batch_0()
+
+      rr_new = std::max(rr_new - rs*rs/bc_, (long double)0.0);
+
+      if (is_finest_(enzo_block)) {
+        const enzo_float xshift = xs/bc_;
+        const enzo_float rshift = rs/bc_;
+        for (int i=0; i<mx_*my_*mz_; i++) {
+          X[i] -= xshift;
+          R[i] -= rshift;
+        }
+      }
+    }
+
+    if (is_finest_(enzo_block)) {
+      const enzo_float b = rr_new / rr[k];
+      for (int i=0; i<mx_*my_*mz_; i++) {
+        D[i] = R[i] + b * D[i];
+      }
+    }
+
+    rr[k] = rr_new;
+  }
+
+  delete msg;
+
+  ++s_batch_iter_(enzo_block);
+
+  batch_loop_(enzo_block);
+}
+
 //----------------------------------------------------------------------
 
 void EnzoSolverCg::local_cg_(EnzoBlock * enzo_block)
@@ -805,18 +1666,19 @@ void EnzoSolverCg::local_cg_(EnzoBlock * enzo_block)
 
     refresh_local_(id_,enzo_block);
 
-    A_->matvec(iy_,id_,enzo_block);
+    long double dy = 0.0;
+
+    A_->matvec_dot(iy_,id_,enzo_block,1,&id_,&dy);
 
     rr_ = 0.0;
     rz_ = 0.0;
-    dy_ = 0.0;
+    dy_ = dy;
     for (int iz=gz_; iz<mz_-gz_; iz++) {
       for (int iy=gy_; iy<my_-gy_; iy++) {
 	for (int ix=gx_; ix<mx_-gx_; ix++) {
 	  int i = ix + mx_*(iy + my_*iz);
 	  rr_ += R[i]*R[i];
 	  rz_ += R[i]*Z[i];
-	  dy_ += D[i]*Y[i];
 	}
       }
     }
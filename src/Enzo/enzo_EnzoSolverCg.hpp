@@ -28,7 +28,9 @@ public: // interface
 		int max_level,
 		int iter_max,
 		double res_tol,
-		int index_precon);
+		int index_precon,
+		bool pipelined = false,
+		int batch_size = 1);
 
   /// Constructor
   EnzoSolverCg() throw()
@@ -48,7 +50,17 @@ public: // interface
     bc_(0.0),
     local_(false),
     ir_matvec_(-1),
-    ir_loop_2_(-1)
+    ir_loop_2_(-1),
+    pipelined_(false),
+    iw_(-1), iv_(-1),
+    ir_pipe_start_(-1),
+    ir_pipe_even_(-1), ir_pipe_odd_(-1),
+    is_pipe_sync_(-1), is_pipe_iter_(-1),
+    is_pipe_alpha_(-1), is_pipe_gamma_(-1),
+    batch_size_(1), num_rhs_(1),
+    ir_list_(), id_list_(), iy_list_(),
+    ir_batch_loop_(-1),
+    is_batch_iter_(-1), is_batch_rr_(-1), is_batch_rr0_(-1)
   {};
 
   /// Charm++ PUP::able declarations
@@ -72,7 +84,17 @@ public: // interface
       bc_(0.0),
       local_(false),
       ir_matvec_(-1),
-      ir_loop_2_(-1)
+      ir_loop_2_(-1),
+      pipelined_(false),
+      iw_(-1), iv_(-1),
+      ir_pipe_start_(-1),
+      ir_pipe_even_(-1), ir_pipe_odd_(-1),
+      is_pipe_sync_(-1), is_pipe_iter_(-1),
+      is_pipe_alpha_(-1), is_pipe_gamma_(-1),
+      batch_size_(1), num_rhs_(1),
+      ir_list_(), id_list_(), iy_list_(),
+      ir_batch_loop_(-1),
+      is_batch_iter_(-1), is_batch_rr_(-1), is_batch_rr0_(-1)
 
   {}
 
@@ -92,6 +114,9 @@ public: // virtual functions
   /// Type of this solver
   virtual std::string type() const { return "cg"; }
 
+  /// Maximum number of right-hand sides solved together
+  virtual int num_batch() const { return batch_size_; }
+
   //--------------------------------------------------
 
 public: // virtual functions
@@ -119,6 +144,30 @@ public: // virtual functions
 
   void end (EnzoBlock * enzo_block, int retval) throw();
 
+  /// Pipelined CG: continuation after the initial B reduction
+  void pipe_0 (EnzoBlock * enzo_block, CkReductionMsg *) throw();
+
+  /// Pipelined CG: continuation after the initial refresh of R
+  void pipe_start (EnzoBlock * enzo_block) throw();
+
+  /// Pipelined CG: continuation after the refresh of W
+  void pipe_matvec (EnzoBlock * enzo_block) throw();
+
+  /// Pipelined CG: continuation after the fused global reduction
+  void pipe_reduce (EnzoBlock * enzo_block, CkReductionMsg *) throw();
+
+  /// Batched CG: continuation after the initial B reductions
+  void batch_0 (EnzoBlock * enzo_block, CkReductionMsg *) throw();
+
+  /// Batched CG: continuation after the refresh of all D[k]
+  void batch_matvec (EnzoBlock * enzo_block) throw();
+
+  /// Batched CG: continuation after the DOT(D[k],Y[k]) reduction
+  void batch_1 (EnzoBlock * enzo_block, CkReductionMsg *) throw();
+
+  /// Batched CG: continuation after the DOT(R[k],R[k]) reduction
+  void batch_2 (EnzoBlock * enzo_block, CkReductionMsg *) throw();
+
   /// Set rz_ by EnzoBlock after reduction
   void set_rz(double rz) throw()    {  rz_ = rz; }
 
@@ -157,6 +206,15 @@ protected: // methods
     field.allocate_temporary(ir_);
     field.allocate_temporary(iy_);
     field.allocate_temporary(iz_);
+    if (pipelined_) {
+      field.allocate_temporary(iw_);
+      field.allocate_temporary(iv_);
+    }
+    for (int k=1; k<num_rhs_; k++) {
+      field.allocate_temporary(ir_list_[k]);
+      field.allocate_temporary(id_list_[k]);
+      field.allocate_temporary(iy_list_[k]);
+    }
   }
 
   /// Dellocate temporary Fields
@@ -166,6 +224,15 @@ protected: // methods
     field.deallocate_temporary(ir_);
     field.deallocate_temporary(iy_);
     field.deallocate_temporary(iz_);
+    if (pipelined_) {
+      field.deallocate_temporary(iw_);
+      field.deallocate_temporary(iv_);
+    }
+    for (int k=1; k<num_rhs_; k++) {
+      field.deallocate_temporary(ir_list_[k]);
+      field.deallocate_temporary(id_list_[k]);
+      field.deallocate_temporary(iy_list_[k]);
+    }
   }
 
   /// Serial CG solver if local_ == true
@@ -179,6 +246,50 @@ protected: // methods
 
   void monitor_output_(EnzoBlock *);
 
+  /// Pipelined CG: contribute the fused reduction and start the
+  /// refresh of W for the overlapped matvec
+  void pipe_loop_ (EnzoBlock * enzo_block) throw();
+
+  /// Pipelined CG: vector updates once both the reduction and the
+  /// matvec for the current iteration have completed
+  void pipe_update_ (EnzoBlock * enzo_block) throw();
+
+  /// Access the pipelined CG Block scalars
+  Sync & s_pipe_sync_(Block * block)
+  { return *block->data()->scalar_sync().value(is_pipe_sync_); }
+  int & s_pipe_iter_(Block * block)
+  { return *block->data()->scalar_int().value(is_pipe_iter_); }
+  long double & s_pipe_alpha_(Block * block)
+  { return *block->data()->scalar_long_double().value(is_pipe_alpha_); }
+  long double & s_pipe_gamma_(Block * block)
+  { return *block->data()->scalar_long_double().value(is_pipe_gamma_); }
+
+  /// Batched CG: start all num_rhs_ solves
+  void batch_start_ (EnzoBlock * enzo_block) throw();
+
+  /// Batched CG: check convergence, then refresh D[k] for the next
+  /// iteration
+  void batch_loop_ (EnzoBlock * enzo_block) throw();
+
+  /// Batched CG: whether system k is still iterating
+  bool batch_active_ (Block * block, int k)
+  {
+    const long double rr0 = s_batch_rr0_(block)[k];
+    return (rr0 > 0.0) && (s_batch_rr_(block)[k] / rr0 >= res_tol_);
+  }
+
+  /// Batched CG: solution and right-hand side Field id's of system k
+  int ix_k_(int k) const { return (k == 0) ? ix_ : ix_batch_[k-1]; }
+  int ib_k_(int k) const { return (k == 0) ? ib_ : ib_batch_[k-1]; }
+
+  /// Access the batched CG Block scalars
+  int & s_batch_iter_(Block * block)
+  { return *block->data()->scalar_int().value(is_batch_iter_); }
+  long double * s_batch_rr_(Block * block)
+  { return block->data()->scalar_long_double().value(is_batch_rr_); }
+  long double * s_batch_rr0_(Block * block)
+  { return block->data()->scalar_long_double().value(is_batch_rr0_); }
+
 protected: // attributes
 
   // NOTE: change pup() function whenever attributes change
@@ -246,6 +357,48 @@ protected: // attributes
   int ir_matvec_;
   int ir_loop_2_;
 
+  /// Whether to use the pipelined (Ghysels-Vanroose) CG iteration
+  bool pipelined_;
+
+  /// Pipelined CG vector id's: W = A*R and V = A*D (Z holds A*V)
+  int iw_;
+  int iv_;
+
+  /// Pipelined CG refresh id's: R at startup, then W alternating
+  /// between even and odd iterations so that early ghost data for
+  /// the next iteration is never mixed with the current one
+  int ir_pipe_start_;
+  int ir_pipe_even_;
+  int ir_pipe_odd_;
+
+  /// Pipelined CG Block scalar id's: join of reduction and matvec,
+  /// iteration count, and previous alpha and gamma = dot(R,R)
+  int is_pipe_sync_;
+  int is_pipe_iter_;
+  int is_pipe_alpha_;
+  int is_pipe_gamma_;
+
+  /// Maximum number of right-hand sides solved together
+  int batch_size_;
+
+  /// Number of right-hand sides in the current solve
+  int num_rhs_;
+
+  /// Batched CG vector id's for each system: element 0 is ir_, id_,
+  /// iy_ (Z == R, since batched CG is unpreconditioned)
+  std::vector<int> ir_list_;
+  std::vector<int> id_list_;
+  std::vector<int> iy_list_;
+
+  /// Batched CG refresh id for all D[k]
+  int ir_batch_loop_;
+
+  /// Batched CG Block scalar id's: iteration count, and current and
+  /// initial DOT(R[k],R[k]) for each system
+  int is_batch_iter_;
+  int is_batch_rr_;
+  int is_batch_rr0_;
+
 };
 
 #endif /* ENZO_ENZO_SOLVER_CG_HPP */
@@ -458,17 +458,14 @@ FieldMsg * EnzoSolverDd::pack_field_(EnzoBlock * enzo_block,
   }
 
   Field field = enzo_block->data()->field();
-  int narray;
-  char * array;
-  field_face->face_to_array(field,&narray,&array);
-
-  delete field_face;
+  const int narray = field_face->num_bytes_array(field);
 
   FieldMsg * msg  = new (narray) FieldMsg;
 
   msg->n = narray;
-  memcpy (msg->a, array, narray);
-  delete [] array;
+  field_face->face_to_array(field,msg->a);
+
+  delete field_face;
 
   msg->ic3[0] = ic3[0];
   msg->ic3[1] = ic3[1];
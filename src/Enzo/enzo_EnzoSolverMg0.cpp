@@ -934,27 +934,21 @@ FieldMsg * EnzoSolverMg0::pack_residual_(EnzoBlock * enzo_block) throw()
 
   refresh->set_restrict(index_restrict_);
 
-  int narray;
-  char * array;
-
   Field field = enzo_block->data()->field();
 
-  field_face->face_to_array(field,&narray,&array);
-
-  delete field_face;
+  const int narray = field_face->num_bytes_array(field);
 
   // Create a FieldMsg for sending data to parent
   // (note: charm messages not deleted on send; are deleted on receive)
 
   FieldMsg * msg  = new (narray) FieldMsg;
 
-  /// WARNING: double copy
-
-  // Copy FieldFace data to msg
+  // Copy FieldFace data directly into msg
 
   msg->n = narray;
-  memcpy (msg->a, array, narray);
-  delete [] array;
+  field_face->face_to_array(field,msg->a);
+
+  delete field_face;
   msg->ic3[0] = ic3[0];
   msg->ic3[1] = ic3[1];
   msg->ic3[2] = ic3[2];
@@ -1017,24 +1011,19 @@ FieldMsg * EnzoSolverMg0::pack_correction_
     (if3, ic3, g3, refresh_fine, refresh, true);
 
   Field field = enzo_block->data()->field();
-  int narray;
-  char * array;
-  field_face->face_to_array (field,&narray,&array);
-
-  delete field_face;
+  const int narray = field_face->num_bytes_array(field);
 
   // Create a FieldMsg for sending data to parent
   // (note: charm messages not deleted on send; are deleted on receive)
 
   FieldMsg * msg  = new (narray) FieldMsg;
 
-  /// WARNING: double copy
-
-  // Copy FieldFace data to msg
+  // Copy FieldFace data directly into msg
 
   msg->n = narray;
-  memcpy (msg->a, array, narray);
-  delete [] array;
+  field_face->face_to_array(field,msg->a);
+
+  delete field_face;
   msg->ic3[0] = ic3[0];
   msg->ic3[1] = ic3[1];
   msg->ic3[2] = ic3[2];
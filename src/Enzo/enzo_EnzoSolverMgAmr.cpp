@@ -0,0 +1,837 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverMgAmr.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Implements the EnzoSolverMgAmr class
+///
+/// Full approximation scheme (FAS) multigrid V-cycle on the adaptive
+/// mesh hierarchy.  Each Block in coarse_level <= level holds the
+/// solution X on its own level: leaves smooth A X = B directly, while
+/// non-leaf Blocks smooth the FAS coarse-grid equation
+///
+///    A_H X_H = F_H = A_H (I_h^H X_h) + I_h^H R_h
+///
+/// using the solution and residual restricted from their children.
+/// The correction X_H - I_h^H X_h is then prolonged back to the
+/// children.  Blocks only wait on their own parent and children, so
+/// different subtrees can be on different levels of the V-cycle at
+/// the same time; the only global synchronization is the coarse
+/// solver and the residual reduction at the end of each cycle.
+///
+///======================================================================
+///
+///  @code
+///
+///  apply()
+///
+///     X = R = C = 0, F = B on leaves, D = diag(A)
+///     begin_cycle()
+///
+///  begin_cycle()
+///
+///     if (level < coarse_level)  call_coarse_solver()
+///     else if (leaf)             refresh (X,"leaf") --> descend()
+///     else                       restrict_recv()
+///
+///  restrict_recv(X,R)         [ wait for all children ]
+///
+///     unpack X,R
+///     descend()
+///
+///  descend()
+///
+///     refresh (X,"level") --> pre_smooth()
+///
+///  pre_smooth()
+///
+///     if (first && ! leaf)  F = A*X + R,  C = X
+///     if (level == coarse_level)
+///        call_coarse_solver()
+///     else if (sweeps < num_pre_smooth)
+///        X = X + w*(F - A*X)/D
+///        refresh (X,"level") --> pre_smooth()
+///     else
+///        R = F - A*X
+///        parent.restrict_recv(X,R)
+///        call_coarse_solver()
+///
+///  solve_coarse()
+///
+///     if (level < coarse_level)   end_level()
+///     if (level == coarse_level)  refresh (X,"level") --> post_smooth()
+///     if (level > coarse_level)   prolong_recv()
+///
+///  prolong_recv(R)            [ wait for parent ]
+///
+///     unpack R
+///     X = X + R
+///     post_smooth()
+///
+///  post_smooth()
+///
+///     if (level > coarse_level && sweeps < num_post_smooth)
+///        X = X + w*(F - A*X)/D
+///        refresh (X,"level") --> post_smooth()
+///     else
+///        if (! leaf)  child.prolong_recv(X - C)
+///        end_level()
+///
+///  end_level()
+///
+///     contribute (R'*R on leaves) --> end_cycle()
+///
+///  end_cycle()
+///
+///     if (converged() || diverged()) end()
+///     else begin_cycle()
+///
+///  @endcode
+///
+///======================================================================
+
+#include "cello.hpp"
+#include "enzo.hpp"
+#include "enzo.decl.h"
+
+//======================================================================
+
+EnzoSolverMgAmr::EnzoSolverMgAmr
+(std::string name,
+ std::string field_x,
+ std::string field_b,
+ int monitor_iter,
+ int restart_cycle,
+ int solve_type,
+ int index_prolong,
+ int index_restrict,
+ int min_level,
+ int max_level,
+ int iter_max,
+ double res_tol,
+ int index_solve_coarse,
+ int coarse_level,
+ double weight,
+ int num_pre_smooth,
+ int num_post_smooth)
+  : Solver(name,
+	   field_x,
+	   field_b,
+	   monitor_iter,
+	   restart_cycle,
+	   solve_type,
+           index_prolong,
+           index_restrict,
+	   min_level,
+	   max_level),
+    rr_(0), rr0_(0),
+    res_tol_(res_tol),
+    iter_max_(iter_max),
+    A_(nullptr),
+    index_solve_coarse_(index_solve_coarse),
+    coarse_level_(coarse_level),
+    weight_(weight),
+    num_pre_smooth_(num_pre_smooth),
+    num_post_smooth_(num_post_smooth),
+    ir_(-1), ic_(-1), if_(-1), id_(-1),
+    ir_leaf_(-1),
+    i_sync_restrict_(-1),
+    i_sync_prolong_(-1),
+    i_msg_restrict_(),
+    i_msg_prolong_(-1),
+    i_iter_(-1),
+    i_smooth_(-1),
+    i_refresh_(-1),
+    i_rr_local_(-1),
+    mx_(0),my_(0),mz_(0),
+    gx_(0),gy_(0),gz_(0)
+{
+  ASSERT1 ("EnzoSolverMgAmr::EnzoSolverMgAmr()",
+           "Solver %s requires a coarse_solve solver",
+           name.c_str(),
+           index_solve_coarse_ >= 0);
+
+  // Initialize temporary fields
+
+  ir_ = cello::field_descr()->insert_temporary();
+  ic_ = cello::field_descr()->insert_temporary();
+  if_ = cello::field_descr()->insert_temporary();
+  id_ = cello::field_descr()->insert_temporary();
+
+  Refresh * refresh = cello::refresh(ir_post_);
+  cello::simulation()->refresh_set_name(ir_post_,name);
+
+  refresh->add_field (ix_);
+
+  // Leaf refresh sets coarse-fine ghost zones at the start of each
+  // cycle; level refreshes only exchange with same-level neighbors
+
+  ir_leaf_ = new_refresh_
+    (neighbor_leaf, sync_neighbor,
+     CkIndex_EnzoBlock::p_solver_mg_amr_descend(), name + ":leaf");
+
+  for (int i=0; i<2; i++) {
+    ir_pre_smooth_[i] = new_refresh_
+      (neighbor_level, sync_face,
+       CkIndex_EnzoBlock::p_solver_mg_amr_pre_smooth(), name + ":pre");
+    ir_post_smooth_[i] = new_refresh_
+      (neighbor_level, sync_face,
+       CkIndex_EnzoBlock::p_solver_mg_amr_post_smooth(), name + ":post");
+  }
+
+  ScalarDescr * scalar_descr_int  = cello::scalar_descr_int();
+  i_iter_    = scalar_descr_int->new_value(name + ":iter");
+  i_smooth_  = scalar_descr_int->new_value(name + ":smooth");
+  i_refresh_ = scalar_descr_int->new_value(name + ":refresh");
+
+  ScalarDescr * scalar_descr_long_double = cello::scalar_descr_long_double();
+  i_rr_local_ = scalar_descr_long_double->new_value(name + ":rr_local");
+
+  ScalarDescr * scalar_descr_sync = cello::scalar_descr_sync();
+  i_sync_restrict_ = scalar_descr_sync->new_value(name + ":restrict");
+  i_sync_prolong_  = scalar_descr_sync->new_value(name + ":prolong");
+
+  ScalarDescr * scalar_descr_void = cello::scalar_descr_void();
+  i_msg_prolong_ = scalar_descr_void->new_value(name + ":msg_prolong");
+  for (int ic=0; ic<cello::num_children(); ic++) {
+    i_msg_restrict_[ic] = scalar_descr_void->new_value(name + ":msg_restrict");
+  }
+}
+
+//----------------------------------------------------------------------
+
+int EnzoSolverMgAmr::new_refresh_
+(int neighbor_type, int sync_type, int callback, std::string name)
+{
+  const int * g3 = cello::config()->field_ghost_depth;
+  const int ghost_depth = std::max(g3[0],std::max(g3[1],g3[2]));
+  const int min_face_rank = cello::config()->adapt_min_face_rank;
+
+  Refresh refresh
+    (ghost_depth,min_face_rank, neighbor_type, sync_type, 0);
+
+  refresh.set_prolong(index_prolong_);
+  refresh.set_restrict(index_restrict_);
+  refresh.add_field(ix_);
+  refresh.set_callback(callback);
+
+  const int id_refresh = cello::simulation()->new_register_refresh(refresh);
+  cello::simulation()->refresh_set_name(id_refresh,name);
+
+  return id_refresh;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverMgAmr::apply ( std::shared_ptr<Matrix> A, Block * block) throw()
+{
+  Solver::begin_(block);
+
+  A_ = A;
+
+  allocate_temporary_(block);
+
+  rr_ = 0.0;
+  rr0_ = 0.0;
+
+  *piter(block) = 0;
+  *psmooth(block) = 0;
+  *prefresh(block) = 0;
+  *prr_local(block) = 0.0;
+
+  Field field = block->data()->field();
+
+  field.dimensions (ib_,&mx_,&my_,&mz_);
+  field.ghost_depth(ib_,&gx_,&gy_,&gz_);
+
+  const int m = mx_*my_*mz_;
+
+  enzo_float * X = (enzo_float*) field.values(ix_);
+  enzo_float * B = (enzo_float*) field.values(ib_);
+  enzo_float * R = (enzo_float*) field.values(ir_);
+  enzo_float * C = (enzo_float*) field.values(ic_);
+  enzo_float * F = (enzo_float*) field.values(if_);
+
+  // X = R = C = 0; F = B on leaves, and is computed from restricted
+  // data on non-leaves
+
+  std::fill_n(X,m,0.0);
+  std::fill_n(R,m,0.0);
+  std::fill_n(C,m,0.0);
+  if (block->is_leaf()) {
+    std::copy_n(B,m,F);
+  } else {
+    std::fill_n(F,m,0.0);
+  }
+
+  A_->diagonal (id_,block,gx_);
+
+  // Initialize sync counters for restrict and prolong
+
+  psync_restrict(block)->set_stop(1 + cello::num_children()); // self and children
+  psync_prolong(block)->set_stop(1 + 1); // self and parent
+
+  begin_cycle_ (enzo::block(block));
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverMgAmr::begin_cycle_(EnzoBlock * enzo_block) throw()
+{
+  if (! is_active_(enzo_block)) {
+
+    // Blocks below the coarse level only take part in the coarse solve
+
+    call_coarse_solver_(enzo_block);
+
+  } else if (enzo_block->is_leaf()) {
+
+    // Update coarse-fine ghost zones from neighboring leaves; not
+    // needed on the first cycle since X = 0 everywhere
+
+    if (*piter(enzo_block) > 0) {
+      enzo_block->refresh_start
+        (ir_leaf_, CkIndex_EnzoBlock::p_solver_mg_amr_descend());
+    } else {
+      descend (enzo_block);
+    }
+
+  } else {
+
+    restrict_recv (enzo_block,nullptr);
+
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_mg_amr_descend()
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+  static_cast<EnzoSolverMgAmr*> (solver())->descend(this);
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverMgAmr::descend(EnzoBlock * enzo_block) throw()
+{
+  *psmooth(enzo_block) = 0;
+  refresh_level_(enzo_block,true);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverMgAmr::refresh_level_(EnzoBlock * enzo_block, bool pre) throw()
+{
+  // Alternate refresh id's: a neighbor can be at most one level
+  // refresh ahead of this Block
+
+  const int parity = ((*prefresh(enzo_block))++) % 2;
+
+  if (pre) {
+    enzo_block->refresh_start
+      (ir_pre_smooth_[parity],
+       CkIndex_EnzoBlock::p_solver_mg_amr_pre_smooth());
+  } else {
+    enzo_block->refresh_start
+      (ir_post_smooth_[parity],
+       CkIndex_EnzoBlock::p_solver_mg_amr_post_smooth());
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_mg_amr_pre_smooth()
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+  static_cast<EnzoSolverMgAmr*> (solver())->pre_smooth(this);
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverMgAmr::pre_smooth(EnzoBlock * enzo_block) throw()
+{
+  int & sweep = *psmooth(enzo_block);
+
+  const bool is_leaf = enzo_block->is_leaf();
+
+  if (sweep == 0 && ! is_leaf) {
+
+    // FAS right-hand side F = A*X + R from the restricted X and R,
+    // and save the restricted X (including ghosts) in C
+
+    Field field = enzo_block->data()->field();
+
+    enzo_float * X = (enzo_float*) field.values(ix_);
+    enzo_float * R = (enzo_float*) field.values(ir_);
+    enzo_float * C = (enzo_float*) field.values(ic_);
+    enzo_float * F = (enzo_float*) field.values(if_);
+
+    A_->matvec (if_,ix_,enzo_block,gx_);
+
+    for (int iz=gz_; iz<mz_-gz_; iz++) {
+      for (int iy=gy_; iy<my_-gy_; iy++) {
+	for (int ix=gx_; ix<mx_-gx_; ix++) {
+	  int i = ix + mx_*(iy + my_*iz);
+	  F[i] += R[i];
+	}
+      }
+    }
+
+    std::copy_n(X,mx_*my_*mz_,C);
+  }
+
+  if (enzo_block->level() == coarse_level_) {
+
+    if (is_leaf) compute_residual_(enzo_block);
+
+    call_coarse_solver_(enzo_block);
+
+  } else if (sweep < num_pre_smooth_) {
+
+    smooth_(enzo_block);
+    ++sweep;
+    refresh_level_(enzo_block,true);
+
+  } else {
+
+    compute_residual_(enzo_block);
+
+    restrict_send_(enzo_block);
+
+    // All Blocks must call coarse solver since may involve
+    // global reductions
+
+    call_coarse_solver_(enzo_block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverMgAmr::smooth_(EnzoBlock * enzo_block) throw()
+{
+  Field field = enzo_block->data()->field();
+
+  A_->residual (ir_,if_,ix_,enzo_block,gx_);
+
+  enzo_float * X = (enzo_float*) field.values(ix_);
+  enzo_float * R = (enzo_float*) field.values(ir_);
+  enzo_float * D = (enzo_float*) field.values(id_);
+
+  const enzo_float w = weight_;
+
+  for (int iz=gz_; iz<mz_-gz_; iz++) {
+    for (int iy=gy_; iy<my_-gy_; iy++) {
+      for (int ix=gx_; ix<mx_-gx_; ix++) {
+	int i = ix + mx_*(iy + my_*iz);
+	X[i] += w*R[i]/D[i];
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverMgAmr::compute_residual_(EnzoBlock * enzo_block) throw()
+{
+  Field field = enzo_block->data()->field();
+
+  A_->residual (ir_,if_,ix_,enzo_block,gx_);
+
+  if (enzo_block->is_leaf()) {
+    enzo_float * R = (enzo_float*) field.values(ir_);
+    long double rr = 0.0;
+    for (int iz=gz_; iz<mz_-gz_; iz++) {
+      for (int iy=gy_; iy<my_-gy_; iy++) {
+	for (int ix=gx_; ix<mx_-gx_; ix++) {
+	  int i = ix + mx_*(iy + my_*iz);
+	  rr += R[i]*R[i];
+	}
+      }
+    }
+    *prr_local(enzo_block) += rr;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverMgAmr::call_coarse_solver_(EnzoBlock * enzo_block) throw()
+{
+  Solver * solve_coarse = cello::solver(index_solve_coarse_);
+
+  solve_coarse->set_min_level(coarse_level_);
+  solve_coarse->set_max_level(coarse_level_);
+  solve_coarse->set_sync_id (enzo_sync_id_solver_mg_amr_coarse);
+  solve_coarse->set_callback(CkIndex_EnzoBlock::p_solver_mg_amr_solve_coarse());
+
+  solve_coarse->set_field_x (ix_);
+  solve_coarse->set_field_b (if_);
+
+  solve_coarse->apply(A_,enzo_block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverMgAmr::restrict_send_(EnzoBlock * enzo_block) throw()
+{
+  FieldMsg * msg = pack_restrict_(enzo_block);
+
+  Index index_parent = enzo_block->index().index_parent(min_level_);
+
+  enzo::block_array()[index_parent].p_solver_mg_amr_restrict_recv(msg);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_mg_amr_restrict_recv(FieldMsg * msg)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+  static_cast<EnzoSolverMgAmr*> (solver())->restrict_recv(this,msg);
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverMgAmr::restrict_recv
+(EnzoBlock * enzo_block, FieldMsg * msg) throw()
+{
+  // Save field message from child: may arrive before this Block has
+  // started the cycle, so unpacking is deferred until all are in
+
+  if (msg != nullptr) *pmsg_restrict(enzo_block,msg->child_index()) = msg;
+
+  if (psync_restrict(enzo_block)->next() ) {
+
+    for (int i=0; i<cello::num_children(); i++) {
+      msg = *pmsg_restrict(enzo_block,i);
+      *pmsg_restrict(enzo_block,i) = nullptr;
+      unpack_restrict_(enzo_block,msg);
+    }
+
+    descend (enzo_block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_mg_amr_solve_coarse()
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+  static_cast<EnzoSolverMgAmr*> (solver())->solve_coarse(this);
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverMgAmr::solve_coarse(EnzoBlock * enzo_block) throw()
+{
+  const int level = enzo_block->level();
+
+  if (level < coarse_level_) {
+
+    end_level_(enzo_block);
+
+  } else if (level == coarse_level_) {
+
+    // Refresh the coarse solution before computing the correction,
+    // which is prolonged including ghost zones
+
+    *psmooth(enzo_block) = 0;
+    refresh_level_(enzo_block,false);
+
+  } else {
+
+    prolong_recv(enzo_block,nullptr);
+
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_mg_amr_prolong_recv(FieldMsg * msg)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+  static_cast<EnzoSolverMgAmr*> (solver())->prolong_recv(this,msg);
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverMgAmr::prolong_recv
+(EnzoBlock * enzo_block, FieldMsg * msg) throw()
+{
+  // Save message, and return if the coarse solve or the parent's
+  // correction is still outstanding
+
+  if (msg != nullptr) *pmsg_prolong(enzo_block) = msg;
+
+  if (! psync_prolong(enzo_block)->next() ) return;
+
+  msg = *pmsg_prolong(enzo_block);
+  *pmsg_prolong(enzo_block) = nullptr;
+  unpack_correction_(enzo_block,msg);
+
+  // X = X + R, including ghost zones so that coarse-fine ghosts
+  // are corrected as well
+
+  Field field = enzo_block->data()->field();
+
+  enzo_float * X = (enzo_float*) field.values(ix_);
+  enzo_float * R = (enzo_float*) field.values(ir_);
+
+  for (int i=0; i<mx_*my_*mz_; i++) {
+    X[i] += R[i];
+  }
+
+  *psmooth(enzo_block) = 0;
+  post_smooth(enzo_block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_mg_amr_post_smooth()
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+  static_cast<EnzoSolverMgAmr*> (solver())->post_smooth(this);
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverMgAmr::post_smooth(EnzoBlock * enzo_block) throw()
+{
+  int & sweep = *psmooth(enzo_block);
+
+  if (enzo_block->level() > coarse_level_ && sweep < num_post_smooth_) {
+
+    smooth_(enzo_block);
+    ++sweep;
+    refresh_level_(enzo_block,false);
+
+  } else {
+
+    if (! enzo_block->is_leaf()) {
+
+      // Correction R = X - C relative to the restricted solution
+
+      Field field = enzo_block->data()->field();
+
+      enzo_float * X = (enzo_float*) field.values(ix_);
+      enzo_float * R = (enzo_float*) field.values(ir_);
+      enzo_float * C = (enzo_float*) field.values(ic_);
+
+      for (int i=0; i<mx_*my_*mz_; i++) {
+	R[i] = X[i] - C[i];
+      }
+
+      prolong_send_(enzo_block);
+    }
+
+    end_level_(enzo_block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverMgAmr::prolong_send_(EnzoBlock * enzo_block) throw()
+{
+  ItChild it_child(cello::rank());
+  int ic3[3];
+
+  while (it_child.next(ic3)) {
+
+    FieldMsg * msg = pack_correction_(enzo_block,ic3);
+
+    Index index_child = enzo_block->index().index_child(ic3,min_level_);
+
+    enzo::block_array()[index_child].p_solver_mg_amr_prolong_recv(msg);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverMgAmr::end_level_(EnzoBlock * enzo_block) throw()
+{
+  long double data[1] = { *prr_local(enzo_block) };
+  *prr_local(enzo_block) = 0.0;
+
+  CkCallback callback(CkIndex_EnzoBlock::r_solver_mg_amr_end_cycle(nullptr),
+		      enzo::block_array());
+
+  enzo_block->contribute(sizeof(long double), data,
+                         sum_long_double_type, callback);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::r_solver_mg_amr_end_cycle(CkReductionMsg * msg)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+  static_cast<EnzoSolverMgAmr*> (solver())->end_cycle(this,msg);
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverMgAmr::end_cycle
+(EnzoBlock * enzo_block, CkReductionMsg * msg) throw()
+{
+  rr_ = ((long double*) msg->getData())[0];
+  delete msg;
+
+  const int iter = ++ (*piter(enzo_block));
+
+  if (iter == 1) rr0_ = rr_;
+
+  const bool is_converged = (rr0_ != 0.0 && rr_/rr0_ < res_tol_);
+  const bool is_diverged  = (iter >= iter_max_);
+
+  const bool l_output =
+    ( ( enzo_block->index().is_root()) &&
+      ( (is_converged) || (is_diverged) ||
+	(monitor_iter_ && (iter % monitor_iter_) == 0 )) );
+
+  if (l_output) {
+    Solver::monitor_output_(enzo_block,iter,rr0_,0.0,rr_,0.0);
+  }
+
+  if (is_converged || is_diverged) {
+    end_solve_(enzo_block);
+  } else {
+    begin_cycle_(enzo_block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+FieldMsg * EnzoSolverMgAmr::pack_restrict_(EnzoBlock * enzo_block) throw()
+{
+  Index index        = enzo_block->index();
+  const  int level   = index.level();
+
+  int ic3[3];
+  index.child(level,&ic3[0],&ic3[1],&ic3[2],min_level_);
+
+  int if3[3] = {0,0,0};
+  int g3[3] = {0,0,0};
+  Refresh * refresh = new Refresh;
+  refresh->set_prolong(index_prolong_);
+  refresh->set_restrict(index_restrict_);
+  refresh->add_field(ix_);
+  refresh->add_field(ir_);
+  refresh->set_min_face_rank(2);
+
+  FieldFace * field_face = enzo_block->create_face
+    (if3, ic3, g3, refresh_coarse, refresh, true);
+
+  Field field = enzo_block->data()->field();
+
+  const int narray = field_face->num_bytes_array(field);
+
+  // (note: charm messages not deleted on send; are deleted on receive)
+
+  FieldMsg * msg  = new (narray) FieldMsg;
+
+  msg->n = narray;
+  field_face->face_to_array(field,msg->a);
+
+  delete field_face;
+  msg->ic3[0] = ic3[0];
+  msg->ic3[1] = ic3[1];
+  msg->ic3[2] = ic3[2];
+
+  return msg;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverMgAmr::unpack_restrict_
+(EnzoBlock * enzo_block,FieldMsg * msg) throw()
+{
+  int if3[3] = {0,0,0};
+  int g3[3] = {0,0,0};
+  Refresh * refresh = new Refresh;
+  refresh->set_prolong(index_prolong_);
+  refresh->set_restrict(index_restrict_);
+  refresh->add_field(ix_);
+  refresh->add_field(ir_);
+  refresh->set_min_face_rank(2);
+
+  FieldFace * field_face = enzo_block->create_face
+    (if3, msg->ic3, g3, refresh_coarse, refresh, true);
+
+  Field field = enzo_block->data()->field();
+
+  field_face->array_to_face(msg->a, field);
+  delete field_face;
+
+  delete msg;
+}
+
+//----------------------------------------------------------------------
+
+FieldMsg * EnzoSolverMgAmr::pack_correction_
+(EnzoBlock * enzo_block, int ic3[3]) throw()
+{
+  int if3[3] = {0,0,0};
+  int g3[3];
+  cello::field_descr()->ghost_depth(ir_,g3,g3+1,g3+2);
+  Refresh * refresh = new Refresh;
+  refresh->set_prolong(index_prolong_);
+  refresh->set_restrict(index_restrict_);
+  refresh->add_field(ir_);
+  refresh->set_min_face_rank(2);
+
+  FieldFace * field_face = enzo_block->create_face
+    (if3, ic3, g3, refresh_fine, refresh, true);
+
+  Field field = enzo_block->data()->field();
+  const int narray = field_face->num_bytes_array(field);
+
+  FieldMsg * msg  = new (narray) FieldMsg;
+
+  msg->n = narray;
+  field_face->face_to_array(field,msg->a);
+
+  delete field_face;
+  msg->ic3[0] = ic3[0];
+  msg->ic3[1] = ic3[1];
+  msg->ic3[2] = ic3[2];
+
+  return msg;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverMgAmr::unpack_correction_
+(EnzoBlock * enzo_block, FieldMsg * msg) throw()
+{
+  int if3[3] = {0,0,0};
+  int g3[3];
+  cello::field_descr()->ghost_depth(ir_,g3,g3+1,g3+2);
+  Refresh * refresh = new Refresh;
+  refresh->set_prolong(index_prolong_);
+  refresh->set_restrict(index_restrict_);
+  refresh->add_field(ir_);
+  refresh->set_min_face_rank(2);
+
+  FieldFace * field_face = enzo_block->create_face
+    (if3, msg->ic3, g3, refresh_fine, refresh, true);
+
+  Field field = enzo_block->data()->field();
+  field_face->array_to_face (msg->a, field);
+
+  delete field_face;
+  delete msg;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverMgAmr::end_solve_(Block * block) throw()
+{
+  deallocate_temporary_(block);
+
+  Solver::end_(block);
+}
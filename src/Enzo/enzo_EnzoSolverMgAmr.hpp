@@ -0,0 +1,348 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverMgAmr.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Enzo] Declaration of EnzoSolverMgAmr
+///
+/// Full approximation scheme (FAS) multigrid V-cycle on the adaptive
+/// mesh hierarchy
+
+#ifndef ENZO_ENZO_SOLVER_MG_AMR_HPP
+#define ENZO_ENZO_SOLVER_MG_AMR_HPP
+
+class EnzoSolverMgAmr : public Solver {
+
+  /// @class    EnzoSolverMgAmr
+  /// @ingroup  Enzo
+  ///
+  /// @brief [\ref Enzo] FAS multigrid V-cycle on the refined mesh
+  /// hierarchy.  Unlike EnzoSolverMg0, leaf Blocks on every level
+  /// participate: each mesh level between coarse_level and the finest
+  /// level is smoothed with weighted Jacobi, restricted, and corrected
+  /// as soon as its own children (not the whole level) are done, with
+  /// ghost zones updated by refreshes on that level only.  Intended
+  /// mainly as a preconditioner for EnzoSolverBiCgStab on AMR problems.
+
+public: // interface
+
+  /// Create a new EnzoSolverMgAmr object
+  EnzoSolverMgAmr
+  (std::string name,
+   std::string field_x,
+   std::string field_b,
+   int monitor_iter,
+   int restart_cycle,
+   int solve_type,
+   int index_prolong,
+   int index_restrict,
+   int min_level,
+   int max_level,
+   int iter_max,
+   double res_tol,
+   int index_solve_coarse,
+   int coarse_level,
+   double weight,
+   int num_pre_smooth,
+   int num_post_smooth);
+
+  EnzoSolverMgAmr() {};
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(EnzoSolverMgAmr);
+
+  /// Charm++ PUP::able migration constructor
+  EnzoSolverMgAmr (CkMigrateMessage *m)
+    :  Solver(m),
+       rr_(0), rr0_(0),
+       res_tol_(0),
+       iter_max_(0),
+       A_(nullptr),
+       index_solve_coarse_(-1),
+       coarse_level_(0),
+       weight_(1.0),
+       num_pre_smooth_(0),
+       num_post_smooth_(0),
+       ir_(-1), ic_(-1), if_(-1), id_(-1),
+       ir_leaf_(-1),
+       i_sync_restrict_(-1),
+       i_sync_prolong_(-1),
+       i_msg_restrict_(),
+       i_msg_prolong_(-1),
+       i_iter_(-1),
+       i_smooth_(-1),
+       i_refresh_(-1),
+       i_rr_local_(-1),
+       mx_(0),my_(0),mz_(0),
+       gx_(0),gy_(0),gz_(0)
+  {
+    for (int i=0; i<2; i++) ir_pre_smooth_[i] = -1;
+    for (int i=0; i<2; i++) ir_post_smooth_[i] = -1;
+    for (int i=0; i<8; i++) i_msg_restrict_[i] = -1;
+  }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  {
+
+    // NOTE: change this function whenever attributes change
+
+    TRACEPUP;
+
+    Solver::pup(p);
+
+    p | rr_;
+    p | rr0_;
+    p | res_tol_;
+    p | iter_max_;
+    //    p | A_;
+    p | index_solve_coarse_;
+    p | coarse_level_;
+    p | weight_;
+    p | num_pre_smooth_;
+    p | num_post_smooth_;
+
+    p | ir_;
+    p | ic_;
+    p | if_;
+    p | id_;
+
+    p | ir_leaf_;
+    PUParray(p,ir_pre_smooth_,2);
+    PUParray(p,ir_post_smooth_,2);
+
+    p | i_sync_restrict_;
+    p | i_sync_prolong_;
+    PUParray(p,i_msg_restrict_,8);
+    p | i_msg_prolong_;
+    p | i_iter_;
+    p | i_smooth_;
+    p | i_refresh_;
+    p | i_rr_local_;
+
+    p | mx_;
+    p | my_;
+    p | mz_;
+    p | gx_;
+    p | gy_;
+    p | gz_;
+  }
+
+  /// Solve the linear system
+  virtual void apply ( std::shared_ptr<Matrix> A, Block * block) throw();
+
+  /// Type of this solver
+  virtual std::string type() const { return "mg_amr"; }
+
+  /// Start the level refresh of X on a leaf Block after the leaf
+  /// refresh has updated its coarse-fine ghost zones
+  void descend(EnzoBlock * enzo_block) throw();
+
+  /// Pre-smooth the Block's level, then restrict to the parent
+  void pre_smooth(EnzoBlock * enzo_block) throw();
+
+  /// Receive restricted X and R from a child Block
+  void restrict_recv(EnzoBlock * enzo_block, FieldMsg * msg) throw();
+
+  /// Continue after the coarse-grid solve
+  void solve_coarse(EnzoBlock * enzo_block) throw();
+
+  /// Receive the coarse-grid correction from the parent Block
+  void prolong_recv(EnzoBlock * enzo_block, FieldMsg * msg) throw();
+
+  /// Post-smooth the Block's level, then prolong to the children
+  void post_smooth(EnzoBlock * enzo_block) throw();
+
+  /// Check convergence after the global residual reduction
+  void end_cycle(EnzoBlock * enzo_block, CkReductionMsg * msg) throw();
+
+  /// Access the restrict Sync Scalar value for the Block
+  Sync * psync_restrict(Block * block)
+  {
+    ScalarData<Sync> * scalar_data = block->data()->scalar_data_sync();
+    ScalarDescr *      scalar_descr = cello::scalar_descr_sync();
+    return scalar_data->value(scalar_descr,i_sync_restrict_);
+  }
+
+  /// Access the prolong Sync Scalar value for the Block
+  Sync * psync_prolong(Block * block)
+  {
+    ScalarData<Sync> * scalar_data = block->data()->scalar_data_sync();
+    ScalarDescr *      scalar_descr = cello::scalar_descr_sync();
+    return scalar_data->value(scalar_descr,i_sync_prolong_);
+  }
+
+  /// Access the V-cycle counter for the Block
+  int * piter(Block * block)
+  {
+    ScalarData<int> * scalar_data = block->data()->scalar_data_int();
+    ScalarDescr *      scalar_descr = cello::scalar_descr_int();
+    return scalar_data->value(scalar_descr,i_iter_);
+  }
+
+  /// Access the smoothing sweep counter for the Block
+  int * psmooth(Block * block)
+  {
+    ScalarData<int> * scalar_data = block->data()->scalar_data_int();
+    ScalarDescr *      scalar_descr = cello::scalar_descr_int();
+    return scalar_data->value(scalar_descr,i_smooth_);
+  }
+
+  /// Access the level refresh counter for the Block
+  int * prefresh(Block * block)
+  {
+    ScalarData<int> * scalar_data = block->data()->scalar_data_int();
+    ScalarDescr *      scalar_descr = cello::scalar_descr_int();
+    return scalar_data->value(scalar_descr,i_refresh_);
+  }
+
+  /// Access the Block's contribution to the residual norm R'*R
+  long double * prr_local(Block * block)
+  {
+    ScalarData<long double> * scalar_data =
+      block->data()->scalar_data_long_double();
+    ScalarDescr * scalar_descr = cello::scalar_descr_long_double();
+    return scalar_data->value(scalar_descr,i_rr_local_);
+  }
+
+  /// Access the Field message for buffering prolongation data
+  FieldMsg ** pmsg_prolong(Block * block)
+  {
+    ScalarData<void *> * scalar_data = block->data()->scalar_data_void();
+    ScalarDescr *        scalar_descr = cello::scalar_descr_void();
+    return (FieldMsg **)scalar_data->value(scalar_descr,i_msg_prolong_);
+  }
+
+  /// Access the Field message for buffering restriction data
+  FieldMsg ** pmsg_restrict(Block * block, int ic)
+  {
+    ScalarData<void *> * scalar_data = block->data()->scalar_data_void();
+    ScalarDescr *        scalar_descr = cello::scalar_descr_void();
+    return (FieldMsg **)scalar_data->value(scalar_descr,i_msg_restrict_[ic]);
+  }
+
+protected: // methods
+
+  /// Begin a V-cycle: leaves start descending, parents wait for
+  /// their children, and Blocks below coarse_level go straight to
+  /// the coarse solver
+  void begin_cycle_(EnzoBlock * enzo_block) throw();
+
+  /// Refresh X on the Block's level, continuing with the pre- or
+  /// post-smoother
+  void refresh_level_(EnzoBlock * enzo_block, bool pre) throw();
+
+  /// One weighted Jacobi sweep X += w*(F - A*X)/D on the Block
+  void smooth_(EnzoBlock * enzo_block) throw();
+
+  /// Compute R = F - A*X on the Block, accumulating R'*R on leaves
+  void compute_residual_(EnzoBlock * enzo_block) throw();
+
+  /// Call coarse solver--must be called by all blocks
+  void call_coarse_solver_(EnzoBlock * enzo_block) throw();
+
+  /// Send the restricted X and R to the parent Block
+  void restrict_send_(EnzoBlock * enzo_block) throw();
+
+  /// Send the correction X - C to the child Blocks
+  void prolong_send_(EnzoBlock * enzo_block) throw();
+
+  /// Contribute to the global residual reduction ending the V-cycle
+  void end_level_(EnzoBlock * enzo_block) throw();
+
+  /// Pack and unpack X and R for restricting to the parent
+  FieldMsg * pack_restrict_(EnzoBlock * enzo_block) throw();
+  void unpack_restrict_(EnzoBlock * enzo_block, FieldMsg * msg) throw();
+
+  /// Pack and unpack the correction for prolonging to a child
+  FieldMsg * pack_correction_(EnzoBlock * enzo_block, int ic3[3]) throw();
+  void unpack_correction_(EnzoBlock * enzo_block, FieldMsg * msg) throw();
+
+  /// Register a Refresh object on X with the given neighbor and
+  /// sync types
+  int new_refresh_(int neighbor_type, int sync_type, int callback,
+                   std::string name);
+
+  /// Whether the Block takes part in the V-cycle
+  bool is_active_(Block * block) const
+  { return block->level() >= coarse_level_; }
+
+  /// Exit the solver
+  void end_solve_(Block * block) throw();
+
+  /// Allocate temporary Fields
+  void allocate_temporary_(Block * block)
+  {
+    Field field = block->data()->field();
+    field.allocate_temporary(ir_);
+    field.allocate_temporary(ic_);
+    field.allocate_temporary(if_);
+    field.allocate_temporary(id_);
+  }
+
+  /// Dellocate temporary Fields
+  void deallocate_temporary_(Block * block)
+  {
+    Field field = block->data()->field();
+    field.deallocate_temporary(ir_);
+    field.deallocate_temporary(ic_);
+    field.deallocate_temporary(if_);
+    field.deallocate_temporary(id_);
+  }
+
+protected: // attributes
+
+  /// Current and initial residual norm R'*R over leaf Blocks
+  double rr_;
+  double rr0_;
+
+  /// Convergence tolerance on the residual reduction rr_ / rr0_
+  double res_tol_;
+
+  /// Maximum number of V-cycles
+  int iter_max_;
+
+  /// Matrix
+  std::shared_ptr<Matrix> A_;
+
+  /// Solver for the coarse level
+  int index_solve_coarse_;
+
+  /// The level of the coarse grid solve
+  int coarse_level_;
+
+  /// Jacobi smoother weighting and number of sweeps
+  double weight_;
+  int num_pre_smooth_;
+  int num_post_smooth_;
+
+  /// Temporary fields: residual / correction R, saved restricted
+  /// solution C, level right-hand side F, and diagonal D
+  int ir_;
+  int ic_;
+  int if_;
+  int id_;
+
+  /// Refresh id's: leaf refresh starting the cycle, and level
+  /// refreshes alternating between two id's so that a fast neighbor
+  /// cannot send the next sweep's ghosts into the current refresh
+  int ir_leaf_;
+  int ir_pre_smooth_[2];
+  int ir_post_smooth_[2];
+
+  /// Scalar id's
+  int i_sync_restrict_;
+  int i_sync_prolong_;
+  int i_msg_restrict_[8];
+  int i_msg_prolong_;
+  int i_iter_;
+  int i_smooth_;
+  int i_refresh_;
+  int i_rr_local_;
+
+  /// Block field attributes
+  int mx_,my_,mz_;
+  int gx_,gy_,gz_;
+};
+
+#endif /* ENZO_ENZO_SOLVER_MG_AMR_HPP */
@@ -33,12 +33,21 @@ public: // interface
     //    p | file_;
     p | sync_blocks_;
     //    p | io_msg_check_;
+    p | block_names_;
+    p | num_blocks_unread_;
+    p | prefetch_;
+    p | prefetch_level_;
+    p | prefetch_index_;
   }
 
   /// Send data to existing root blocks
   void p_init_root
   (std::string name_dir, std::string name_file, int max_level);
 
+  /// Open the file and send data to existing root blocks once admitted
+  /// by the IoAdmission service
+  void p_init_root_read();
+
   /// Create blocks in the given level
   void p_create_level(int level);
 
@@ -52,6 +61,9 @@ public: // interface
   /// Received acknowledgement that the block is done
   void p_block_ready();
 
+  /// Read the next unread refined Block in the background
+  void p_prefetch();
+
 protected: // functions
 
   /// update synchronization given that the given block is done
@@ -61,6 +73,13 @@ protected: // functions
   void file_open_block_list_(std::string name_dir, std::string name_file);
   void file_read_block_(EnzoMsgCheck * msg_check, std::string file_name,
                         IoEnzoBlock * io_block);
+
+  /// Read the i'th Block in the given level if not already read,
+  /// closing the file after the last Block is read
+  EnzoMsgCheck * read_block_(int level, int i);
+
+  /// Read all unread Blocks in the given level
+  void read_level_(int level);
   bool read_block_list_(std::string & block_name, int & level);
   void file_close_block_list_();
 
@@ -93,6 +112,20 @@ private: // attributes
   /// List of blocks in the file by level (negative blocks included in
   /// level 0
   std::vector< std::vector<EnzoMsgCheck *> > io_msg_check_;
+
+  /// Names of blocks in the file by level (negative blocks included
+  /// in level 0)
+  std::vector< std::vector<std::string> > block_names_;
+
+  /// Number of blocks in the file not yet read
+  int num_blocks_unread_;
+
+  /// Whether to read refined blocks in the background
+  bool prefetch_;
+
+  /// Level and index of the next block to prefetch
+  int prefetch_level_;
+  int prefetch_index_;
 };
 
 #endif /* ENZO_IO_ENZO_READER_HPP */
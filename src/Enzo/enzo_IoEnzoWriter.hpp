@@ -22,13 +22,24 @@ public: // interface
     ordering_(""),
     stream_block_list_(),
     file_(nullptr),
-    monitor_iter_(0)
+    monitor_iter_(0),
+    window_(1),
+    msg_map_(),
+    index_next_map_(),
+    index_block_write_(-1),
+    index_block_tail_(-1),
+    index_block_last_(-1),
+    num_credit_(0),
+    is_admitted_(false),
+    is_requested_(false),
+    zeros_()
   {  }
 
   /// Constructor
   IoEnzoWriter(int num_files,
                std::string ordering,
-               int monitor_iter) throw();
+               int monitor_iter,
+               int window) throw();
 
   /// CHARM++ migration constructor
   IoEnzoWriter(CkMigrateMessage *m) : CBase_IoEnzoWriter(m) {}
@@ -41,12 +52,16 @@ public: // interface
     p | num_files_;
     p | ordering_;
     p | monitor_iter_;
+    p | window_;
   }
 
 public: // entry methods
 
   void p_write(EnzoMsgCheck *);
 
+  /// Start writing once admitted by the IoAdmission service
+  void p_write_admitted();
+
   // void r_created(CkReductionMsg *msg);
 
 protected: // functions
@@ -60,6 +75,17 @@ protected: // functions
   void write_block_list_(std::string block_name, int level);
   void close_block_list_();
 
+  /// Write the given Block's data, opening or closing the file as needed
+  void write_msg_check_(EnzoMsgCheck * msg_check);
+
+  /// Write all received Blocks that are next in order, and refill
+  /// the window
+  void write_ready_();
+
+  /// Request data from the Blocks following the current window, one
+  /// for each Block written since the last request
+  void request_next_();
+
 protected: // attributes
 
   // NOTE: change pup() function whenever attributes change
@@ -77,6 +103,36 @@ protected: // attributes
   /// How often to output write status wrt block indices in first
   /// file; 0 for no output
   int monitor_iter_;
+
+  /// Maximum number of Blocks whose data have been requested but not
+  /// yet written
+  int window_;
+
+  /// Block data received ahead of the next Block to write, by index
+  std::map<long long, EnzoMsgCheck *> msg_map_;
+
+  /// Index of the next Block in the ordering for each Block received
+  std::map<long long, Index> index_next_map_;
+
+  /// Ordering index of the next Block to write, or -1 if not known
+  long long index_block_write_;
+
+  /// Ordering index of the last Block whose data have been requested
+  long long index_block_tail_;
+
+  /// Ordering index of the last Block in this file, or -1 if not known
+  long long index_block_last_;
+
+  /// Number of Blocks written since data were last requested
+  int num_credit_;
+
+  /// Whether the IoAdmission service has admitted this writer for the
+  /// current checkpoint, and whether admission has been requested
+  bool is_admitted_;
+  bool is_requested_;
+
+  /// Buffer of zeros for writing ghost zones (not pup'ed)
+  std::vector<char> zeros_;
 };
 
 #endif /* ENZO_IO_ENZO_WRITER_HPP */
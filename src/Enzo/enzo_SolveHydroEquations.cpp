@@ -90,19 +90,25 @@ int EnzoBlock::SolveHydroEquations
   enzo_float * velocity_y = NULL;
   enzo_float * velocity_z = NULL;
 
+  // Solver temporaries are taken from the per-PE scratch arena, which
+  // is reused across Blocks and cycles instead of calling new / delete
+
+  ScratchArena * scratch = ScratchArena::instance();
+  const ScratchArena::Mark scratch_mark = scratch->mark();
+
   velocity_x = (enzo_float *) field.values("velocity_x");
 
   if (rank >= 2) {
     velocity_y = (enzo_float *) field.values("velocity_y");
   } else {
-    velocity_y = new enzo_float[size];
+    velocity_y = scratch->allocate<enzo_float>(size);
     for (int i=0; i<size; i++) velocity_y[i] = 0.0;
   }
 
     if (rank >= 3) {
     velocity_z = (enzo_float *) field.values("velocity_z");
   } else {
-    velocity_z = new enzo_float[size];
+    velocity_z = scratch->allocate<enzo_float>(size);
     for (int i=0; i<size; i++) velocity_z[i] = 0.0;
   }
 
@@ -155,7 +161,7 @@ int EnzoBlock::SolveHydroEquations
 			 GridDimension[1]*GridDimension[2]),
 		     GridDimension[2]*GridDimension[0]);
 
-  enzo_float *temp = new enzo_float[tempsize*(32+ncolor*4)];
+  enzo_float *temp = scratch->allocate<enzo_float>(tempsize*(32+ncolor*4));
 
   /* create and fill in arrays which are easier for the solver to
      understand. */
@@ -271,7 +277,7 @@ int EnzoBlock::SolveHydroEquations
 
   enzo_float * CellWidthTemp[MAX_DIMENSION];
   for (dim = 0; dim < MAX_DIMENSION; dim++) {
-    CellWidthTemp[dim] = new enzo_float [GridDimension[dim]];
+    CellWidthTemp[dim] = scratch->allocate<enzo_float>(GridDimension[dim]);
     if (dim < rank) {
       for (int i=0; i<GridDimension[dim]; i++)
 	CellWidthTemp[dim][i] = (cosmo_a*CellWidth[dim]);
@@ -343,15 +349,9 @@ int EnzoBlock::SolveHydroEquations
   }
 #endif
 
-  for (dim = 0; dim < MAX_DIMENSION; dim++) {
-    delete [] CellWidthTemp[dim];
-  }
-
   /* deallocate temporary space for solver */
 
-  delete [] temp;
-  if (rank < 2) delete [] velocity_y;
-  if (rank < 3) delete [] velocity_z;
+  scratch->release(scratch_mark);
 
   delete [] array;
 
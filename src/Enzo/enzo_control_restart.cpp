@@ -136,7 +136,12 @@ IoEnzoReader::IoEnzoReader()
     stream_block_list_(),
     file_(nullptr),
     sync_blocks_(),
-    io_msg_check_()
+    io_msg_check_(),
+    block_names_(),
+    num_blocks_unread_(0),
+    prefetch_(cello::config()->initial_restart_prefetch),
+    prefetch_level_(1),
+    prefetch_index_(0)
 {
   
   proxy_enzo_simulation.p_io_reader_created();
@@ -150,6 +155,7 @@ void EnzoSimulation::p_io_reader_created()
   // Wait for all io_readers to be created
   TRACE_SYNC(sync_restart_created_,"sync_restart_created_ next()");
   if (sync_restart_created_.next()) {
+    restart_timer_.start();
     // distribute array proxy to other simulation objects
     proxy_enzo_simulation.p_set_io_reader(proxy_io_enzo_reader);
   }
@@ -198,12 +204,26 @@ void IoEnzoReader::p_init_root
   name_file_ = name_file;
   max_level_ = max_level;
 
-  io_msg_check_.resize(max_level+1);
+  // Wait until the number of concurrent readers is below the
+  // Performance:io:tokens limit if any
+  if (cello::io_admission()->is_active()) {
+    cello::io_admission()->acquire
+      (CkCallback(CkIndex_IoEnzoReader::p_init_root_read(),
+                  thisProxy[thisIndex]));
+  } else {
+    p_init_root_read();
+  }
+}
+
+//----------------------------------------------------------------------
 
-  stream_block_list_ = stream_open_blocks_(name_dir, name_file);
+void IoEnzoReader::p_init_root_read()
+{
+  TRACE_READER("p_init_root_read()",this);
+  stream_block_list_ = stream_open_blocks_(name_dir_, name_file_);
 
   // open the HDF5 file
-  file_open_block_list_(name_dir,name_file);
+  file_open_block_list_(name_dir_,name_file_);
 
   sync_blocks_.reset();
   TRACE_SYNC(sync_blocks_,"sync_blocks_ reset()");
@@ -211,91 +231,131 @@ void IoEnzoReader::p_init_root
   // Read global attributes
   file_read_hierarchy_();
 
-  std::vector<std::string> block_name_list;
-  std::vector<int>         block_level_list;
-  std::vector<int> blocks_in_level;
-  blocks_in_level.resize(max_level+1);
+  // Read list of blocks and associated refinement levels up front
+  block_names_.resize(max_level_+1);
   {
     std::string block_name;
     int block_level;
-    // Read list of blocks and associated refinement levels
     while (read_block_list_(block_name,block_level)) {
 
-      // save block name and level
-      block_name_list.push_back(block_name);
-      block_level_list.push_back(block_level);
-
+      // count root-level blocks for synchronization
+      // (including negative level blocks)
       if (block_level <= 0) {
-        // count root-level blocks for synchronization
-        // (including negative level blocks)
         ++ sync_blocks_;
         TRACE_SYNC(sync_blocks_,"sync_blocks_ inc_stop(1)");
-      } else {
-        // count blocks per refined level for array allocation below
-        ++blocks_in_level[block_level];
       }
+      block_names_[std::max(block_level,0)].push_back(block_name);
+      ++num_blocks_unread_;
     }
   }
-  // Allocate io_msg_check_ array
-  io_msg_check_.resize(max_level+1);
-  for (int level=1; level<=max_level; level++) {
-    io_msg_check_[level].resize(blocks_in_level[level]);
+
+  if (num_blocks_unread_ == 0) {
+    file_close_block_list_();
   }
 
-  // initialize vector of array offsets into io_msg_check_ for each level
-  std::vector<int> level_index;
-  level_index.resize(max_level+1);
-  std::fill(level_index.begin(), level_index.end(), 0);
+  io_msg_check_.resize(max_level_+1);
+  for (int level=0; level<=max_level_; level++) {
+    io_msg_check_[level].resize(block_names_[level].size(),nullptr);
+  }
 
-  // Save block's meta-data and initialize root-level blocks
-  for (int i=0; i<block_name_list.size(); i++) {
+  // Read root-level blocks and send their data to the existing Blocks
+  const int num_blocks_root = block_names_[0].size();
+  for (int i=0; i<num_blocks_root; i++) {
 
-    // Increment block counter so know when to alert pe=0 when done
-    const int block_level = block_level_list[i];
-    std::string block_name = block_name_list[i];
-    int i_level = level_index[std::max(block_level,0)]++;
+    EnzoMsgCheck * msg_check = read_block_(0,i);
+    // Block deletes the message after its data are set
+    io_msg_check_[0][i] = nullptr;
 
-    // For each Block in the file, read the block data and create the
-    // new Block
+    // get Block's index
+    int v3[3];
+    msg_check->io_block_->index(v3);
+    Index index;
+    index.set_values(v3);
 
-    EnzoMsgCheck * msg_check = new EnzoMsgCheck;
+#ifdef DEBUG_RESTART
+    msg_check->print("send");
+    msg_check->data_msg_->print("send");
+#endif
+    enzo::block_array()[index].p_restart_set_data(msg_check);
+  }
+
+  // Read refined blocks while the root level is being initialized.
+  // Always read ahead if the number of readers is limited, since the
+  // IoAdmission token is only released when the file is closed, and
+  // other readers may be waiting for it before the next level starts
+  if ((prefetch_ || cello::io_admission()->is_active()) &&
+      num_blocks_unread_ > 0) {
+    thisProxy[thisIndex].p_prefetch();
+  }
+}
+
+//----------------------------------------------------------------------
 
-    // Save msg_check for later if block is in a refined level
-    if (block_level > 0) {
-      io_msg_check_[block_level][i_level] = msg_check;
+void IoEnzoReader::p_prefetch()
+{
+  TRACE_READER("p_prefetch()",this);
+
+  // skip levels and blocks already read on demand
+  while (prefetch_level_ <= max_level_ &&
+         (prefetch_index_ >= int(io_msg_check_[prefetch_level_].size()) ||
+          io_msg_check_[prefetch_level_][prefetch_index_] != nullptr)) {
+    if (prefetch_index_ >= int(io_msg_check_[prefetch_level_].size())) {
+      ++prefetch_level_;
+      prefetch_index_ = 0;
+    } else {
+      ++prefetch_index_;
     }
+  }
 
-    // create new IoEnzoBlock object for root blocks, use io_msg_check_
-    // element for refined blocks
-    IoEnzoBlock * io_enzo_block = new IoEnzoBlock;
+  if (prefetch_level_ > max_level_) return;
 
-    file_read_block_ (msg_check, block_name, io_enzo_block);
+  // read one block, then yield so other messages can be processed
+  read_block_(prefetch_level_,prefetch_index_++);
 
-    // save this file IoReader index
-    msg_check->index_file_ = thisIndex;
+  if (num_blocks_unread_ > 0) {
+    thisProxy[thisIndex].p_prefetch();
+  }
+}
 
-    // get Block's index
-    int v3[3];
-    msg_check->io_block_->index(v3);
-    Index index;
-    index.set_values(v3);
+//----------------------------------------------------------------------
 
-    // if non-refined block, initialize
-    if (block_level <= 0) {
+EnzoMsgCheck * IoEnzoReader::read_block_(int level, int i)
+{
+  EnzoMsgCheck * msg_check = io_msg_check_[level][i];
 
-      // Block exists--send its data
-#ifdef DEBUG_RESTART
-      msg_check->print("send");
-      msg_check->data_msg_->print("send");
-#endif
-      enzo::block_array()[index].p_restart_set_data(msg_check);
+  if (msg_check == nullptr) {
+
+    msg_check = new EnzoMsgCheck;
+    io_msg_check_[level][i] = msg_check;
 
+    IoEnzoBlock * io_enzo_block = new IoEnzoBlock;
+
+    file_read_block_ (msg_check, block_names_[level][i], io_enzo_block);
+
+    // save this file IoReader index
+    msg_check->index_file_ = thisIndex;
+
+    // close the HDF5 file after the last block is read
+    if (--num_blocks_unread_ == 0) {
+      file_close_block_list_();
     }
   }
+  return msg_check;
+}
 
-  // close the HDF5 file
-  file_close_block_list_();
+//----------------------------------------------------------------------
 
+void IoEnzoReader::read_level_(int level)
+{
+  const int num_blocks_level = io_msg_check_[level].size();
+  for (int i=0; i<num_blocks_level; i++) {
+    read_block_(level,i);
+  }
+  // don't prefetch this level again
+  if (prefetch_level_ <= level) {
+    prefetch_level_ = level + 1;
+    prefetch_index_ = 0;
+  }
 }
 
 //----------------------------------------------------------------------
@@ -345,6 +405,11 @@ void EnzoSimulation::p_restart_next_level()
   TRACE_SIMULATION("EnzoSimulation::p_restart_next_level()",this);
   TRACE_SYNC(sync_restart_next_,"sync_restart_next_ next()");
   if (sync_restart_next_.next()) {
+    cello::monitor()->print
+      ("Restart","level %d restarted in %.3f s",
+       restart_level_,restart_timer_.value());
+    restart_timer_.clear();
+    restart_timer_.start();
     const int max_level = cello::config()->mesh_max_level;
     if (++restart_level_ <= max_level) {
       proxy_io_enzo_reader.p_create_level(restart_level_);
@@ -362,6 +427,8 @@ void EnzoSimulation::p_restart_next_level()
 void IoEnzoReader::p_create_level (int level)
 {
   TRACE_READER("p_create_level()",this);
+  // read any of the level's blocks not already prefetched
+  read_level_(level);
   const int num_blocks_level = io_msg_check_[level].size();
   sync_blocks_.reset();
   sync_blocks_.set_stop(num_blocks_level+1);
@@ -481,6 +548,8 @@ void IoEnzoReader::p_init_level (int level)
   for (int i=0; i<num_blocks_level; i++) {
 
     EnzoMsgCheck * msg_check = io_msg_check_[level][i];
+    // Block deletes the message after its data are set
+    io_msg_check_[level][i] = nullptr;
 
     // Get the current Block's index
     IoBlock * io_block = msg_check->io_block();
@@ -489,7 +558,6 @@ void IoEnzoReader::p_init_level (int level)
     Index index;
     index.set_values(i3);
 
-    msg_check->index_file_ = thisIndex;
 #ifdef DEBUG_RESTART
     msg_check->print("send");
     msg_check->data_msg_->print("send");
@@ -857,5 +925,8 @@ void IoEnzoReader::file_close_block_list_()
   file_->data_close();
   file_->file_close();
   delete file_;
+  // Allow the next reader or writer waiting for the IoAdmission
+  // service to start
+  cello::io_admission()->release();
 }
 
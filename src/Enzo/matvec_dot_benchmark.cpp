@@ -0,0 +1,240 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     matvec_dot_benchmark.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Throughput benchmark for the fused Laplacian matvec and dot products
+///
+/// usage: matvec_dot_benchmark [block_size [repeats]]
+///
+/// Applies the order-2 and order-4 Laplacians to a random 3D block of
+/// `block_size`^3 cells with 3 ghost zones, `repeats` times, accumulating
+/// DOT(Y,W), DOT(Y,Y) and SUM(Y) as in the BiCgStab solver, and reports the
+/// throughput in cells per second for:
+///
+///   - "reference": the triple loop previously used by EnzoMatrixLaplace,
+///     followed by a separate pass for the dot products (as in
+///     Matrix::matvec_dot())
+///   - "fused": enzo_matrix_laplace::matvec_3d() in
+///     enzo_EnzoMatrixLaplaceKernels.hpp
+///
+/// The results must agree to roundoff, and the dot product with the
+/// output Y itself (V[k] == Y) must be bitwise identical to the dot
+/// product with a copy of Y.  The program exits with status 1 if any check
+/// fails.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "enzo_EnzoMatrixLaplaceKernels.hpp"
+
+using namespace enzo_matrix_laplace;
+
+#ifdef CONFIG_PRECISION_SINGLE
+typedef float real;
+const double tolerance = 1e-4;
+#else
+typedef double real;
+const double tolerance = 1e-11;
+#endif
+
+/// Number of dot products: DOT(Y,W), DOT(Y,Y), SUM(Y)
+const int num_dot = 3;
+
+//----------------------------------------------------------------------
+
+/// Uniform random number in [lo,hi) from a fixed-seed generator
+static double uniform (double lo, double hi)
+{
+  static unsigned long long state = 12345;
+  state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+  return lo + (hi - lo) * ((state >> 11) * (1.0 / 9007199254740992.0));
+}
+
+//----------------------------------------------------------------------
+
+/// The rank-3 stencils previously used by EnzoMatrixLaplace::matvec_()
+template <int ORDER>
+static void matvec_reference (real * Y, const real * X, int m, double h)
+{
+  const int idx = 1;
+  const int idy = m;
+  const int idz = m*m;
+  const int g0 = ORDER/2;
+
+  if (ORDER == 2) {
+    const double d = 1.0 / (h*h);
+    for     (int iz=g0; iz<m-g0; iz++) {
+      for   (int iy=g0; iy<m-g0; iy++) {
+        for (int ix=g0; ix<m-g0; ix++) {
+          const int i = ix + m*(iy + m*iz);
+          Y[i] = ( X[i+idx] - 2.0*X[i] + X[i-idx]) * d
+            +    ( X[i+idy] - 2.0*X[i] + X[i-idy]) * d
+            +    ( X[i+idz] - 2.0*X[i] + X[i-idz]) * d;
+        }
+      }
+    }
+  } else {
+    const real d = 1.0/(12.0*h*h);
+    const real c0 = real(-30.0)*d;
+    const real c1 = real(16.0)*d;
+    const real c2 = real(-1.0)*d;
+    for     (int iz=g0; iz<m-g0; iz++) {
+      for   (int iy=g0; iy<m-g0; iy++) {
+        for (int ix=g0; ix<m-g0; ix++) {
+          const int i = ix + m*(iy + m*iz);
+          Y[i] = (c0*(X[i]) +
+                  c1*(X[i-idx]  +X[i+idx]) +
+                  c2*(X[i-2*idx]+X[i+2*idx]))
+            +    (c0*(X[i]) +
+                  c1*(X[i-idy]  +X[i+idy]) +
+                  c2*(X[i-2*idy]+X[i+2*idy]))
+            +    (c0*(X[i]) +
+                  c1*(X[i-idz]  +X[i+idz]) +
+                  c2*(X[i-2*idz]+X[i+2*idz]));
+        }
+      }
+    }
+  }
+}
+
+/// The separate dot product pass of Matrix::matvec_dot().  Also
+/// accumulates the sums of absolute values of the terms in norm
+static void dot_reference (const real * y, real * const * v, int m, int g,
+                           long double * dot, long double * norm)
+{
+  for (int k=0; k<num_dot; k++) {
+    long double sum = 0.0, sum_abs = 0.0;
+    for (int iz=g; iz<m-g; iz++) {
+      for (int iy=g; iy<m-g; iy++) {
+        for (int ix=g; ix<m-g; ix++) {
+          const int i=ix + m*(iy + m*iz);
+          const long double term = v[k] ? y[i]*v[k][i] : y[i];
+          sum += term;
+          sum_abs += std::fabs(term);
+        }
+      }
+    }
+    dot[k] += sum;
+    norm[k] += sum_abs;
+  }
+}
+
+//----------------------------------------------------------------------
+
+static bool check (const char * name, bool ok)
+{
+  printf ("%-32s %s\n", name, ok ? "pass" : "FAIL");
+  return ok;
+}
+
+//----------------------------------------------------------------------
+
+int main (int argc, char ** argv)
+{
+  const int n       = (argc > 1) ? atoi(argv[1]) : 64;
+  const int repeats = (argc > 2) ? atoi(argv[2]) : 20;
+  const int g = 3;
+  const int m = n + 2*g;
+  const int mmm = m*m*m;
+  const double h = 1.0 / n;
+  const int g3[3] = {g, g, g};
+
+  std::vector<real> x(mmm), w(mmm);
+  for (int i = 0; i < mmm; i++) {
+    x[i] = uniform(-1.0, 1.0);
+    w[i] = uniform(-1.0, 1.0);
+  }
+
+  printf ("block %d^3  repeats %d  precision %s\n",
+          n, repeats, (sizeof(real) == 4) ? "single" : "double");
+  printf ("%-10s %5s %14s %9s\n", "kernel", "order", "cells/sec", "speedup");
+
+  bool ok = true;
+  const double cells = double(repeats)*n*n*n;
+
+  for (int order = 2; order <= 4; order += 2) {
+
+    // reference: matvec followed by dot products
+
+    std::vector<real> y_ref(mmm, 0.0);
+    real * v_ref[num_dot] = { w.data(), y_ref.data(), nullptr };
+    long double dot_ref[num_dot], norm[num_dot];
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++) {
+      std::fill_n (dot_ref, num_dot, 0.0);
+      std::fill_n (norm, num_dot, 0.0);
+      if (order == 2) matvec_reference<2> (y_ref.data(), x.data(), m, h);
+      else            matvec_reference<4> (y_ref.data(), x.data(), m, h);
+      dot_reference (y_ref.data(), v_ref, m, g, dot_ref, norm);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    const double rate_reference =
+      cells / std::chrono::duration<double>(t1 - t0).count();
+    printf ("%-10s %5d %14.4e %9.2f\n", "reference", order,
+            rate_reference, 1.0);
+
+    // fused, with V[1] the output Y itself
+
+    std::vector<real> y(mmm, 0.0);
+    real * v[num_dot] = { w.data(), y.data(), nullptr };
+    long double dot[num_dot];
+
+    t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++) {
+      std::fill_n (dot, num_dot, 0.0);
+      if (order == 2) {
+        matvec_3d<2> (y.data(), x.data(), m,m,m, h,h,h, 1,
+                      num_dot, v, dot, g3);
+      } else {
+        matvec_3d<4> (y.data(), x.data(), m,m,m, h,h,h, 1,
+                      num_dot, v, dot, g3);
+      }
+    }
+    t1 = std::chrono::steady_clock::now();
+    const double rate =
+      cells / std::chrono::duration<double>(t1 - t0).count();
+    printf ("%-10s %5d %14.4e %9.2f\n", "fused", order,
+            rate, rate / rate_reference);
+
+    char name[64];
+
+    double y_max = 0.0, y_diff = 0.0;
+    for (int i = 0; i < mmm; i++) {
+      y_max  = std::max(y_max, std::fabs(double(y_ref[i])));
+      y_diff = std::max(y_diff, std::fabs(double(y[i]) - double(y_ref[i])));
+    }
+    snprintf (name, sizeof(name), "order %d matvec", order);
+    ok &= check (name, y_diff <= tolerance*y_max);
+
+    const char * dot_name[num_dot] = { "DOT(Y,W)", "DOT(Y,Y)", "SUM(Y)" };
+    for (int k = 0; k < num_dot; k++) {
+      snprintf (name, sizeof(name), "order %d %s", order, dot_name[k]);
+      ok &= check (name, std::fabs(double(dot[k] - dot_ref[k]))
+                   <= tolerance*double(norm[k]));
+    }
+
+    // the aliased dot product must match the dot product with a copy
+
+    std::vector<real> y_copy(y), y_2(mmm, 0.0);
+    real * v_copy[num_dot] = { w.data(), y_copy.data(), nullptr };
+    long double dot_copy[num_dot] = { 0.0, 0.0, 0.0 };
+    if (order == 2) {
+      matvec_3d<2> (y_2.data(), x.data(), m,m,m, h,h,h, 1,
+                    num_dot, v_copy, dot_copy, g3);
+    } else {
+      matvec_3d<4> (y_2.data(), x.data(), m,m,m, h,h,h, 1,
+                    num_dot, v_copy, dot_copy, g3);
+    }
+    snprintf (name, sizeof(name), "order %d DOT(Y,Y) aliased", order);
+    ok &= check (name, (dot_copy[1] == dot[1]) &&
+                 memcmp(y_2.data(), y.data(), mmm*sizeof(real)) == 0);
+  }
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,312 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     pm_deposit_benchmark.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Throughput benchmark for the particle mass deposition kernels
+///
+/// usage: pm_deposit_benchmark [num_particles [block_size [repeats]]]
+///
+/// Deposits `num_particles` randomly placed particles, in batches of 1024,
+/// onto a 3D block of `block_size`^3 cells with 3 ghost zones, `repeats`
+/// times, and reports the throughput in particles per second for:
+///
+///   - "reference": the per-particle loop previously used by
+///     EnzoMethodPmDeposit (strided attribute access, with a check for
+///     negative densities after each update)
+///   - "cic", "tsc": the templated kernels in enzo_EnzoPmDepositKernels.hpp
+///
+/// The CIC kernel must reproduce the reference bitwise, and both kernels
+/// must conserve mass to roundoff and give bitwise identical results for
+/// interleaved (strided) particle attributes.  The gas deposit is checked the same
+/// way.  The program exits with status 1 if any check fails.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "enzo_EnzoPmDepositKernels.hpp"
+
+using namespace enzo_pm_deposit;
+
+#ifdef CONFIG_PRECISION_SINGLE
+typedef float real;
+#else
+typedef double real;
+#endif
+
+const int batch_size = 1024;
+
+//----------------------------------------------------------------------
+
+/// Uniform random number in [lo,hi) from a fixed-seed generator
+static double uniform (double lo, double hi)
+{
+  static unsigned long long state = 12345;
+  state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+  return lo + (hi - lo) * ((state >> 11) * (1.0 / 9007199254740992.0));
+}
+
+/// Particle attributes stored in batches of batch_size particles
+struct Particles {
+  Particles (int np) : np(np)
+  {
+    for (int a = 0; a < 3; a++) {
+      x[a].resize(np);
+      v[a].resize(np);
+      for (int ip = 0; ip < np; ip++) {
+        x[a][ip] = uniform(0.0, 1.0);
+        v[a][ip] = uniform(-1.0, 1.0);
+      }
+    }
+    mass.resize(np);
+    for (int ip = 0; ip < np; ip++) mass[ip] = uniform(0.5, 1.5);
+
+    // the same attributes, interleaved particle by particle
+    interleaved.resize(num_attributes*np);
+    for (int ip = 0; ip < np; ip++) {
+      real * p = interleaved.data() + num_attributes*ip;
+      for (int a = 0; a < 3; a++) {
+        p[a]   = x[a][ip];
+        p[3+a] = v[a][ip];
+      }
+      p[6] = mass[ip];
+    }
+  }
+
+  Batch<real> batch (int ib) const
+  {
+    Batch<real> b;
+    const int i0 = ib*batch_size;
+    b.np = std::min(batch_size, np - i0);
+    for (int a = 0; a < 3; a++) {
+      b.x[a] = x[a].data() + i0;
+      b.v[a] = v[a].data() + i0;
+    }
+    b.dx = 1;
+    b.mass = mass.data() + i0;
+    b.dm = 1;
+    return b;
+  }
+
+  Batch<real> interleaved_batch (int ib) const
+  {
+    Batch<real> b;
+    const int i0 = ib*batch_size;
+    const real * p = interleaved.data() + num_attributes*i0;
+    b.np = std::min(batch_size, np - i0);
+    for (int a = 0; a < 3; a++) {
+      b.x[a] = p + a;
+      b.v[a] = p + 3 + a;
+    }
+    b.dx = num_attributes;
+    b.mass = p + 6;
+    b.dm = num_attributes;
+    return b;
+  }
+
+  int num_batches() const { return (np + batch_size - 1) / batch_size; }
+
+  static const int num_attributes = 7;
+
+  int np;
+  std::vector<real> x[3], v[3], mass, interleaved;
+};
+
+//----------------------------------------------------------------------
+
+/// The rank 3 deposit loop formerly in EnzoMethodPmDeposit
+__attribute__((noinline))
+static void deposit_reference (real * de_p, const Grid & grid,
+                               const Batch<real> & b, int dp, int dv,
+                               double dt, double inv_vol, int * negative)
+{
+  const int mx = grid.m[0], my = grid.m[1];
+  const int gx = grid.g[0], gy = grid.g[1], gz = grid.g[2];
+  const int nx = grid.n[0], ny = grid.n[1], nz = grid.n[2];
+  const double xm = grid.lower[0], ym = grid.lower[1], zm = grid.lower[2];
+  const double xp = xm + grid.width[0];
+  const double yp = ym + grid.width[1];
+  const double zp = zm + grid.width[2];
+  for (int ip=0; ip<b.np; ip++) {
+    double x = b.x[0][ip*dp] + b.v[0][ip*dv]*dt;
+    double y = b.x[1][ip*dp] + b.v[1][ip*dv]*dt;
+    double z = b.x[2][ip*dp] + b.v[2][ip*dv]*dt;
+    double tx = nx*(x - xm) / (xp - xm) - 0.5;
+    double ty = ny*(y - ym) / (yp - ym) - 0.5;
+    double tz = nz*(z - zm) / (zp - zm) - 0.5;
+    int ix0 = gx + floor(tx);
+    int iy0 = gy + floor(ty);
+    int iz0 = gz + floor(tz);
+    int ix1 = ix0 + 1;
+    int iy1 = iy0 + 1;
+    int iz1 = iz0 + 1;
+    double x0 = 1.0 - (tx - floor(tx));
+    double y0 = 1.0 - (ty - floor(ty));
+    double z0 = 1.0 - (tz - floor(tz));
+    double x1 = 1.0 - x0;
+    double y1 = 1.0 - y0;
+    double z1 = 1.0 - z0;
+    real pdens = b.mass[ip*b.dm] * inv_vol;
+    const int i[8] = { ix0+mx*(iy0+my*iz0), ix1+mx*(iy0+my*iz0),
+                       ix0+mx*(iy1+my*iz0), ix1+mx*(iy1+my*iz0),
+                       ix0+mx*(iy0+my*iz1), ix1+mx*(iy0+my*iz1),
+                       ix0+mx*(iy1+my*iz1), ix1+mx*(iy1+my*iz1) };
+    de_p[i[0]] += pdens * x0 * y0 * z0;
+    de_p[i[1]] += pdens * x1 * y0 * z0;
+    de_p[i[2]] += pdens * x0 * y1 * z0;
+    de_p[i[3]] += pdens * x1 * y1 * z0;
+    de_p[i[4]] += pdens * x0 * y0 * z1;
+    de_p[i[5]] += pdens * x1 * y0 * z1;
+    de_p[i[6]] += pdens * x0 * y1 * z1;
+    de_p[i[7]] += pdens * x1 * y1 * z1;
+    for (int k = 0; k < 8; k++) if (de_p[i[k]] < 0.0) ++(*negative);
+  }
+}
+
+static double sum (const std::vector<real> & a)
+{
+  double s = 0.0;
+  for (real value : a) s += value;
+  return s;
+}
+
+static bool check (const char * name, bool ok)
+{
+  if (! ok) printf ("FAILED: %s\n", name);
+  return ok;
+}
+
+//----------------------------------------------------------------------
+
+int main (int argc, char ** argv)
+{
+  const int np      = (argc > 1) ? atoi(argv[1]) : 256*1024;
+  const int n       = (argc > 2) ? atoi(argv[2]) : 32;
+  const int repeats = (argc > 3) ? atoi(argv[3]) : 20;
+  const int g = 3;
+  const int m = n + 2*g;
+  const double dt = 0.01;
+  const double inv_vol = double(n)*n*n;
+
+  Grid grid;
+  grid.rank = 3;
+  for (int a = 0; a < 3; a++) {
+    grid.m[a] = m;
+    grid.g[a] = g;
+    grid.n[a] = n;
+    grid.lower[a] = 0.0;
+    grid.width[a] = 1.0;
+  }
+
+  const Particles particles(np);
+  const int nb = particles.num_batches();
+  double mass = 0.0;
+  for (int ip = 0; ip < np; ip++) mass += particles.mass[ip] * inv_vol;
+
+  printf ("particles %d  block %d^3  repeats %d  precision %s\n",
+          np, n, repeats, (sizeof(real) == 4) ? "single" : "double");
+  printf ("%-10s %14s %9s\n", "kernel", "particles/sec", "speedup");
+
+  std::vector<real> reference(m*m*m, 0.0), density(m*m*m, 0.0);
+  bool ok = true;
+
+  // reference
+  int negative = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < repeats; r++) {
+    std::fill (reference.begin(), reference.end(), real(0));
+    for (int ib = 0; ib < nb; ib++) {
+      deposit_reference (reference.data(), grid, particles.batch(ib), 1, 1,
+                         dt, inv_vol, &negative);
+    }
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  const double rate_reference =
+    double(repeats)*np / std::chrono::duration<double>(t1 - t0).count();
+  printf ("%-10s %14.4e %9.2f\n", "reference", rate_reference, 1.0);
+  ok &= check ("reference mass",
+               std::fabs(sum(reference) - mass) <= 1e-5*mass);
+
+  for (int is = 0; is < 2; is++) {
+    const scheme s = (is == 0) ? scheme::cic : scheme::tsc;
+    t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++) {
+      std::fill (density.begin(), density.end(), real(0));
+      for (int ib = 0; ib < nb; ib++) {
+        if (s == scheme::cic) {
+          deposit_particles<scheme::cic>
+            (density.data(), grid, particles.batch(ib), dt, inv_vol);
+        } else {
+          deposit_particles<scheme::tsc>
+            (density.data(), grid, particles.batch(ib), dt, inv_vol);
+        }
+      }
+    }
+    t1 = std::chrono::steady_clock::now();
+    const double rate =
+      double(repeats)*np / std::chrono::duration<double>(t1 - t0).count();
+    printf ("%-10s %14.4e %9.2f\n", (is == 0) ? "cic" : "tsc",
+            rate, rate / rate_reference);
+    if (s == scheme::cic) {
+      ok &= check ("cic matches reference",
+                   memcmp(density.data(), reference.data(),
+                          density.size()*sizeof(real)) == 0);
+    }
+    ok &= check ((is == 0) ? "cic mass" : "tsc mass",
+                 std::fabs(sum(density) - mass) <= 1e-5*mass);
+
+    std::vector<real> strided(m*m*m, 0.0);
+    for (int ib = 0; ib < nb; ib++) {
+      if (s == scheme::cic) {
+        deposit_particles<scheme::cic>
+          (strided.data(), grid, particles.interleaved_batch(ib), dt, inv_vol);
+      } else {
+        deposit_particles<scheme::tsc>
+          (strided.data(), grid, particles.interleaved_batch(ib), dt, inv_vol);
+      }
+    }
+    ok &= check ((is == 0) ? "cic interleaved" : "tsc interleaved",
+                 memcmp(strided.data(), density.data(),
+                        density.size()*sizeof(real)) == 0);
+  }
+
+  // gas deposit: a plain sum when not drifted, and mass conserving when
+  // drifted
+  std::vector<real> de(m*m*m), vel[3], total(m*m*m, 0.0);
+  std::vector<real> scratch((n+1)*(n+1)*(n+1));
+  double gas_mass = 0.0;
+  for (int i = 0; i < m*m*m; i++) de[i] = uniform(0.5, 1.5);
+  for (int iz = g; iz < m-g; iz++)
+    for (int iy = g; iy < m-g; iy++)
+      for (int ix = g; ix < m-g; ix++) gas_mass += de[ix + m*(iy + m*iz)];
+  const real * velocity[3];
+  for (int a = 0; a < 3; a++) {
+    vel[a].resize(m*m*m);
+    for (int i = 0; i < m*m*m; i++) vel[a][i] = uniform(-1.0, 1.0);
+    velocity[a] = vel[a].data();
+  }
+  const real h[3] = {real(1.0/n), real(1.0/n), real(1.0/n)};
+
+  deposit_gas<real> (total.data(), de.data(), velocity, grid, real(0), h,
+                     scratch.data());
+  bool same = true;
+  for (int i = 0; i < m*m*m; i++) {
+    const int ix = i % m, iy = (i / m) % m, iz = i / (m*m);
+    const bool active = (ix >= g && ix < m-g && iy >= g && iy < m-g &&
+                         iz >= g && iz < m-g);
+    same = same && (total[i] == (active ? de[i] : real(0)));
+  }
+  ok &= check ("gas deposit without drift", same);
+
+  std::fill (total.begin(), total.end(), real(0));
+  deposit_gas<real> (total.data(), de.data(), velocity, grid, real(dt), h,
+                     scratch.data());
+  ok &= check ("gas deposit mass",
+               std::fabs(sum(total) - gas_mass) <= 1e-5*gas_mass);
+
+  return ok ? 0 : 1;
+}